@@ -0,0 +1,103 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <documentdb/odbc/adaptive_batch_size.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace documentdb::odbc;
+using namespace boost::unit_test;
+
+namespace {
+/** Fetch time of a batch that is too slow to speed up the growth. */
+const int64_t SLOW = AdaptiveBatchSize::TARGET_BATCH_TIME_US;
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(AdaptiveBatchSizeTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestAdaptiveBatchSizeFirstBatch) {
+  AdaptiveBatchSize batchSize(2000, 4 * 1024 * 1024, 1);
+  BOOST_CHECK_EQUAL(AdaptiveBatchSize::FIRST_BATCH_SIZE,
+                    batchSize.GetFirstBatchSize());
+  BOOST_CHECK_EQUAL(AdaptiveBatchSize::FIRST_BATCH_SIZE,
+                    batchSize.GetBatchSize());
+
+  // First batch holds at least one row set.
+  AdaptiveBatchSize largeRowSet(2000, 4 * 1024 * 1024, 100);
+  BOOST_CHECK_EQUAL(100, largeRowSet.GetFirstBatchSize());
+
+  // First batch never exceeds the maximum.
+  AdaptiveBatchSize smallMax(10, 4 * 1024 * 1024, 1);
+  BOOST_CHECK_EQUAL(10, smallMax.GetFirstBatchSize());
+}
+
+BOOST_AUTO_TEST_CASE(TestAdaptiveBatchSizeGrowth) {
+  AdaptiveBatchSize batchSize(2000, 4 * 1024 * 1024, 1);
+
+  BOOST_CHECK_EQUAL(256, batchSize.GetNextBatchSize(64, 64 * 100, SLOW));
+  BOOST_CHECK_EQUAL(100, batchSize.GetAverageDocumentSize());
+  BOOST_CHECK_EQUAL(1024, batchSize.GetNextBatchSize(256, 256 * 100, SLOW));
+  BOOST_CHECK_EQUAL(2000, batchSize.GetNextBatchSize(1024, 1024 * 100, SLOW));
+  BOOST_CHECK_EQUAL(2000, batchSize.GetNextBatchSize(2000, 2000 * 100, SLOW));
+
+  // Empty batch keeps the current size.
+  BOOST_CHECK_EQUAL(2000, batchSize.GetNextBatchSize(0, 0, SLOW));
+}
+
+BOOST_AUTO_TEST_CASE(TestAdaptiveBatchSizeThroughput) {
+  // 64 documents in 1 ms: 32000 documents fit the target time.
+  AdaptiveBatchSize fast(2000, 4 * 1024 * 1024, 1);
+  BOOST_CHECK_EQUAL(2000, fast.GetNextBatchSize(64, 64 * 100, 1000));
+
+  // 64 documents in 50 ms: 640 documents fit the target time.
+  AdaptiveBatchSize moderate(2000, 4 * 1024 * 1024, 1);
+  BOOST_CHECK_EQUAL(640, moderate.GetNextBatchSize(64, 64 * 100, 50000));
+
+  // A slow link still grows geometrically and never shrinks.
+  AdaptiveBatchSize slow(2000, 4 * 1024 * 1024, 1);
+  BOOST_CHECK_EQUAL(256, slow.GetNextBatchSize(64, 64 * 100, 5000000));
+  BOOST_CHECK_EQUAL(1024, slow.GetNextBatchSize(256, 256 * 100, 20000000));
+
+  // The memory budget still applies.
+  AdaptiveBatchSize budget(2000, 64 * 1024, 1);
+  BOOST_CHECK_EQUAL(64, budget.GetNextBatchSize(64, 64 * 1024, 1000));
+}
+
+BOOST_AUTO_TEST_CASE(TestAdaptiveBatchSizeMemoryBudget) {
+  // 1 MB documents with a 4 MB budget.
+  AdaptiveBatchSize batchSize(2000, 4 * 1024 * 1024, 1);
+
+  BOOST_CHECK_EQUAL(4, batchSize.GetNextBatchSize(64, 64 * 1024 * 1024, SLOW));
+  BOOST_CHECK_EQUAL(1024 * 1024, batchSize.GetAverageDocumentSize());
+
+  // Budget smaller than a document still requests one document.
+  AdaptiveBatchSize tinyBudget(2000, 1024, 1);
+  BOOST_CHECK_EQUAL(1, tinyBudget.GetNextBatchSize(64, 64 * 4096, SLOW));
+}
+
+BOOST_AUTO_TEST_CASE(TestAdaptiveBatchSizeRowArrayMultiple) {
+  AdaptiveBatchSize batchSize(2000, 4 * 1024 * 1024, 100);
+
+  // 100 * 4 = 400 is a multiple of the row array size.
+  BOOST_CHECK_EQUAL(400, batchSize.GetNextBatchSize(100, 100 * 100, SLOW));
+
+  // Memory budget of 4 MB with 10 KB documents allows 409 documents.
+  AdaptiveBatchSize memoryBound(2000, 4 * 1024 * 1024, 100);
+  BOOST_CHECK_EQUAL(400, memoryBound.GetNextBatchSize(100, 100 * 10240, SLOW));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -259,6 +259,133 @@ BOOST_AUTO_TEST_CASE(TestPutStringToWstring) {
   BOOST_CHECK(utility::SqlWcharToString(buffer) == "Test string");
 }
 
+BOOST_AUTO_TEST_CASE(TestPutStringViewToString) {
+  char buffer[1024];
+  SqlLen reslen = 0;
+
+  ApplicationDataBuffer appBuf(OdbcNativeType::AI_CHAR, buffer, sizeof(buffer),
+                               &reslen);
+
+  // Only the first 4 bytes belong to the value, no null terminator.
+  const char data[] = "Testxxxx";
+
+  appBuf.PutString(data, 4);
+
+  BOOST_CHECK(!strcmp(buffer, "Test"));
+  BOOST_CHECK_EQUAL(reslen, 4);
+
+  // Non-ASCII string is counted in characters.
+  std::string utf8String("\xD0\x9F\xD1\x80\xD0\xB8");
+
+  appBuf.PutString(utf8String.data(), utf8String.size());
+  BOOST_CHECK_EQUAL(reslen, 3);
+}
+
+BOOST_AUTO_TEST_CASE(TestPutStringViewToWString) {
+  SQLWCHAR buffer[1024];
+  SqlLen reslen = 0;
+
+  ApplicationDataBuffer appBuf(OdbcNativeType::AI_WCHAR, buffer, sizeof(buffer),
+                               &reslen);
+
+  const char data[] = "Test stringxxxx";
+
+  appBuf.PutString(data, 11);
+  BOOST_CHECK(utility::SqlWcharToString(buffer) == "Test string");
+  BOOST_CHECK_EQUAL(reslen, static_cast< SqlLen >(11 * sizeof(SQLWCHAR)));
+
+  std::string utf8String("\xD0\x9F\xD1\x80\xD0\xB8xx");
+
+  appBuf.PutString(utf8String.data(), utf8String.size() - 2);
+  BOOST_CHECK(utility::SqlWcharToString(buffer) == "\xD0\x9F\xD1\x80\xD0\xB8");
+  BOOST_CHECK_EQUAL(reslen, static_cast< SqlLen >(3 * sizeof(SQLWCHAR)));
+}
+
+BOOST_AUTO_TEST_CASE(TestPutStringViewTruncated) {
+  char buffer[5];
+  SqlLen reslen = 0;
+
+  ApplicationDataBuffer appBuf(OdbcNativeType::AI_CHAR, buffer, sizeof(buffer),
+                               &reslen);
+
+  std::string testString("Test string");
+
+  BOOST_CHECK(appBuf.PutString(testString.data(), testString.size())
+              == ConversionResult::Type::AI_VARLEN_DATA_TRUNCATED);
+  BOOST_CHECK(!strcmp(buffer, "Test"));
+}
+
+BOOST_AUTO_TEST_CASE(TestPutRowWise) {
+  struct Row {
+    SQLINTEGER value;
+    SQLLEN valueInd;
+    char str[16];
+    SQLLEN strLen;
+  };
+
+  Row rows[3];
+  memset(rows, 0, sizeof(rows));
+
+  ApplicationDataBuffer intBuf(OdbcNativeType::AI_SIGNED_LONG,
+                               &rows[0].value, 0, &rows[0].valueInd);
+  ApplicationDataBuffer strBuf(OdbcNativeType::AI_CHAR, rows[0].str,
+                               sizeof(rows[0].str), &rows[0].strLen);
+
+  intBuf.SetBindType(sizeof(Row));
+  strBuf.SetBindType(sizeof(Row));
+
+  for (SqlUlen i = 0; i < 3; ++i) {
+    intBuf.SetElementOffset(i);
+    strBuf.SetElementOffset(i);
+
+    intBuf.PutInt32(static_cast< int32_t >(i + 10));
+    strBuf.PutString(std::string(i + 1, 'a'));
+  }
+
+  for (SqlUlen i = 0; i < 3; ++i) {
+    BOOST_CHECK_EQUAL(rows[i].value, static_cast< SQLINTEGER >(i + 10));
+    BOOST_CHECK_EQUAL(rows[i].valueInd,
+                      static_cast< SqlLen >(sizeof(SQLINTEGER)));
+    BOOST_CHECK_EQUAL(std::string(rows[i].str), std::string(i + 1, 'a'));
+    BOOST_CHECK_EQUAL(rows[i].strLen, static_cast< SqlLen >(i + 1));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestPutDataPart) {
+  const char* data = "Hello World";
+  const size_t len = strlen(data);
+  char buffer[5];
+  SqlLen reslen = 0;
+  size_t written = 0;
+
+  ApplicationDataBuffer appBuf(OdbcNativeType::AI_CHAR, buffer,
+                               sizeof(buffer), &reslen);
+
+  std::string result;
+  size_t offset = 0;
+  ConversionResult::Type res = ConversionResult::Type::AI_SUCCESS;
+  do {
+    res = appBuf.PutDataPart(data + offset, len - offset, 1, written);
+    BOOST_CHECK_EQUAL(reslen, static_cast< SqlLen >(len - offset));
+    offset += written;
+    result += buffer;
+  } while (res == ConversionResult::Type::AI_VARLEN_DATA_TRUNCATED);
+
+  BOOST_CHECK(res == ConversionResult::Type::AI_SUCCESS);
+  BOOST_CHECK_EQUAL(result, data);
+  BOOST_CHECK_EQUAL(offset, len);
+
+  uint8_t binBuffer[4];
+  ApplicationDataBuffer binBuf(OdbcNativeType::AI_BINARY, binBuffer,
+                               sizeof(binBuffer), &reslen);
+
+  res = binBuf.PutDataPart(data, len, 0, written);
+  BOOST_CHECK(res == ConversionResult::Type::AI_VARLEN_DATA_TRUNCATED);
+  BOOST_CHECK_EQUAL(written, sizeof(binBuffer));
+  BOOST_CHECK_EQUAL(reslen, static_cast< SqlLen >(len));
+  BOOST_CHECK(memcmp(binBuffer, data, sizeof(binBuffer)) == 0);
+}
+
 BOOST_AUTO_TEST_CASE(TestPutStringToLong) {
   SQLINTEGER numBuf;
   SqlLen reslen = 0;
@@ -32,6 +32,7 @@
 #include "documentdb/odbc/binary/binary_object.h"
 #include "documentdb/odbc/common/fixed_size_array.h"
 #include "documentdb/odbc/impl/binary/binary_utils.h"
+#include "documentdb/odbc/system/odbc_constants.h"
 #include "documentdb/odbc/utility.h"
 #include "odbc_test_suite.h"
 #include "test_type.h"
@@ -108,6 +109,99 @@ BOOST_AUTO_TEST_CASE(ConnectionAttributeConnectionDeadSet) {
   CheckSQLConnectionDiagnosticError("HY092");
 }
 
+BOOST_AUTO_TEST_CASE(ConnectionAttributeRefreshCatalog) {
+  connectToLocalServer("odbc-test");
+
+  std::vector< SQLWCHAR > empty = {0};
+  std::vector< SQLWCHAR > table = MakeSqlBuffer("%");
+  SQLRETURN ret;
+
+  for (int i = 0; i < 2; ++i) {
+    ret = SQLTables(stmt, empty.data(), SQL_NTS, nullptr, 0, table.data(),
+                    SQL_NTS, empty.data(), SQL_NTS);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    ret = SQLFetch(stmt);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    ret = SQLCloseCursor(stmt);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    // The catalog is loaded again on the next call.
+    ret = SQLSetConnectAttr(dbc, SQL_ATTR_DOCUMENTDB_REFRESH_CATALOG, nullptr,
+                            0);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_DBC, dbc);
+  }
+
+  SQLUINTEGER value = 0;
+  ret = SQLGetConnectAttr(dbc, SQL_ATTR_DOCUMENTDB_REFRESH_CATALOG, &value, 0,
+                          0);
+
+  BOOST_REQUIRE_EQUAL(ret, SQL_ERROR);
+
+  CheckSQLConnectionDiagnosticError("HY092");
+}
+
+BOOST_AUTO_TEST_CASE(ConnectionAttributeResetConnection) {
+  connectToLocalServer("odbc-test");
+
+  SQLUINTEGER established = 0;
+  SQLRETURN ret =
+      SQLGetConnectAttr(dbc, SQL_ATTR_LOGIN_TIMEOUT, &established, 0, 0);
+
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_DBC, dbc);
+
+  ret = SQLSetConnectAttr(dbc, SQL_ATTR_LOGIN_TIMEOUT,
+                          reinterpret_cast< SQLPOINTER >(established + 17), 0);
+
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_DBC, dbc);
+
+  ret = SQLSetConnectAttr(dbc, SQL_ATTR_RESET_CONNECTION,
+                          reinterpret_cast< SQLPOINTER >(
+                              static_cast< ptrdiff_t >(1)),
+                          0);
+
+  BOOST_REQUIRE_EQUAL(ret, SQL_ERROR);
+
+  CheckSQLConnectionDiagnosticError("HY024");
+
+  ret = SQLSetConnectAttr(dbc, SQL_ATTR_RESET_CONNECTION,
+                          reinterpret_cast< SQLPOINTER >(
+                              static_cast< ptrdiff_t >(
+                                  SQL_RESET_CONNECTION_YES)),
+                          0);
+
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_DBC, dbc);
+
+  SQLUINTEGER timeout = 0;
+  ret = SQLGetConnectAttr(dbc, SQL_ATTR_LOGIN_TIMEOUT, &timeout, 0, 0);
+
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_DBC, dbc);
+  BOOST_REQUIRE_EQUAL(timeout, established);
+
+  // The connection stays open and usable after the reset.
+  SQLUINTEGER dead = SQL_CD_TRUE;
+  ret = SQLGetConnectAttr(dbc, SQL_ATTR_CONNECTION_DEAD, &dead, 0, 0);
+
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_DBC, dbc);
+  BOOST_REQUIRE_EQUAL(dead, SQL_CD_FALSE);
+
+  std::vector< SQLWCHAR > empty = {0};
+  std::vector< SQLWCHAR > table = MakeSqlBuffer("%");
+  ret = SQLTables(stmt, empty.data(), SQL_NTS, nullptr, 0, table.data(),
+                  SQL_NTS, empty.data(), SQL_NTS);
+
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLFetch(stmt);
+
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+}
+
 BOOST_AUTO_TEST_CASE(StatementAttributeQueryTimeout) {
   connectToLocalServer("odbc-test");
 
@@ -215,4 +309,31 @@ BOOST_AUTO_TEST_CASE(TestSQLGetEnvAttrDriverVersion) {
   BOOST_CHECK_EQUAL(version, SQL_OV_ODBC3);
 }
 
+/**
+ * Check that an application can request the ODBC 3.80 behaviour.
+ *
+ * 1. Allocate an environment handle.
+ * 2. Set the ODBC version to 3.80.
+ * 3. Check that no diagnostic is returned and that the version is kept.
+ */
+BOOST_AUTO_TEST_CASE(TestSQLSetEnvAttrOdbcVersion380) {
+  SQLHENV env380 = SQL_NULL_HANDLE;
+  SQLRETURN ret = SQLAllocHandle(SQL_HANDLE_ENV, SQL_NULL_HANDLE, &env380);
+
+  BOOST_REQUIRE_EQUAL(ret, SQL_SUCCESS);
+
+  ret = SQLSetEnvAttr(env380, SQL_ATTR_ODBC_VERSION,
+                      reinterpret_cast< void* >(SQL_OV_ODBC3_80), 0);
+
+  BOOST_CHECK_EQUAL(ret, SQL_SUCCESS);
+
+  SQLINTEGER version = 0;
+  ret = SQLGetEnvAttr(env380, SQL_ATTR_ODBC_VERSION, &version, 0, 0);
+
+  BOOST_CHECK_EQUAL(ret, SQL_SUCCESS);
+  BOOST_CHECK_EQUAL(version, SQL_OV_ODBC3_80);
+
+  SQLFreeHandle(SQL_HANDLE_ENV, env380);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
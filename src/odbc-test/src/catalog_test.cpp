@@ -0,0 +1,166 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <documentdb/odbc/meta/catalog.h>
+
+#include <boost/test/unit_test.hpp>
+#include <string>
+
+using documentdb::odbc::meta::Catalog;
+using documentdb::odbc::meta::ColumnMeta;
+using documentdb::odbc::meta::ColumnMetaVector;
+using documentdb::odbc::meta::Nullability;
+using documentdb::odbc::meta::PrimaryKeyMeta;
+using documentdb::odbc::meta::PrimaryKeyMetaVector;
+using documentdb::odbc::meta::TableMeta;
+using documentdb::odbc::meta::TableMetaVector;
+using namespace boost::unit_test;
+
+namespace {
+const std::vector< std::string > TABLE_TYPES(1, "TABLE");
+
+/**
+ * Makes a catalog of two schemas.
+ */
+struct CatalogTestSuiteFixture {
+  CatalogTestSuiteFixture() : catalog(MakeTables(), MakeColumns()) {
+    // No-op.
+  }
+
+  static TableMetaVector MakeTables() {
+    TableMetaVector tables;
+    tables.emplace_back(TableMeta("", "odbc-test", "customers", "TABLE"));
+    tables.emplace_back(
+        TableMeta("", "odbc-test", "customers_address", "TABLE"));
+    tables.emplace_back(TableMeta("", "odbc-test", "orders", "TABLE"));
+    tables.emplace_back(TableMeta("", "other", "orders", "VIEW"));
+    return tables;
+  }
+
+  static ColumnMetaVector MakeColumns() {
+    ColumnMetaVector columns;
+    columns.emplace_back(ColumnMeta("odbc-test", "customers",
+                                    "customers__id", 12,
+                                    Nullability::NO_NULL));
+    columns.emplace_back(ColumnMeta("odbc-test", "customers", "name", 12,
+                                    Nullability::NULLABLE));
+    columns.emplace_back(ColumnMeta("odbc-test", "orders", "orders__id", 12,
+                                    Nullability::NO_NULL));
+    columns.emplace_back(ColumnMeta("other", "orders", "orders__id", 12,
+                                    Nullability::NO_NULL));
+    return columns;
+  }
+
+  Catalog catalog;
+};
+}  // namespace
+
+BOOST_FIXTURE_TEST_SUITE(CatalogTestSuite, CatalogTestSuiteFixture)
+
+BOOST_AUTO_TEST_CASE(TestCatalogMatchPattern) {
+  BOOST_CHECK(Catalog::MatchPattern("orders", "orders"));
+  BOOST_CHECK(!Catalog::MatchPattern("orders", "Orders"));
+  BOOST_CHECK(!Catalog::MatchPattern("orders", "order"));
+  BOOST_CHECK(Catalog::MatchPattern("orders", "%"));
+  BOOST_CHECK(Catalog::MatchPattern("", "%"));
+  BOOST_CHECK(Catalog::MatchPattern("", ""));
+  BOOST_CHECK(!Catalog::MatchPattern("orders", ""));
+  BOOST_CHECK(Catalog::MatchPattern("orders", "ord%"));
+  BOOST_CHECK(Catalog::MatchPattern("orders", "%ers"));
+  BOOST_CHECK(Catalog::MatchPattern("orders", "o%r%s"));
+  BOOST_CHECK(Catalog::MatchPattern("orders", "%%d%%"));
+  BOOST_CHECK(!Catalog::MatchPattern("orders", "%x%"));
+  BOOST_CHECK(Catalog::MatchPattern("orders", "o_ders"));
+  BOOST_CHECK(Catalog::MatchPattern("orders", "______"));
+  BOOST_CHECK(!Catalog::MatchPattern("orders", "_____"));
+  BOOST_CHECK(Catalog::MatchPattern("abcabcx", "%abcx"));
+  BOOST_CHECK(Catalog::MatchPattern("a_b", "a\\_b"));
+  BOOST_CHECK(!Catalog::MatchPattern("axb", "a\\_b"));
+  BOOST_CHECK(Catalog::MatchPattern("100%", "100\\%"));
+  BOOST_CHECK(!Catalog::MatchPattern("1000", "100\\%"));
+  BOOST_CHECK(Catalog::MatchPattern("a\\b", "a\\\\b"));
+}
+
+BOOST_AUTO_TEST_CASE(TestCatalogGetTables) {
+  TableMetaVector tables;
+
+  catalog.GetTables(boost::none, boost::none, "%", boost::none, tables);
+  BOOST_REQUIRE_EQUAL(tables.size(), 4);
+  BOOST_CHECK_EQUAL(*tables[0].GetTableName(), "customers");
+  BOOST_CHECK_EQUAL(*tables[3].GetSchemaName(), "other");
+
+  catalog.GetTables(std::string(""), std::string("odbc-test"), "customers%",
+                    TABLE_TYPES, tables);
+  BOOST_REQUIRE_EQUAL(tables.size(), 2);
+  BOOST_CHECK_EQUAL(*tables[1].GetTableName(), "customers_address");
+
+  catalog.GetTables(boost::none, boost::none, "orders", TABLE_TYPES, tables);
+  BOOST_REQUIRE_EQUAL(tables.size(), 1);
+  BOOST_CHECK_EQUAL(*tables[0].GetSchemaName(), "odbc-test");
+
+  catalog.GetTables(boost::none, std::string(""), "%", boost::none, tables);
+  BOOST_CHECK(tables.empty());
+
+  catalog.GetTables(std::string("nonexistent"), boost::none, "%",
+                    boost::none, tables);
+  BOOST_CHECK(tables.empty());
+}
+
+BOOST_AUTO_TEST_CASE(TestCatalogGetColumns) {
+  ColumnMetaVector columns;
+
+  catalog.GetColumns(boost::none, boost::none, "%", "%", columns);
+  BOOST_CHECK_EQUAL(columns.size(), 4);
+
+  catalog.GetColumns(std::string(""), std::string("odbc-test"), "customers",
+                     "%", columns);
+  BOOST_REQUIRE_EQUAL(columns.size(), 2);
+  BOOST_CHECK_EQUAL(*columns[0].GetColumnName(), "customers__id");
+  BOOST_CHECK_EQUAL(*columns[1].GetColumnName(), "name");
+
+  catalog.GetColumns(boost::none, boost::none, "%", "%\\_\\_id", columns);
+  BOOST_CHECK_EQUAL(columns.size(), 3);
+
+  catalog.GetColumns(boost::none, std::string("oth_r"), "orders", "%",
+                     columns);
+  BOOST_REQUIRE_EQUAL(columns.size(), 1);
+  BOOST_CHECK_EQUAL(*columns[0].GetSchemaName(), "other");
+}
+
+BOOST_AUTO_TEST_CASE(TestCatalogPrimaryKeys) {
+  PrimaryKeyMetaVector keys;
+
+  BOOST_CHECK(!catalog.GetPrimaryKeys(boost::none, boost::none,
+                                      std::string("customers"), keys));
+
+  PrimaryKeyMetaVector customersKeys;
+  customersKeys.emplace_back(PrimaryKeyMeta(
+      "", "odbc-test", "customers", "customers__id", 1, "customers__id"));
+  catalog.PutPrimaryKeys(boost::none, boost::none, std::string("customers"),
+                         customersKeys);
+
+  BOOST_REQUIRE(catalog.GetPrimaryKeys(boost::none, boost::none,
+                                       std::string("customers"), keys));
+  BOOST_REQUIRE_EQUAL(keys.size(), 1);
+  BOOST_CHECK_EQUAL(*keys[0].GetColumnName(), "customers__id");
+
+  // Unset and empty values are different requests.
+  BOOST_CHECK(!catalog.GetPrimaryKeys(std::string(""), boost::none,
+                                      std::string("customers"), keys));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -283,6 +283,25 @@ void CheckConnectionConfig(const Configuration& cfg) {
       << "&tlsCAFile=" << EncodeURIComponent(testTlsCaFile);
   const std::string& expectedJdbcStr = jdbcConstructor.str();
 
+  std::stringstream tunneledJdbcConstructor;
+  tunneledJdbcConstructor
+      << "jdbc:documentdb://" << testUsername << ":" << testPassword
+      << "@localhost:27019/" << testDatabaseName << '?'
+      << "appName=" << testAppName
+      << "&defaultFetchSize=" << testDefaultFetchSize
+      << "&loginTimeoutSec=" << testLoginTimeoutSec
+      << "&readPreference=" << ReadPreference::ToJdbcString(testReadPreference)
+      << "&refreshSchema=" << BoolToStr(testRefreshSchemaFlag)
+      << "&replicaSet=" << testReplicaSet
+      << "&retryReads=" << BoolToStr(testRetryReads)
+      << "&scanLimit=" << testScanLimit
+      << "&scanMethod=" << ScanMethod::ToJdbcString(testScanMethod)
+      << "&schemaName=" << testSchemaName << "&tls=" << BoolToStr(testTlsFlag)
+      << "&tlsAllowInvalidHostnames="
+      << BoolToStr(testTlsAllowInvalidHostnamesFlag)
+      << "&tlsCAFile=" << EncodeURIComponent(testTlsCaFile);
+  const std::string& expectedTunneledJdbcStr = tunneledJdbcConstructor.str();
+
   std::stringstream mongodbConstructor;
   mongodbConstructor
       << "mongodb://" << testUsername << ":" << testPassword << "@" 
@@ -302,6 +321,8 @@ void CheckConnectionConfig(const Configuration& cfg) {
   BOOST_CHECK_EQUAL(documentdb::odbc::common::ToLower(cfg.ToConnectString()),
                     documentdb::odbc::common::ToLower(expectedStr));
   BOOST_CHECK_EQUAL(cfg.ToJdbcConnectionString(), expectedJdbcStr);
+  BOOST_CHECK_EQUAL(cfg.ToJdbcConnectionString(27019),
+                    expectedTunneledJdbcStr);
   BOOST_CHECK_EQUAL(cfg.ToMongoDbConnectionString(0), expectedMongoDbStr);
 }
 
@@ -347,6 +368,36 @@ void CheckDsnConfig(const Configuration& cfg) {
                     Configuration::DefaultValue::refreshSchema);
   BOOST_CHECK_EQUAL(cfg.GetDefaultFetchSize(),
                     Configuration::DefaultValue::defaultFetchSize);
+  BOOST_CHECK_EQUAL(cfg.GetPrefetchBatches(),
+                    Configuration::DefaultValue::prefetchBatches);
+  BOOST_CHECK_EQUAL(cfg.GetPrefetchMemoryLimit(),
+                    Configuration::DefaultValue::prefetchMemoryLimit);
+  BOOST_CHECK_EQUAL(cfg.IsAdaptiveFetch(),
+                    Configuration::DefaultValue::adaptiveFetch);
+  BOOST_CHECK_EQUAL(cfg.GetFetchMemoryLimit(),
+                    Configuration::DefaultValue::fetchMemoryLimit);
+  BOOST_CHECK_EQUAL(cfg.GetQueryCacheSize(),
+                    Configuration::DefaultValue::queryCacheSize);
+  BOOST_CHECK_EQUAL(cfg.IsNativeQueryTranslation(),
+                    Configuration::DefaultValue::nativeQueryTranslation);
+  BOOST_CHECK_EQUAL(cfg.GetJvmInitialHeapSize(),
+                    Configuration::DefaultValue::jvmInitialHeapSize);
+  BOOST_CHECK_EQUAL(cfg.GetJvmMaxHeapSize(),
+                    Configuration::DefaultValue::jvmMaxHeapSize);
+  BOOST_CHECK_EQUAL(cfg.GetJvmGarbageCollector(),
+                    Configuration::DefaultValue::jvmGarbageCollector);
+  BOOST_CHECK_EQUAL(cfg.GetJvmCdsArchive(),
+                    Configuration::DefaultValue::jvmCdsArchive);
+  BOOST_CHECK_EQUAL(cfg.GetMetadataCacheDir(),
+                    Configuration::DefaultValue::metadataCacheDir);
+  BOOST_CHECK_EQUAL(cfg.GetMetadataCacheTtl(),
+                    Configuration::DefaultValue::metadataCacheTtl);
+  BOOST_CHECK_EQUAL(cfg.IsNativeCatalog(),
+                    Configuration::DefaultValue::nativeCatalog);
+  BOOST_CHECK_EQUAL(cfg.GetMaxPoolSize(),
+                    Configuration::DefaultValue::maxPoolSize);
+  BOOST_CHECK_EQUAL(cfg.GetMinPoolSize(),
+                    Configuration::DefaultValue::minPoolSize);
   BOOST_CHECK(cfg.GetReadPreference()
               == Configuration::DefaultValue::readPreference);
   BOOST_CHECK(cfg.GetScanMethod() == Configuration::DefaultValue::scanMethod);
@@ -664,6 +715,227 @@ BOOST_AUTO_TEST_CASE(TestConnectStringValidReadPreference) {
                            ReadPreference::Type::NEAREST);
 }
 
+BOOST_AUTO_TEST_CASE(TestConnectStringValidPrefetch) {
+  Configuration cfg;
+
+  ParseValidConnectString("prefetch_batches=4;prefetch_memory_limit=16;",
+                          cfg);
+
+  BOOST_CHECK_EQUAL(cfg.GetPrefetchBatches(), 4);
+  BOOST_CHECK_EQUAL(cfg.GetPrefetchMemoryLimit(), 16);
+  BOOST_CHECK_EQUAL(cfg.ToConnectString(),
+                    "prefetch_batches=4;prefetch_memory_limit=16;");
+
+  Configuration cfgDisabled;
+
+  ParseValidConnectString("prefetch_batches=0;", cfgDisabled);
+
+  BOOST_CHECK(cfgDisabled.IsPrefetchBatchesSet());
+  BOOST_CHECK_EQUAL(cfgDisabled.GetPrefetchBatches(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(TestConnectStringInvalidPrefetch) {
+  Configuration cfg;
+
+  ParseConnectStringWithError("prefetch_batches=-1;", cfg);
+  ParseConnectStringWithError("prefetch_batches=two;", cfg);
+  ParseConnectStringWithError("prefetch_batches=99999999999;", cfg);
+  ParseConnectStringWithError("prefetch_memory_limit=0;", cfg);
+  ParseConnectStringWithError("prefetch_memory_limit=16mb;", cfg);
+
+  BOOST_CHECK_EQUAL(cfg.GetPrefetchBatches(),
+                    Configuration::DefaultValue::prefetchBatches);
+  BOOST_CHECK_EQUAL(cfg.GetPrefetchMemoryLimit(),
+                    Configuration::DefaultValue::prefetchMemoryLimit);
+}
+
+BOOST_AUTO_TEST_CASE(TestConnectStringValidAdaptiveFetch) {
+  Configuration cfg;
+
+  ParseValidConnectString("adaptive_fetch=true;fetch_memory_limit=8;", cfg);
+
+  BOOST_CHECK(cfg.IsAdaptiveFetch());
+  BOOST_CHECK_EQUAL(cfg.GetFetchMemoryLimit(), 8);
+  BOOST_CHECK_EQUAL(cfg.ToConnectString(),
+                    "adaptive_fetch=true;fetch_memory_limit=8;");
+}
+
+BOOST_AUTO_TEST_CASE(TestConnectStringInvalidAdaptiveFetch) {
+  Configuration cfg;
+
+  ParseConnectStringWithError("fetch_memory_limit=0;", cfg);
+  ParseConnectStringWithError("fetch_memory_limit=-4;", cfg);
+  ParseConnectStringWithError("fetch_memory_limit=4mb;", cfg);
+  ParseConnectStringWithError("fetch_memory_limit=99999999999;", cfg);
+
+  BOOST_CHECK_EQUAL(cfg.IsAdaptiveFetch(),
+                    Configuration::DefaultValue::adaptiveFetch);
+  BOOST_CHECK_EQUAL(cfg.GetFetchMemoryLimit(),
+                    Configuration::DefaultValue::fetchMemoryLimit);
+}
+
+BOOST_AUTO_TEST_CASE(TestConnectStringValidQueryCacheSize) {
+  Configuration cfg;
+
+  ParseValidConnectString("query_cache_size=10;", cfg);
+
+  BOOST_CHECK_EQUAL(cfg.GetQueryCacheSize(), 10);
+  BOOST_CHECK_EQUAL(cfg.ToConnectString(), "query_cache_size=10;");
+
+  Configuration cfgDisabled;
+
+  ParseValidConnectString("query_cache_size=0;", cfgDisabled);
+
+  BOOST_CHECK(cfgDisabled.IsQueryCacheSizeSet());
+  BOOST_CHECK_EQUAL(cfgDisabled.GetQueryCacheSize(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(TestConnectStringInvalidQueryCacheSize) {
+  Configuration cfg;
+
+  ParseConnectStringWithError("query_cache_size=-1;", cfg);
+  ParseConnectStringWithError("query_cache_size=ten;", cfg);
+  ParseConnectStringWithError("query_cache_size=99999999999;", cfg);
+
+  BOOST_CHECK_EQUAL(cfg.GetQueryCacheSize(),
+                    Configuration::DefaultValue::queryCacheSize);
+}
+
+BOOST_AUTO_TEST_CASE(TestConnectStringValidNativeQueryTranslation) {
+  Configuration cfg;
+
+  ParseValidConnectString("native_query_translation=false;", cfg);
+
+  BOOST_CHECK(cfg.IsNativeQueryTranslationSet());
+  BOOST_CHECK(!cfg.IsNativeQueryTranslation());
+  BOOST_CHECK_EQUAL(cfg.ToConnectString(), "native_query_translation=false;");
+}
+
+BOOST_AUTO_TEST_CASE(TestConnectStringValidNativeCatalog) {
+  Configuration cfg;
+
+  ParseValidConnectString("native_catalog=false;", cfg);
+
+  BOOST_CHECK(cfg.IsNativeCatalogSet());
+  BOOST_CHECK(!cfg.IsNativeCatalog());
+  BOOST_CHECK_EQUAL(cfg.ToConnectString(), "native_catalog=false;");
+}
+
+BOOST_AUTO_TEST_CASE(TestConnectStringValidPoolSize) {
+  Configuration cfg;
+
+  ParseValidConnectString("max_pool_size=10;min_pool_size=2;", cfg);
+
+  BOOST_CHECK_EQUAL(cfg.GetMaxPoolSize(), 10);
+  BOOST_CHECK_EQUAL(cfg.GetMinPoolSize(), 2);
+  BOOST_CHECK_EQUAL(cfg.ToConnectString(),
+                    "max_pool_size=10;min_pool_size=2;");
+
+  Configuration cfgDisabled;
+
+  ParseValidConnectString("max_pool_size=0;", cfgDisabled);
+
+  BOOST_CHECK(cfgDisabled.IsMaxPoolSizeSet());
+  BOOST_CHECK_EQUAL(cfgDisabled.GetMaxPoolSize(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(TestConnectStringInvalidPoolSize) {
+  Configuration cfg;
+
+  ParseConnectStringWithError("max_pool_size=-1;", cfg);
+  ParseConnectStringWithError("min_pool_size=few;", cfg);
+
+  BOOST_CHECK_EQUAL(cfg.GetMaxPoolSize(),
+                    Configuration::DefaultValue::maxPoolSize);
+  BOOST_CHECK_EQUAL(cfg.GetMinPoolSize(),
+                    Configuration::DefaultValue::minPoolSize);
+}
+
+BOOST_AUTO_TEST_CASE(TestConnectStringValidJvmSettings) {
+  Configuration cfg;
+
+  ParseValidConnectString(
+      "jvm_initial_heap_size=64;jvm_max_heap_size=512;"
+      "jvm_garbage_collector=Serial;jvm_cds_archive=/tmp/documentdb.jsa;",
+      cfg);
+
+  BOOST_CHECK_EQUAL(cfg.GetJvmInitialHeapSize(), 64);
+  BOOST_CHECK_EQUAL(cfg.GetJvmMaxHeapSize(), 512);
+  BOOST_CHECK_EQUAL(cfg.GetJvmGarbageCollector(), "serial");
+  BOOST_CHECK_EQUAL(cfg.GetJvmCdsArchive(), "/tmp/documentdb.jsa");
+  BOOST_CHECK_EQUAL(cfg.ToConnectString(),
+                    "jvm_cds_archive=/tmp/documentdb.jsa;"
+                    "jvm_garbage_collector=serial;jvm_initial_heap_size=64;"
+                    "jvm_max_heap_size=512;");
+}
+
+BOOST_AUTO_TEST_CASE(TestConnectStringInvalidJvmSettings) {
+  Configuration cfg;
+
+  ParseConnectStringWithError("jvm_initial_heap_size=0;", cfg);
+  ParseConnectStringWithError("jvm_initial_heap_size=64m;", cfg);
+  ParseConnectStringWithError("jvm_max_heap_size=-1;", cfg);
+  ParseConnectStringWithError("jvm_max_heap_size=99999999999;", cfg);
+  ParseConnectStringWithError("jvm_garbage_collector=zgc;", cfg);
+
+  BOOST_CHECK_EQUAL(cfg.GetJvmInitialHeapSize(),
+                    Configuration::DefaultValue::jvmInitialHeapSize);
+  BOOST_CHECK_EQUAL(cfg.GetJvmMaxHeapSize(),
+                    Configuration::DefaultValue::jvmMaxHeapSize);
+  BOOST_CHECK_EQUAL(cfg.GetJvmGarbageCollector(),
+                    Configuration::DefaultValue::jvmGarbageCollector);
+}
+
+BOOST_AUTO_TEST_CASE(TestConnectStringInitialHeapGreaterThanMaxHeap) {
+  Configuration cfg;
+
+  ParseValidConnectString(
+      "hostname=localhost;user=user;password=password;database=test;"
+      "jvm_initial_heap_size=2048;jvm_max_heap_size=1024;",
+      cfg);
+
+  BOOST_CHECK_THROW(cfg.Validate(), OdbcError);
+}
+
+BOOST_AUTO_TEST_CASE(TestConnectStringMaxHeapBelowDefaultInitialHeap) {
+  Configuration cfg;
+
+  ParseValidConnectString(
+      "hostname=localhost;user=user;password=password;database=test;"
+      "jvm_max_heap_size=128;",
+      cfg);
+
+  // The initial size is not set, its default is lowered to the maximum size.
+  BOOST_CHECK(!cfg.IsJvmInitialHeapSizeSet());
+  BOOST_CHECK_EQUAL(cfg.GetJvmMaxHeapSize(), 128);
+  BOOST_CHECK_NO_THROW(cfg.Validate());
+}
+
+BOOST_AUTO_TEST_CASE(TestConnectStringValidMetadataCache) {
+  Configuration cfg;
+
+  ParseValidConnectString(
+      "metadata_cache_dir=/tmp/documentdb;metadata_cache_ttl=600;", cfg);
+
+  BOOST_CHECK_EQUAL(cfg.GetMetadataCacheDir(), "/tmp/documentdb");
+  BOOST_CHECK_EQUAL(cfg.GetMetadataCacheTtl(), 600);
+  BOOST_CHECK_EQUAL(
+      cfg.ToConnectString(),
+      "metadata_cache_dir=/tmp/documentdb;metadata_cache_ttl=600;");
+}
+
+BOOST_AUTO_TEST_CASE(TestConnectStringInvalidMetadataCache) {
+  Configuration cfg;
+
+  ParseConnectStringWithError("metadata_cache_ttl=0;", cfg);
+  ParseConnectStringWithError("metadata_cache_ttl=-1;", cfg);
+  ParseConnectStringWithError("metadata_cache_ttl=1h;", cfg);
+  ParseConnectStringWithError("metadata_cache_ttl=99999999999;", cfg);
+
+  BOOST_CHECK_EQUAL(cfg.GetMetadataCacheTtl(),
+                    Configuration::DefaultValue::metadataCacheTtl);
+}
+
 BOOST_AUTO_TEST_CASE(TestConnectStringInvalidBoolKeys) {
   typedef std::set< std::string > Set;
 
@@ -674,6 +946,9 @@ BOOST_AUTO_TEST_CASE(TestConnectStringInvalidBoolKeys) {
   keys.emplace("tls_allow_invalid_hostnames");
   keys.emplace("ssh_strict_host_key_checking");
   keys.emplace("refresh_schema");
+  keys.emplace("adaptive_fetch");
+  keys.emplace("native_query_translation");
+  keys.emplace("native_catalog");
 
   for (auto it = keys.begin(); it != keys.end(); ++it) {
     const std::string& key = *it;
@@ -699,6 +974,9 @@ BOOST_AUTO_TEST_CASE(TestConnectStringValidBoolKeys) {
   keys.emplace("tls_allow_invalid_hostnames");
   keys.emplace("ssh_strict_host_key_checking");
   keys.emplace("refresh_schema");
+  keys.emplace("adaptive_fetch");
+  keys.emplace("native_query_translation");
+  keys.emplace("native_catalog");
 
   for (auto it = keys.begin(); it != keys.end(); ++it) {
     const std::string& key = *it;
@@ -156,6 +156,22 @@ BOOST_DATA_TEST_CASE_F(ConnectionTestSuiteFixture,
   }
 }
 
+BOOST_DATA_TEST_CASE_F(ConnectionTestSuiteFixture,
+                       TestConnectionPooledClients,
+                       data::make({"MIN_POOL_SIZE=1;MAX_POOL_SIZE=2;",
+                                   "MAX_POOL_SIZE=0;"}),
+                       poolOptions) {
+  std::string connectionString;
+  CreateDsnConnectionStringForLocalServer(connectionString, "", "",
+                                          poolOptions);
+
+  // Later connections borrow the client returned by the previous ones.
+  for (int i = 0; i < 3; ++i) {
+    Connect(connectionString);
+    Disconnect();
+  }
+}
+
 BOOST_DATA_TEST_CASE_F(ConnectionTestSuiteFixture,
                        TestConnectionIncompleteBasicProperties,
                        data::make({false, true}), useSqlConnect) {
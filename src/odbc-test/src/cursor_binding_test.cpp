@@ -27,6 +27,7 @@
 #include <string>
 #include <vector>
 
+#include "documentdb/odbc/system/odbc_constants.h"
 #include "documentdb/odbc/utility.h"
 #include "odbc_test_suite.h"
 #include "test_type.h"
@@ -233,17 +234,424 @@ BOOST_AUTO_TEST_CASE(TestCursorBindingColumnWise) {
   ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
 }
 
-BOOST_AUTO_TEST_CASE(TestCursorBindingRowWise) {
+BOOST_AUTO_TEST_CASE(TestCursorBindingColumnWiseSparse) {
+  enum { ROWS_COUNT = 16 };
+  enum { ROW_ARRAY_SIZE = 20 };
+  enum { BUFFER_SIZE = 64 };
+
   std::string connectionStr;
   CreateDsnConnectionStringForLocalServer(connectionStr);
   Connect(connectionStr);
 
-  SQLRETURN ret = SQLSetStmtAttr(stmt, SQL_ATTR_ROW_BIND_TYPE,
-                                 reinterpret_cast< SQLPOINTER* >(42), 0);
+  SQLUSMALLINT RowStatus[ROW_ARRAY_SIZE];
+  SQLUINTEGER NumRowsFetched;
+
+  SQLRETURN ret;
+
+  ret = SQLSetStmtAttr(stmt, SQL_ATTR_ROW_ARRAY_SIZE,
+                       reinterpret_cast< SQLPOINTER* >(ROW_ARRAY_SIZE), 0);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLSetStmtAttr(stmt, SQL_ATTR_ROW_STATUS_PTR, RowStatus, 0);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLSetStmtAttr(stmt, SQL_ATTR_ROWS_FETCHED_PTR, &NumRowsFetched, 0);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  // Bind only some of the columns.
+
+  SQLINTEGER i32Fields[ROW_ARRAY_SIZE] = {0};
+  SQLLEN i32FieldsInd[ROW_ARRAY_SIZE];
+
+  SQLWCHAR strFields[ROW_ARRAY_SIZE][BUFFER_SIZE];
+  SQLLEN strFieldsLen[ROW_ARRAY_SIZE];
+
+  ret = SQLBindCol(stmt, 2, SQL_C_LONG, i32Fields, 0, i32FieldsInd);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLBindCol(stmt, 6, SQL_C_WCHAR, strFields,
+                   BUFFER_SIZE * sizeof(SQLWCHAR), strFieldsLen);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  std::vector< SQLWCHAR > sql = utility::ToWCHARVector(
+      "SELECT "
+      "  queries_test_006__id, fieldInt, fieldLong, fieldDecimal128, "
+      "  fieldDouble, fieldString "
+      " FROM queries_test_006 "
+      " ORDER BY queries_test_006__id");
+
+  ret = SQLExecDirect(stmt, sql.data(), SQL_NTS);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLFetchScroll(stmt, SQL_FETCH_NEXT, 0);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  BOOST_CHECK_EQUAL(NumRowsFetched, (SQLUINTEGER)ROWS_COUNT);
+
+  for (int64_t i = 0; i < NumRowsFetched; i++) {
+    BOOST_TEST_CONTEXT("Test idx: " << i) {
+      BOOST_CHECK(RowStatus[i] == SQL_ROW_SUCCESS
+                  || RowStatus[i] == SQL_ROW_SUCCESS_WITH_INFO);
+      BOOST_CHECK(i32FieldsInd[i] != SQL_NULL_DATA);
+      BOOST_CHECK(strFieldsLen[i] != SQL_NULL_DATA);
+
+      CheckTestI32Value(static_cast< int >(i),
+                        static_cast< int32_t >(i32Fields[i]));
+      CheckTestStringValue(static_cast< int >(i),
+                           utility::SqlWcharToString(&strFields[i][0]));
+    }
+  }
+
+  for (int64_t i = NumRowsFetched; i < ROW_ARRAY_SIZE; i++) {
+    BOOST_TEST_INFO("Checking row status for row: " << i);
+    BOOST_CHECK(RowStatus[i] == SQL_ROW_NOROW);
+  }
+
+  ret = SQLFetchScroll(stmt, SQL_FETCH_NEXT, 0);
+  BOOST_CHECK_EQUAL(ret, SQL_NO_DATA);
+  BOOST_CHECK_EQUAL(NumRowsFetched, (SQLUINTEGER)0);
+
+  ret = SQLCloseCursor(stmt);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+}
+
+BOOST_AUTO_TEST_CASE(TestCursorBindingColumnWisePrefetch) {
+  enum { ROWS_COUNT = 16 };
+  enum { ROW_ARRAY_SIZE = 5 };
+
+  // Small batches so that the worker has to read ahead several batches.
+  std::string connectionStr;
+  CreateDsnConnectionStringForLocalServer(
+      connectionStr, "", "", "PREFETCH_BATCHES=2;DEFAULT_FETCH_SIZE=3;");
+  Connect(connectionStr);
+
+  SQLUSMALLINT RowStatus[ROW_ARRAY_SIZE];
+  SQLUINTEGER NumRowsFetched;
+
+  SQLRETURN ret;
+
+  ret = SQLSetStmtAttr(stmt, SQL_ATTR_ROW_ARRAY_SIZE,
+                       reinterpret_cast< SQLPOINTER* >(ROW_ARRAY_SIZE), 0);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLSetStmtAttr(stmt, SQL_ATTR_ROW_STATUS_PTR, RowStatus, 0);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLSetStmtAttr(stmt, SQL_ATTR_ROWS_FETCHED_PTR, &NumRowsFetched, 0);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  SQLULEN prefetchBatches = 0;
+  ret = SQLGetStmtAttr(stmt, SQL_ATTR_DOCUMENTDB_PREFETCH_BATCHES,
+                       &prefetchBatches, 0, nullptr);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+  BOOST_CHECK_EQUAL(prefetchBatches, 2);
+
+  SQLINTEGER i32Fields[ROW_ARRAY_SIZE] = {0};
+  SQLLEN i32FieldsInd[ROW_ARRAY_SIZE];
+
+  ret = SQLBindCol(stmt, 2, SQL_C_LONG, i32Fields, 0, i32FieldsInd);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  std::vector< SQLWCHAR > sql = utility::ToWCHARVector(
+      "SELECT queries_test_006__id, fieldInt FROM queries_test_006 "
+      " ORDER BY queries_test_006__id");
+
+  ret = SQLExecDirect(stmt, sql.data(), SQL_NTS);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  int rowIdx = 0;
+  while ((ret = SQLFetchScroll(stmt, SQL_FETCH_NEXT, 0)) != SQL_NO_DATA) {
+    ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    for (SQLUINTEGER i = 0; i < NumRowsFetched; i++, rowIdx++) {
+      BOOST_TEST_CONTEXT("Test idx: " << rowIdx) {
+        BOOST_CHECK(RowStatus[i] == SQL_ROW_SUCCESS);
+        BOOST_CHECK(i32FieldsInd[i] != SQL_NULL_DATA);
+
+        CheckTestI32Value(rowIdx, static_cast< int32_t >(i32Fields[i]));
+      }
+    }
+  }
+
+  BOOST_CHECK_EQUAL(rowIdx, ROWS_COUNT);
+
+  ret = SQLCloseCursor(stmt);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+}
+
+BOOST_AUTO_TEST_CASE(TestCursorPrefetchCancelAndClose) {
+  enum { ROWS_COUNT = 16 };
+
+  std::string connectionStr;
+  CreateDsnConnectionStringForLocalServer(connectionStr, "", "",
+                                          "DEFAULT_FETCH_SIZE=2;");
+  Connect(connectionStr);
+
+  SQLRETURN ret;
+
+  // Prefetching is enabled on the statement only.
+  ret = SQLSetStmtAttr(stmt, SQL_ATTR_DOCUMENTDB_PREFETCH_BATCHES,
+                       reinterpret_cast< SQLPOINTER >(4), 0);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  SQLINTEGER i32Field = 0;
+  SQLLEN i32FieldInd = 0;
+
+  ret = SQLBindCol(stmt, 2, SQL_C_LONG, &i32Field, 0, &i32FieldInd);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  std::vector< SQLWCHAR > sql = utility::ToWCHARVector(
+      "SELECT queries_test_006__id, fieldInt FROM queries_test_006 "
+      " ORDER BY queries_test_006__id");
+
+  // Close the cursor while the worker is still reading ahead.
+  ret = SQLExecDirect(stmt, sql.data(), SQL_NTS);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLFetch(stmt);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+  CheckTestI32Value(0, static_cast< int32_t >(i32Field));
+
+  ret = SQLCloseCursor(stmt);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  // Cancel the statement in the middle of the result set.
+  ret = SQLExecDirect(stmt, sql.data(), SQL_NTS);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLFetch(stmt);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+  CheckTestI32Value(0, static_cast< int32_t >(i32Field));
+
+  ret = SQLCancel(stmt);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
 
+  ret = SQLFetch(stmt);
   BOOST_CHECK_EQUAL(ret, SQL_ERROR);
+  CheckSQLStatementDiagnosticError("HY008");
+
+  ret = SQLCloseCursor(stmt);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  // The statement is usable again after the cancellation.
+  ret = SQLExecDirect(stmt, sql.data(), SQL_NTS);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  int rowIdx = 0;
+  while ((ret = SQLFetch(stmt)) != SQL_NO_DATA) {
+    ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    CheckTestI32Value(rowIdx++, static_cast< int32_t >(i32Field));
+  }
+
+  BOOST_CHECK_EQUAL(rowIdx, ROWS_COUNT);
+}
+
+BOOST_AUTO_TEST_CASE(TestCursorCancelIdleStatement) {
+  enum { ROWS_COUNT = 16 };
+
+  std::string connectionStr;
+  CreateDsnConnectionStringForLocalServer(connectionStr);
+  Connect(connectionStr);
+
+  SQLRETURN ret;
 
-  CheckSQLStatementDiagnosticError("HYC00");
+  // Nothing is processing yet.
+  ret = SQLCancel(stmt);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  SQLINTEGER i32Field = 0;
+  SQLLEN i32FieldInd = 0;
+
+  ret = SQLBindCol(stmt, 2, SQL_C_LONG, &i32Field, 0, &i32FieldInd);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  std::vector< SQLWCHAR > sql = utility::ToWCHARVector(
+      "SELECT queries_test_006__id, fieldInt FROM queries_test_006 "
+      " ORDER BY queries_test_006__id");
+
+  ret = SQLExecDirect(stmt, sql.data(), SQL_NTS);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLFetch(stmt);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+  CheckTestI32Value(0, static_cast< int32_t >(i32Field));
+
+  // No fetch is in progress, so the cancel has no effect.
+  ret = SQLCancel(stmt);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  int rowIdx = 1;
+  while ((ret = SQLFetch(stmt)) != SQL_NO_DATA) {
+    ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    CheckTestI32Value(rowIdx++, static_cast< int32_t >(i32Field));
+  }
+
+  BOOST_CHECK_EQUAL(rowIdx, ROWS_COUNT);
+}
+
+BOOST_AUTO_TEST_CASE(TestCursorBindingRowWise) {
+  enum { ROWS_COUNT = 16 };
+  enum { ROW_ARRAY_SIZE = 10 };
+  enum { BUFFER_SIZE = 64 };
+
+  std::string connectionStr;
+  CreateDsnConnectionStringForLocalServer(connectionStr);
+  Connect(connectionStr);
+
+  /**
+   * Application row structure.
+   */
+  struct Row {
+    SQLWCHAR idField[BUFFER_SIZE];
+    SQLLEN idFieldLen;
+    SQLINTEGER i32Field;
+    SQLLEN i32FieldInd;
+    SQLBIGINT i64Field;
+    SQLLEN i64FieldInd;
+    SQLWCHAR dec128Field[BUFFER_SIZE];
+    SQLLEN dec128FieldLen;
+    SQLDOUBLE doubleField;
+    SQLLEN doubleFieldInd;
+    SQLWCHAR strField[BUFFER_SIZE];
+    SQLLEN strFieldLen;
+    bool boolField;
+    SQLLEN boolFieldInd;
+    SQL_DATE_STRUCT dateField;
+    SQLLEN dateFieldInd;
+    SQL_TIME_STRUCT nullField;
+    SQLLEN nullFieldLen;
+    SQLSCHAR binaryField[BUFFER_SIZE];
+    SQLLEN binaryFieldLen;
+  };
+
+  // Setting attributes.
+
+  Row rows[ROW_ARRAY_SIZE];
+  SQLUSMALLINT RowStatus[ROW_ARRAY_SIZE];
+  SQLUINTEGER NumRowsFetched;
+
+  SQLRETURN ret;
+
+  ret = SQLSetStmtAttr(stmt, SQL_ATTR_ROW_BIND_TYPE,
+                       reinterpret_cast< SQLPOINTER >(sizeof(Row)), 0);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  SQLULEN bindType = 0;
+  ret = SQLGetStmtAttr(stmt, SQL_ATTR_ROW_BIND_TYPE, &bindType, 0, nullptr);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+  BOOST_CHECK_EQUAL(bindType, sizeof(Row));
+
+  ret = SQLSetStmtAttr(stmt, SQL_ATTR_ROW_ARRAY_SIZE,
+                       reinterpret_cast< SQLPOINTER* >(ROW_ARRAY_SIZE), 0);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLSetStmtAttr(stmt, SQL_ATTR_ROW_STATUS_PTR, RowStatus, 0);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLSetStmtAttr(stmt, SQL_ATTR_ROWS_FETCHED_PTR, &NumRowsFetched, 0);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  // Binding collumns to the fields of the first row.
+
+  ret = SQLBindCol(stmt, 1, SQL_C_WCHAR, rows[0].idField,
+                   BUFFER_SIZE * sizeof(SQLWCHAR), &rows[0].idFieldLen);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLBindCol(stmt, 2, SQL_C_LONG, &rows[0].i32Field, 0,
+                   &rows[0].i32FieldInd);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLBindCol(stmt, 3, SQL_C_SBIGINT, &rows[0].i64Field, 0,
+                   &rows[0].i64FieldInd);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLBindCol(stmt, 4, SQL_C_WCHAR, rows[0].dec128Field,
+                   BUFFER_SIZE * sizeof(SQLWCHAR), &rows[0].dec128FieldLen);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLBindCol(stmt, 5, SQL_C_DOUBLE, &rows[0].doubleField, 0,
+                   &rows[0].doubleFieldInd);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLBindCol(stmt, 6, SQL_C_WCHAR, rows[0].strField,
+                   BUFFER_SIZE * sizeof(SQLWCHAR), &rows[0].strFieldLen);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLBindCol(stmt, 7, SQL_C_BIT, &rows[0].boolField, 0,
+                   &rows[0].boolFieldInd);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLBindCol(stmt, 8, SQL_C_TYPE_DATE, &rows[0].dateField, 0,
+                   &rows[0].dateFieldInd);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLBindCol(stmt, 9, SQL_C_TYPE_TIME, &rows[0].nullField, 0,
+                   &rows[0].nullFieldLen);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLBindCol(stmt, 10, SQL_C_BINARY, rows[0].binaryField, BUFFER_SIZE,
+                   &rows[0].binaryFieldLen);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  std::vector< SQLWCHAR > sql = utility::ToWCHARVector(
+      "SELECT "
+      "  queries_test_006__id, fieldInt, fieldLong, fieldDecimal128, "
+      "  fieldDouble, fieldString, fieldBoolean, fieldDate, fieldNull, "
+      "  fieldBinary "
+      " FROM queries_test_006 "
+      " ORDER BY queries_test_006__id");
+
+  ret = SQLExecDirect(stmt, sql.data(), SQL_NTS);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  int64_t rowIdx = 0;
+  while (true) {
+    ret = SQLFetchScroll(stmt, SQL_FETCH_NEXT, 0);
+    if (ret == SQL_NO_DATA)
+      break;
+
+    ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    for (int64_t i = 0; i < NumRowsFetched; i++, rowIdx++) {
+      const Row& row = rows[i];
+      BOOST_TEST_CONTEXT("Test idx: " << rowIdx) {
+        BOOST_CHECK(RowStatus[i] == SQL_ROW_SUCCESS
+                    || RowStatus[i] == SQL_ROW_SUCCESS_WITH_INFO);
+
+        BOOST_CHECK(row.idFieldLen != SQL_NULL_DATA);
+        BOOST_CHECK(row.i32FieldInd != SQL_NULL_DATA);
+        BOOST_CHECK(row.i64FieldInd != SQL_NULL_DATA);
+        BOOST_CHECK(row.dec128FieldLen != SQL_NULL_DATA);
+        BOOST_CHECK(row.doubleFieldInd != SQL_NULL_DATA);
+        BOOST_CHECK(row.strFieldLen != SQL_NULL_DATA);
+        BOOST_CHECK(row.boolFieldInd != SQL_NULL_DATA);
+        BOOST_CHECK(row.dateFieldInd != SQL_NULL_DATA);
+        BOOST_CHECK(row.nullFieldLen == SQL_NULL_DATA);
+        BOOST_CHECK(row.binaryFieldLen != SQL_NULL_DATA);
+
+        int testIdx = static_cast< int >(rowIdx);
+        CheckTestIdValue(testIdx, utility::SqlWcharToString(row.idField));
+        CheckTestI32Value(testIdx, static_cast< int32_t >(row.i32Field));
+        CheckTestI64Value(testIdx, static_cast< int64_t >(row.i64Field));
+        CheckTestDec128Value(testIdx,
+                             utility::SqlWcharToString(row.dec128Field));
+        CheckTestDoubleValue(testIdx, static_cast< double >(row.doubleField));
+        CheckTestStringValue(testIdx, utility::SqlWcharToString(row.strField));
+        CheckTestBoolValue(testIdx, row.boolField);
+        CheckTestDateValue(testIdx, row.dateField);
+        CheckTestI8ArrayValue(
+            testIdx, reinterpret_cast< const int8_t* >(row.binaryField),
+            static_cast< SQLLEN >(row.binaryFieldLen));
+      }
+    }
+  }
+
+  BOOST_CHECK_EQUAL(rowIdx, ROWS_COUNT);
+
+  ret = SQLCloseCursor(stmt);
+  ODBC_THROW_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -33,15 +33,19 @@
 #include <documentdb/odbc/jni/documentdb_query_mapping_service.h>
 #include <documentdb/odbc/jni/java.h>
 #include <documentdb/odbc/jni/jdbc_column_metadata.h>
+#include <documentdb/odbc/jni/jvm_prewarm.h>
 #include <documentdb/odbc/jni/result_set.h>
 #include <documentdb/odbc/jni/utils.h>
 #include <sql.h>
 #include <sqlext.h>
 
+#include <algorithm>
 #include <boost/algorithm/string.hpp>
 #include <boost/optional.hpp>
 #include <boost/test/unit_test.hpp>
+#include <chrono>
 #include <regex>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -66,12 +70,14 @@ using documentdb::odbc::jni::DocumentDbDatabaseMetadata;
 using documentdb::odbc::jni::DocumentDbMqlQueryContext;
 using documentdb::odbc::jni::DocumentDbQueryMappingService;
 using documentdb::odbc::jni::JdbcColumnMetadata;
+using documentdb::odbc::jni::JvmPrewarm;
 using documentdb::odbc::jni::ResolveDocumentDbHome;
 using documentdb::odbc::jni::ResultSet;
 using documentdb::odbc::jni::java::BuildJvmOptions;
 using documentdb::odbc::jni::java::JniErrorCode;
 using documentdb::odbc::jni::java::JniErrorInfo;
 using documentdb::odbc::jni::java::JniHandlers;
+using documentdb::odbc::jni::java::JvmSettings;
 
 /**
  * Test setup fixture.
@@ -470,6 +476,46 @@ struct JniTestSuiteFixture : OdbcTestSuite {
 
 BOOST_FIXTURE_TEST_SUITE(JniTestSuite, JniTestSuiteFixture)
 
+BOOST_AUTO_TEST_CASE(TestDriverManagerLoadDrivers) {
+  // Must not block, whether or not the warm-up is enabled.
+  JvmPrewarm::GetInstance().Start();
+  JvmPrewarm::GetInstance().Wait();
+
+  PrepareContext();
+  BOOST_REQUIRE(_ctx.Get() != nullptr);
+
+  JniErrorInfo errInfo;
+  if (_ctx.Get()->DriverManagerLoadDrivers(errInfo)
+      != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
+    BOOST_FAIL(errInfo.errMsg);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestBuildJvmOptionsSettings) {
+  JvmSettings settings;
+  settings.initialHeapSize = 64;
+  settings.maxHeapSize = 512;
+  settings.garbageCollector = "serial";
+  settings.cdsArchive = "documentdb-odbc-test-missing.jsa";
+
+  std::vector< char* > opts;
+  BuildJvmOptions(ResolveDocumentDbHome(), opts, settings);
+
+  std::set< std::string > options(opts.begin(), opts.end());
+  std::for_each(opts.begin(), opts.end(), ReleaseChars);
+
+  BOOST_CHECK(options.count("-Xms64m"));
+  BOOST_CHECK(options.count("-Xmx512m"));
+  BOOST_CHECK(options.count("-XX:+UseSerialGC"));
+  // The archive is missing, so it is recorded instead of mapped.
+  BOOST_CHECK(options.count("-XX:+RecordDynamicDumpInfo"));
+  BOOST_CHECK(options.count("-Ddocumentdb.cds.dumpArchive="
+                            "documentdb-odbc-test-missing.jsa"));
+  BOOST_CHECK(options.count("-XX:+IgnoreUnrecognizedVMOptions"));
+  BOOST_CHECK(!options.count("-XX:SharedArchiveFile="
+                             "documentdb-odbc-test-missing.jsa"));
+}
+
 BOOST_AUTO_TEST_CASE(TestDocumentDbConnectionOpen) {
   PrepareContext();
   BOOST_REQUIRE(_ctx.Get() != nullptr);
@@ -1404,4 +1450,70 @@ BOOST_AUTO_TEST_CASE(TestDocumentDbGetMqlQueryContext) {
   BOOST_CHECK(!queryContext2.IsValid());
 }
 
+BOOST_AUTO_TEST_CASE(TestJniCallOverhead) {
+  PrepareContext();
+  BOOST_REQUIRE(_ctx.Get() != nullptr);
+
+  std::string dsnConnectionString;
+  CreateDsnConnectionStringForLocalServer(dsnConnectionString);
+
+  Configuration config;
+  ConnectionStringParser parser(config);
+  parser.ParseConnectionString(dsnConnectionString, nullptr);
+  JniErrorInfo errInfo;
+  DocumentDbConnection dbConnection(_ctx);
+  if (dbConnection.Open(config, errInfo)
+      != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
+    BOOST_FAIL(errInfo.errMsg);
+  }
+
+  SharedPointer< DatabaseMetaData > databaseMetaData =
+      dbConnection.GetMetaData(errInfo);
+  BOOST_REQUIRE(databaseMetaData.IsValid());
+  boost::optional< std::string > catalog;
+  boost::optional< std::string > schemaPattern;
+  boost::optional< std::vector< std::string > > types;
+  SharedPointer< ResultSet > resultSet = databaseMetaData.Get()->GetTables(
+      catalog, schemaPattern, TABLE_NAME, types, errInfo);
+  BOOST_REQUIRE(resultSet.IsValid());
+  bool hasNext = false;
+  resultSet.Get()->Next(hasNext, errInfo);
+  BOOST_REQUIRE(hasNext);
+
+  // Each call attaches to the JVM and makes one Java call. String getters
+  // also create local references, which must not pile up on this thread.
+  const int iterations = 20000;
+  typedef std::chrono::steady_clock Clock;
+
+  bool isActive = true;
+  Clock::time_point start = Clock::now();
+  for (int i = 0; i < iterations; ++i) {
+    dbConnection.IsSshTunnelActive(isActive, errInfo);
+  }
+  Clock::duration boolCall = Clock::now() - start;
+  BOOST_CHECK(JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS == errInfo.code);
+  BOOST_CHECK(!isActive);
+
+  boost::optional< std::string > value;
+  start = Clock::now();
+  for (int i = 0; i < iterations; ++i) {
+    resultSet.Get()->GetString("TABLE_NAME", value, errInfo);
+  }
+  Clock::duration stringCall = Clock::now() - start;
+  BOOST_CHECK(JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS == errInfo.code);
+  BOOST_REQUIRE(value);
+  BOOST_CHECK_EQUAL(TABLE_NAME, *value);
+
+  BOOST_TEST_MESSAGE(
+      "JNI boolean call: "
+      << std::chrono::duration_cast< std::chrono::nanoseconds >(boolCall)
+                 .count()
+             / iterations
+      << " ns, JNI string call: "
+      << std::chrono::duration_cast< std::chrono::nanoseconds >(stringCall)
+                 .count()
+             / iterations
+      << " ns");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,91 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <documentdb/odbc/common/lru_cache.h>
+
+#include <boost/test/unit_test.hpp>
+#include <string>
+
+using documentdb::odbc::common::LruCache;
+using namespace boost::unit_test;
+
+BOOST_AUTO_TEST_SUITE(LruCacheTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestLruCacheGetPut) {
+  LruCache< std::string, int > cache(2);
+  int value = 0;
+
+  BOOST_CHECK(!cache.Get("a", value));
+
+  cache.Put("a", 1);
+  cache.Put("b", 2);
+
+  BOOST_CHECK(cache.Get("a", value));
+  BOOST_CHECK_EQUAL(1, value);
+  BOOST_CHECK(cache.Get("b", value));
+  BOOST_CHECK_EQUAL(2, value);
+
+  // Replacing keeps the size.
+  cache.Put("b", 3);
+  BOOST_CHECK(cache.Get("b", value));
+  BOOST_CHECK_EQUAL(3, value);
+  BOOST_CHECK_EQUAL(2, cache.GetSize());
+
+  BOOST_CHECK_EQUAL(3, cache.GetHits());
+  BOOST_CHECK_EQUAL(1, cache.GetMisses());
+}
+
+BOOST_AUTO_TEST_CASE(TestLruCacheEviction) {
+  LruCache< std::string, int > cache(2);
+  int value = 0;
+
+  cache.Put("a", 1);
+  cache.Put("b", 2);
+
+  // "a" becomes the most recently used, so "b" is evicted.
+  BOOST_CHECK(cache.Get("a", value));
+  cache.Put("c", 3);
+
+  BOOST_CHECK_EQUAL(2, cache.GetSize());
+  BOOST_CHECK(cache.Get("a", value));
+  BOOST_CHECK(!cache.Get("b", value));
+  BOOST_CHECK(cache.Get("c", value));
+
+  cache.SetCapacity(1);
+  BOOST_CHECK_EQUAL(1, cache.GetSize());
+  BOOST_CHECK(cache.Get("c", value));
+  BOOST_CHECK(!cache.Get("a", value));
+}
+
+BOOST_AUTO_TEST_CASE(TestLruCacheClearAndDisabled) {
+  LruCache< std::string, int > cache(2);
+  int value = 0;
+
+  cache.Put("a", 1);
+  cache.Clear();
+
+  BOOST_CHECK_EQUAL(0, cache.GetSize());
+  BOOST_CHECK(!cache.Get("a", value));
+
+  LruCache< std::string, int > disabled;
+
+  disabled.Put("a", 1);
+  BOOST_CHECK_EQUAL(0, disabled.GetSize());
+  BOOST_CHECK(!disabled.Get("a", value));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
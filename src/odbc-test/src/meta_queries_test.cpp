@@ -24,12 +24,17 @@
 
 #include <algorithm>
 #include <boost/test/unit_test.hpp>
+#include <cstdio>
 #include <string>
 #include <vector>
 
 #include "complex_type.h"
 #include "documentdb/odbc/common/fixed_size_array.h"
+#include "documentdb/odbc/common/platform_utils.h"
+#include "documentdb/odbc/config/configuration.h"
+#include "documentdb/odbc/config/connection_string_parser.h"
 #include "documentdb/odbc/impl/binary/binary_utils.h"
+#include "documentdb/odbc/meta/metadata_cache.h"
 #include "documentdb/odbc/type_traits.h"
 #include "documentdb/odbc/utility.h"
 #include "odbc_test_suite.h"
@@ -43,6 +48,9 @@ using namespace documentdb::odbc::binary;
 using namespace documentdb::odbc::impl::binary;
 using namespace documentdb::odbc::impl::interop;
 using documentdb::odbc::TestType;
+using documentdb::odbc::config::Configuration;
+using documentdb::odbc::config::ConnectionStringParser;
+using documentdb::odbc::meta::MetadataCache;
 
 using namespace boost::unit_test;
 
@@ -1330,6 +1338,72 @@ BOOST_AUTO_TEST_CASE(TestGetDataWithTablesReturnsOne) {
                                      utility::SqlWcharToString(table.data()));
 }
 
+BOOST_AUTO_TEST_CASE(TestGetDataWithTablesFromMetadataCache) {
+  std::vector< SQLWCHAR > empty = {0};
+  std::vector< SQLWCHAR > table = MakeSqlBuffer("meta_queries_test_001");
+
+  std::string dsnConnectionString;
+  CreateDsnConnectionStringForLocalServer(dsnConnectionString);
+
+  Configuration config;
+  ConnectionStringParser parser(config);
+  parser.ParseConnectionString(dsnConnectionString, nullptr);
+  std::string path = MetadataCache::MakePath(
+      ".", MetadataCache::MakeKey(config.GetHostname(), config.GetPort(),
+                                  config.GetDatabase(),
+                                  config.GetSchemaName()));
+  std::remove(path.c_str());
+
+  dsnConnectionString.append("METADATA_CACHE_DIR=.;");
+
+  // The first connection fills the cache, the second one reads it.
+  for (int i = 0; i < 2; ++i) {
+    Connect(dsnConnectionString);
+
+    SQLRETURN ret = SQLTables(stmt, empty.data(), SQL_NTS, nullptr, 0,
+                              table.data(), SQL_NTS, empty.data(), SQL_NTS);
+
+    if (!SQL_SUCCEEDED(ret))
+      BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+
+    CheckSingleRowResultSetWithGetData(stmt, 3, "meta_queries_test_001");
+
+    Disconnect();
+
+    BOOST_CHECK(FileExists(path));
+  }
+
+  std::remove(path.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(TestGetDataWithTablesWithoutNativeCatalog) {
+  std::vector< SQLWCHAR > empty = {0};
+  std::vector< SQLWCHAR > table = MakeSqlBuffer("meta_queries_test_001");
+  std::vector< SQLWCHAR > column = MakeSqlBuffer("meta_queries_test_001__id");
+
+  std::string dsnConnectionString;
+  CreateDsnConnectionStringForLocalServer(dsnConnectionString);
+  dsnConnectionString.append("NATIVE_CATALOG=false;");
+
+  Connect(dsnConnectionString);
+
+  SQLRETURN ret = SQLTables(stmt, empty.data(), SQL_NTS, nullptr, 0,
+                            table.data(), SQL_NTS, empty.data(), SQL_NTS);
+
+  if (!SQL_SUCCEEDED(ret))
+    BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+
+  CheckSingleRowResultSetWithGetData(stmt, 3, "meta_queries_test_001");
+
+  ret = SQLColumns(stmt, empty.data(), SQL_NTS, nullptr, 0, table.data(),
+                   SQL_NTS, column.data(), SQL_NTS);
+
+  if (!SQL_SUCCEEDED(ret))
+    BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+
+  CheckSingleRowResultSetWithGetData(stmt, 4, "meta_queries_test_001__id");
+}
+
 BOOST_AUTO_TEST_CASE(TestGetDataWithTablesReturnsOneFromLocalServer) {
   std::vector< SQLWCHAR > empty = {0};
   std::vector< SQLWCHAR > table = MakeSqlBuffer("meta_queries_test_001");
@@ -0,0 +1,215 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <documentdb/odbc/meta/metadata_cache.h>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/test/unit_test.hpp>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+using documentdb::odbc::meta::ColumnMeta;
+using documentdb::odbc::meta::ColumnMetaVector;
+using documentdb::odbc::meta::MetadataCache;
+using documentdb::odbc::meta::Nullability;
+using documentdb::odbc::meta::TableMeta;
+using documentdb::odbc::meta::TableMetaVector;
+using namespace boost::unit_test;
+
+namespace {
+const std::string CACHE_KEY =
+    MetadataCache::MakeKey("localhost", 27017, "odbc-test", "_default");
+
+const std::string CACHE_PATH = MetadataCache::MakePath(".", CACHE_KEY);
+
+const std::vector< std::string > TABLE_TYPES(1, "TABLE");
+
+/**
+ * Removes the cache file before and after the test.
+ */
+struct MetadataCacheTestSuiteFixture {
+  MetadataCacheTestSuiteFixture() {
+    std::remove(CACHE_PATH.c_str());
+  }
+
+  ~MetadataCacheTestSuiteFixture() {
+    std::remove(CACHE_PATH.c_str());
+  }
+};
+
+void PutTestMetadata(MetadataCache& cache) {
+  TableMetaVector tables;
+  tables.emplace_back(TableMeta("", "odbc-test", "customers", "TABLE"));
+  tables.emplace_back(TableMeta("", "odbc-test", "orders", "TABLE"));
+  cache.PutTables(boost::none, std::string("odbc-test"), "%", TABLE_TYPES,
+                  tables);
+
+  ColumnMetaVector columns;
+  columns.emplace_back(ColumnMeta("odbc-test", "customers", "customers__id",
+                                  12, Nullability::NO_NULL));
+  columns.emplace_back(ColumnMeta("odbc-test", "customers", "name", 12,
+                                  Nullability::NULLABLE));
+  cache.PutColumns(boost::none, std::string("odbc-test"), "customers", "%",
+                   columns);
+}
+}  // namespace
+
+BOOST_FIXTURE_TEST_SUITE(MetadataCacheTestSuite, MetadataCacheTestSuiteFixture)
+
+BOOST_AUTO_TEST_CASE(TestMetadataCacheGetPut) {
+  MetadataCache cache(CACHE_PATH, CACHE_KEY, 3600);
+  TableMetaVector tables;
+  ColumnMetaVector columns;
+
+  BOOST_CHECK(!cache.IsDirty());
+  BOOST_CHECK(!cache.GetTables(boost::none, std::string("odbc-test"), "%",
+                               TABLE_TYPES, tables));
+
+  PutTestMetadata(cache);
+  BOOST_CHECK(cache.IsDirty());
+
+  BOOST_REQUIRE(cache.GetTables(boost::none, std::string("odbc-test"), "%",
+                                TABLE_TYPES, tables));
+  BOOST_REQUIRE_EQUAL(2, tables.size());
+  BOOST_CHECK_EQUAL("orders", *tables[1].GetTableName());
+
+  BOOST_REQUIRE(cache.GetColumns(boost::none, std::string("odbc-test"),
+                                 "customers", "%", columns));
+  BOOST_REQUIRE_EQUAL(2, columns.size());
+  BOOST_CHECK_EQUAL("name", *columns[1].GetColumnName());
+
+  // Unset and empty arguments are different requests.
+  BOOST_CHECK(!cache.GetTables(std::string(), std::string("odbc-test"), "%",
+                               TABLE_TYPES, tables));
+  BOOST_CHECK(!cache.GetTables(boost::none, std::string("odbc-test"), "%",
+                               boost::none, tables));
+  BOOST_CHECK(!cache.GetColumns(boost::none, std::string("odbc-test"),
+                                "customers", "name", columns));
+}
+
+BOOST_AUTO_TEST_CASE(TestMetadataCacheSaveLoad) {
+  MetadataCache cache(CACHE_PATH, CACHE_KEY, 3600);
+  PutTestMetadata(cache);
+
+  BOOST_REQUIRE(cache.Save());
+  BOOST_CHECK(!cache.IsDirty());
+
+  MetadataCache loaded(CACHE_PATH, CACHE_KEY, 3600);
+  BOOST_REQUIRE(loaded.Load());
+  BOOST_CHECK(!loaded.IsDirty());
+
+  TableMetaVector tables;
+  BOOST_REQUIRE(loaded.GetTables(boost::none, std::string("odbc-test"), "%",
+                                 TABLE_TYPES, tables));
+  BOOST_REQUIRE_EQUAL(2, tables.size());
+  BOOST_CHECK_EQUAL("", *tables[0].GetCatalogName());
+  BOOST_CHECK_EQUAL("odbc-test", *tables[0].GetSchemaName());
+  BOOST_CHECK_EQUAL("customers", *tables[0].GetTableName());
+  BOOST_CHECK_EQUAL("TABLE", *tables[0].GetTableType());
+  BOOST_CHECK(!tables[0].GetRemarks());
+
+  ColumnMetaVector columns;
+  BOOST_REQUIRE(loaded.GetColumns(boost::none, std::string("odbc-test"),
+                                  "customers", "%", columns));
+  BOOST_REQUIRE_EQUAL(2, columns.size());
+  BOOST_CHECK(!columns[0].GetCatalogName());
+  BOOST_CHECK_EQUAL("customers__id", *columns[0].GetColumnName());
+  BOOST_CHECK_EQUAL(12, *columns[0].GetDataType());
+  BOOST_CHECK_EQUAL(Nullability::NO_NULL, *columns[0].GetNullability());
+  BOOST_CHECK_EQUAL(-1, *columns[0].GetPrecision());
+  BOOST_CHECK(!columns[0].GetRemarks());
+  BOOST_CHECK_EQUAL(Nullability::NULLABLE, *columns[1].GetNullability());
+}
+
+BOOST_AUTO_TEST_CASE(TestMetadataCacheExpired) {
+  MetadataCache cache(CACHE_PATH, CACHE_KEY, 0);
+  TableMetaVector tables;
+
+  PutTestMetadata(cache);
+  BOOST_CHECK(!cache.GetTables(boost::none, std::string("odbc-test"), "%",
+                               TABLE_TYPES, tables));
+  BOOST_REQUIRE(cache.Save());
+
+  MetadataCache loaded(CACHE_PATH, CACHE_KEY, 0);
+  BOOST_REQUIRE(loaded.Load());
+  BOOST_CHECK(!loaded.GetTables(boost::none, std::string("odbc-test"), "%",
+                                TABLE_TYPES, tables));
+  // The expired entries are removed from the file on the next save.
+  BOOST_CHECK(loaded.IsDirty());
+}
+
+BOOST_AUTO_TEST_CASE(TestMetadataCacheOtherKey) {
+  MetadataCache cache(CACHE_PATH, CACHE_KEY, 3600);
+  PutTestMetadata(cache);
+  BOOST_REQUIRE(cache.Save());
+
+  MetadataCache other(CACHE_PATH, CACHE_KEY + "2", 3600);
+  BOOST_CHECK(!other.Load());
+}
+
+BOOST_AUTO_TEST_CASE(TestMetadataCacheInvalidFile) {
+  MetadataCache cache(CACHE_PATH, CACHE_KEY, 3600);
+  BOOST_CHECK(!cache.Load());
+
+  {
+    std::ofstream file(CACHE_PATH.c_str(), std::ios::binary);
+    file << "not a metadata cache file";
+  }
+  BOOST_CHECK(!cache.Load());
+
+  // Truncated file.
+  PutTestMetadata(cache);
+  BOOST_REQUIRE(cache.Save());
+  std::string content;
+  {
+    std::ifstream file(CACHE_PATH.c_str(), std::ios::binary);
+    content.assign(std::istreambuf_iterator< char >(file),
+                   std::istreambuf_iterator< char >());
+  }
+  {
+    std::ofstream file(CACHE_PATH.c_str(), std::ios::binary);
+    file.write(content.data(), content.size() / 2);
+  }
+
+  MetadataCache truncated(CACHE_PATH, CACHE_KEY, 3600);
+  BOOST_CHECK(!truncated.Load());
+}
+
+BOOST_AUTO_TEST_CASE(TestMetadataCacheClear) {
+  MetadataCache cache(CACHE_PATH, CACHE_KEY, 3600);
+  TableMetaVector tables;
+
+  PutTestMetadata(cache);
+  BOOST_REQUIRE(cache.Save());
+
+  cache.Clear();
+  BOOST_CHECK(cache.IsDirty());
+  BOOST_CHECK(!cache.GetTables(boost::none, std::string("odbc-test"), "%",
+                               TABLE_TYPES, tables));
+}
+
+BOOST_AUTO_TEST_CASE(TestMetadataCacheMakePath) {
+  std::string path = MetadataCache::MakePath(
+      "dir", MetadataCache::MakeKey("host.example.com", 27017, "db", "s/1"));
+
+  BOOST_CHECK(boost::algorithm::starts_with(path, "dir"));
+  BOOST_CHECK(boost::algorithm::ends_with(
+      path, "documentdb-metadata-host.example.com_27017_db_s_1.bin"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
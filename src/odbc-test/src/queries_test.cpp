@@ -24,6 +24,9 @@
 
 #include <algorithm>
 #include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -31,6 +34,8 @@
 #include "documentdb/odbc/binary/binary_object.h"
 #include "documentdb/odbc/common/fixed_size_array.h"
 #include "documentdb/odbc/impl/binary/binary_utils.h"
+#include "documentdb/odbc/sql/sql_select_translator.h"
+#include "documentdb/odbc/system/odbc_constants.h"
 #include "documentdb/odbc/utility.h"
 #include "odbc_test_suite.h"
 #include "test_type.h"
@@ -46,6 +51,8 @@ using namespace documentdb::odbc::impl::interop;
 using namespace boost::unit_test;
 
 using documentdb::odbc::impl::binary::BinaryUtils;
+using documentdb::odbc::SqlSelectCommand;
+using documentdb::odbc::SqlSelectTranslator;
 
 /**
  * Test setup fixture.
@@ -187,6 +194,66 @@ struct QueriesTestSuiteFixture : odbc::OdbcTestSuite {
 
     return res;
   }
+
+  /**
+   * Execute the query and fetch the column names and all values as strings.
+   *
+   * @param query SQL query.
+   * @return Column names, followed by the values of each row. Null values
+   *     are returned as "NULL".
+   */
+  std::vector< std::vector< std::string > > FetchAllAsStrings(
+      const std::string& query) {
+    std::vector< SQLWCHAR > request = MakeSqlBuffer(query);
+
+    SQLRETURN ret = SQLExecDirect(stmt, request.data(), SQL_NTS);
+    if (!SQL_SUCCEEDED(ret))
+      BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt) + ": " + query);
+
+    SQLSMALLINT columnsCnt = 0;
+    ret = SQLNumResultCols(stmt, &columnsCnt);
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    std::vector< std::vector< std::string > > result(1);
+
+    for (SQLUSMALLINT i = 1; i <= columnsCnt; ++i) {
+      SQLWCHAR columnName[ODBC_BUFFER_SIZE];
+      SQLSMALLINT columnNameLen = 0;
+
+      ret = SQLDescribeCol(stmt, i, columnName, ODBC_BUFFER_SIZE,
+                           &columnNameLen, nullptr, nullptr, nullptr, nullptr);
+      ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+      result[0].push_back(
+          utility::SqlWcharToString(columnName, columnNameLen, false));
+    }
+
+    while ((ret = SQLFetch(stmt)) != SQL_NO_DATA) {
+      ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+      std::vector< std::string > row;
+
+      for (SQLUSMALLINT i = 1; i <= columnsCnt; ++i) {
+        SQLWCHAR value[ODBC_BUFFER_SIZE];
+        SQLLEN valueLen = 0;
+
+        ret = SQLGetData(stmt, i, SQL_C_WCHAR, value, sizeof(value),
+                         &valueLen);
+        ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+        row.push_back(valueLen == SQL_NULL_DATA
+                          ? "NULL"
+                          : utility::SqlWcharToString(value, valueLen, true));
+      }
+
+      result.push_back(row);
+    }
+
+    ret = SQLCloseCursor(stmt);
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    return result;
+  }
 };
 
 BOOST_FIXTURE_TEST_SUITE(QueriesTestSuite, QueriesTestSuiteFixture)
@@ -345,6 +412,69 @@ BOOST_AUTO_TEST_CASE(TestSingleResultUsingGetData) {
   BOOST_CHECK_EQUAL(SQL_NO_DATA, ret);
 }
 
+BOOST_AUTO_TEST_CASE(TestSingleResultUsingGetDataInParts) {
+  std::string dsnConnectionString;
+  CreateDsnConnectionStringForLocalServer(dsnConnectionString);
+  Connect(dsnConnectionString);
+  SQLRETURN ret;
+  std::vector< SQLWCHAR > request =
+      MakeSqlBuffer("SELECT * FROM \"queries_test_001\"");
+
+  ret = SQLExecDirect(stmt, request.data(), SQL_NTS);
+  if (!SQL_SUCCEEDED(ret)) {
+    BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+  }
+
+  ret = SQLFetch(stmt);
+  BOOST_CHECK_EQUAL(SQL_SUCCESS, ret);
+
+  // Read "some Text" three characters at a time.
+  SQLCHAR part[4]{};
+  SQLLEN partLen = 0;
+  std::string fieldString;
+  std::vector< SQLLEN > remaining;
+
+  while ((ret = SQLGetData(stmt, 4, SQL_C_CHAR, part, sizeof(part), &partLen))
+         != SQL_NO_DATA) {
+    if (!SQL_SUCCEEDED(ret)) {
+      BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+    }
+    if (ret == SQL_SUCCESS_WITH_INFO) {
+      CheckSQLStatementDiagnosticError("01004");
+    }
+    remaining.push_back(partLen);
+    fieldString.append(reinterpret_cast< char* >(part));
+  }
+  BOOST_CHECK_EQUAL("some Text", fieldString);
+  BOOST_REQUIRE_EQUAL(3, static_cast< int >(remaining.size()));
+  BOOST_CHECK_EQUAL(9, remaining[0]);
+  BOOST_CHECK_EQUAL(6, remaining[1]);
+  BOOST_CHECK_EQUAL(3, remaining[2]);
+
+  // Read the object id as wide characters in parts.
+  SQLWCHAR widePart[5]{};
+  SQLLEN widePartLen = 0;
+  std::string fieldObjectId;
+
+  while ((ret = SQLGetData(stmt, 5, SQL_C_WCHAR, widePart, sizeof(widePart),
+                           &widePartLen))
+         != SQL_NO_DATA) {
+    if (!SQL_SUCCEEDED(ret)) {
+      BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+    }
+    BOOST_CHECK_EQUAL(0, widePartLen % static_cast< SQLLEN >(sizeof(SQLWCHAR)));
+    fieldObjectId.append(utility::SqlWcharToString(widePart, SQL_NTS, false));
+  }
+  BOOST_CHECK_EQUAL("62196dcc4d9189219147513a", fieldObjectId);
+
+  // Null value is returned once.
+  ret = SQLGetData(stmt, 12, SQL_C_CHAR, part, sizeof(part), &partLen);
+  BOOST_CHECK_EQUAL(SQL_SUCCESS, ret);
+  BOOST_CHECK_EQUAL(SQL_NULL_DATA, partLen);
+  ret = SQLGetData(stmt, 12, SQL_C_CHAR, part, sizeof(part), &partLen);
+  BOOST_CHECK_EQUAL(SQL_NO_DATA, ret);
+}
+
 BOOST_AUTO_TEST_CASE(TestSingleResultUsingBindCol) {
   std::string dsnConnectionString;
   CreateDsnConnectionStringForLocalServer(dsnConnectionString);
@@ -833,7 +963,7 @@ BOOST_AUTO_TEST_CASE(TestUnsuporttedQueryParameterAtExecute ) {
 
 }
 
-BOOST_AUTO_TEST_CASE(TestUnsuporttedQueryParameterAtExecDirect ) {
+BOOST_AUTO_TEST_CASE(TestQueryParameterAtExecDirect) {
   connectToLocalServer("odbc-test");
 
   SQLRETURN ret;
@@ -869,7 +999,8 @@ BOOST_AUTO_TEST_CASE(TestUnsuporttedQueryParameterAtExecDirect ) {
 
   ret = SQLExecDirect(stmt, request.data(), SQL_NTS);
 
-  CheckSQLStatementDiagnosticError("HYC00");
+  // The value of the parameter is requested with SQLParamData.
+  BOOST_CHECK_EQUAL(ret, SQL_NEED_DATA);
 }
 
 BOOST_AUTO_TEST_CASE(TestNullFields) {
@@ -961,6 +1092,506 @@ BOOST_AUTO_TEST_CASE(TestNullFields) {
   BOOST_CHECK(ret == SQL_NO_DATA);
 }
 
+BOOST_AUTO_TEST_CASE(TestNativeQueryTranslation) {
+  // The first queries are translated natively, the last ones are not
+  // supported and fall back to the JVM. Both must give the same results
+  // as the translation by the JVM. Queries that only differ by literals
+  // share the translation of their shape.
+  const std::string queries[] = {
+      "SELECT * FROM queries_test_002 ORDER BY queries_test_002__id",
+      "SELECT fieldString, queries_test_002__id FROM \"queries_test_002\" "
+      "ORDER BY queries_test_002__id DESC",
+      "SELECT queries_test_002__id, fieldInt, fieldLong FROM queries_test_002 "
+      "WHERE fieldInt >= 0 AND fieldLong < 9223372036854775 "
+      "ORDER BY queries_test_002__id",
+      "SELECT queries_test_002__id, fieldInt, fieldLong FROM queries_test_002 "
+      "WHERE fieldInt >= 1000 AND fieldLong < 0 "
+      "ORDER BY queries_test_002__id",
+      "SELECT queries_test_002__id, fieldDouble FROM queries_test_002 "
+      "WHERE fieldDouble <> 1.5 ORDER BY queries_test_002__id",
+      "SELECT queries_test_002__id FROM queries_test_002 "
+      "WHERE fieldDecimal128 IS NULL",
+      "SELECT queries_test_002__id FROM queries_test_002 "
+      "WHERE fieldDecimal128 IS NOT NULL AND fieldBoolean = TRUE "
+      "ORDER BY queries_test_002__id",
+      "SELECT queries_test_002__id, fieldString FROM queries_test_002 "
+      "WHERE fieldString <> 'none' ORDER BY queries_test_002__id",
+      "SELECT queries_test_002.fieldString FROM queries_test_002 "
+      "WHERE queries_test_002__id = '62196dcc4d9189219147513a'",
+      "SELECT queries_test_002__id FROM queries_test_002 "
+      "ORDER BY queries_test_002__id LIMIT 2",
+      "SELECT fieldString FROM queries_test_002 ORDER BY fieldString",
+      "SELECT queries_test_002__id FROM queries_test_002 "
+      "WHERE fieldString > 'a' ORDER BY queries_test_002__id",
+      "SELECT COUNT(*) FROM queries_test_002"};
+
+  std::string dsnConnectionString;
+  CreateDsnConnectionStringForLocalServer(dsnConnectionString, "", "",
+                                          "NATIVE_QUERY_TRANSLATION=true;");
+  Connect(dsnConnectionString);
+
+  std::vector< std::vector< std::vector< std::string > > > nativeResults;
+  for (const std::string& query : queries)
+    nativeResults.push_back(FetchAllAsStrings(query));
+
+  Disconnect();
+
+  CreateDsnConnectionStringForLocalServer(dsnConnectionString, "", "",
+                                          "NATIVE_QUERY_TRANSLATION=false;");
+  Connect(dsnConnectionString);
+
+  for (size_t i = 0; i < nativeResults.size(); ++i) {
+    std::vector< std::vector< std::string > > jvmResult =
+        FetchAllAsStrings(queries[i]);
+
+    BOOST_TEST_CONTEXT(queries[i]) {
+      BOOST_REQUIRE_EQUAL(jvmResult.size(), nativeResults[i].size());
+
+      for (size_t row = 0; row < jvmResult.size(); ++row)
+        BOOST_CHECK_EQUAL_COLLECTIONS(
+            jvmResult[row].begin(), jvmResult[row].end(),
+            nativeResults[i][row].begin(), nativeResults[i][row].end());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestNativeQueryTranslationUnsupportedShape) {
+  std::string dsnConnectionString;
+  CreateDsnConnectionStringForLocalServer(dsnConnectionString, "", "",
+                                          "NATIVE_QUERY_TRANSLATION=true;");
+  Connect(dsnConnectionString);
+
+  // String ranges are not translated natively, so the shape of the query
+  // is cached as not supported.
+  const std::string query =
+      "SELECT queries_test_002__id FROM queries_test_002 "
+      "WHERE fieldString > 'a' ORDER BY queries_test_002__id";
+  BOOST_CHECK(!FetchAllAsStrings(query).empty());
+
+  std::shared_ptr< SqlSelectCommand > select =
+      SqlSelectTranslator::Parse(query);
+  BOOST_REQUIRE(select);
+  std::vector< boost::optional< SqlSelectCommand::Literal > > literals;
+  std::string shape = SqlSelectTranslator::Parameterize(*select, literals);
+  BOOST_REQUIRE(!shape.empty());
+
+  // A query with the text of the shape is still translated.
+  std::vector< SQLWCHAR > request = MakeSqlBuffer(shape);
+  SQLRETURN ret = SQLPrepare(stmt, request.data(), SQL_NTS);
+
+  if (!SQL_SUCCEEDED(ret))
+    BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+
+  SQLSMALLINT columnsCnt = 0;
+  ret = SQLNumResultCols(stmt, &columnsCnt);
+
+  if (!SQL_SUCCEEDED(ret))
+    BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+
+  BOOST_CHECK_EQUAL(columnsCnt, 1);
+}
+
+BOOST_AUTO_TEST_CASE(TestAdaptiveFetch) {
+  // A small maximum batch size, so that the result takes several batches.
+  const std::string query =
+      "SELECT * FROM queries_test_006 ORDER BY queries_test_006__id";
+
+  std::string dsnConnectionString;
+  CreateDsnConnectionStringForLocalServer(dsnConnectionString, "", "",
+                                          "DEFAULT_FETCH_SIZE=4;");
+  Connect(dsnConnectionString);
+
+  std::vector< std::vector< std::string > > expected =
+      FetchAllAsStrings(query);
+
+  Disconnect();
+
+  CreateDsnConnectionStringForLocalServer(
+      dsnConnectionString, "", "", "ADAPTIVE_FETCH=true;DEFAULT_FETCH_SIZE=4;");
+  Connect(dsnConnectionString);
+
+  std::vector< std::vector< std::string > > actual = FetchAllAsStrings(query);
+
+  // The first element holds the column names.
+  BOOST_REQUIRE_GT(expected.size(), 5U);
+  BOOST_REQUIRE_EQUAL(actual.size(), expected.size());
+  for (size_t row = 0; row < expected.size(); ++row)
+    BOOST_CHECK_EQUAL_COLLECTIONS(actual[row].begin(), actual[row].end(),
+                                  expected[row].begin(), expected[row].end());
+
+  SQLULEN batches = 0;
+  SQLULEN documents = 0;
+  SQLULEN bytes = 0;
+  SQLULEN batchSize = 0;
+
+  SQLRETURN ret = SQLGetStmtAttr(stmt, SQL_ATTR_DOCUMENTDB_FETCH_BATCHES,
+                                 &batches, 0, nullptr);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLGetStmtAttr(stmt, SQL_ATTR_DOCUMENTDB_FETCH_DOCUMENTS, &documents,
+                       0, nullptr);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLGetStmtAttr(stmt, SQL_ATTR_DOCUMENTDB_FETCH_BYTES, &bytes, 0,
+                       nullptr);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLGetStmtAttr(stmt, SQL_ATTR_DOCUMENTDB_FETCH_BATCH_SIZE, &batchSize,
+                       0, nullptr);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  size_t rows = expected.size() - 1;
+  BOOST_CHECK_EQUAL(documents, rows);
+  BOOST_CHECK_GE(batches, (rows + 3) / 4);
+  BOOST_CHECK_GT(bytes, 0U);
+  BOOST_CHECK_EQUAL(batchSize, 4U);
+
+  // A result closed before its end kills its server cursor, the query can
+  // be run again.
+  std::vector< SQLWCHAR > request = MakeSqlBuffer(query);
+  ret = SQLExecDirect(stmt, request.data(), SQL_NTS);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLFetch(stmt);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLCloseCursor(stmt);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  actual = FetchAllAsStrings(query);
+  BOOST_CHECK_EQUAL(actual.size(), expected.size());
+}
+
+BOOST_AUTO_TEST_CASE(TestPreparedQueryReexecute) {
+  std::string dsnConnectionString;
+  CreateDsnConnectionStringForLocalServer(dsnConnectionString);
+  Connect(dsnConnectionString);
+
+  std::vector< SQLWCHAR > request = MakeSqlBuffer(
+      "SELECT queries_test_002__id FROM queries_test_002 "
+      "ORDER BY queries_test_002__id");
+
+  SQLRETURN ret = SQLPrepare(stmt, request.data(), SQL_NTS);
+
+  if (!SQL_SUCCEEDED(ret))
+    BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+
+  // The pipeline prepared by the first execution is reused by the second
+  // one and rebuilt by the third one for the new timeout.
+  std::vector< int > counts;
+  for (int i = 0; i < 3; ++i) {
+    if (i == 2) {
+      ret = SQLSetStmtAttr(stmt, SQL_ATTR_QUERY_TIMEOUT,
+                           reinterpret_cast< SQLPOINTER >(30), 0);
+
+      if (!SQL_SUCCEEDED(ret))
+        BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+    }
+
+    ret = SQLExecute(stmt);
+
+    if (!SQL_SUCCEEDED(ret))
+      BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+
+    int count = 0;
+    while (SQL_SUCCEEDED(SQLFetch(stmt)))
+      ++count;
+    counts.push_back(count);
+
+    ret = SQLFreeStmt(stmt, SQL_CLOSE);
+
+    if (!SQL_SUCCEEDED(ret))
+      BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+  }
+
+  BOOST_CHECK(counts[0] > 0);
+  BOOST_CHECK_EQUAL(counts[1], counts[0]);
+  BOOST_CHECK_EQUAL(counts[2], counts[0]);
+}
+
+BOOST_AUTO_TEST_CASE(TestPreparedQueryWithParameters) {
+  std::string dsnConnectionString;
+  CreateDsnConnectionStringForLocalServer(dsnConnectionString, "", "",
+                                          "NATIVE_QUERY_TRANSLATION=true;");
+  Connect(dsnConnectionString);
+
+  std::vector< std::vector< std::string > > expected = FetchAllAsStrings(
+      "SELECT queries_test_002__id FROM queries_test_002 "
+      "WHERE fieldInt >= 0 AND fieldString <> 'none' "
+      "ORDER BY queries_test_002__id");
+
+  std::vector< SQLWCHAR > request = MakeSqlBuffer(
+      "SELECT queries_test_002__id FROM queries_test_002 "
+      "WHERE fieldInt >= ? AND fieldString <> ? "
+      "ORDER BY queries_test_002__id");
+
+  SQLRETURN ret = SQLPrepare(stmt, request.data(), SQL_NTS);
+
+  if (!SQL_SUCCEEDED(ret))
+    BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+
+  SQLSMALLINT paramsNum = 0;
+  ret = SQLNumParams(stmt, &paramsNum);
+
+  if (!SQL_SUCCEEDED(ret))
+    BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+
+  BOOST_CHECK_EQUAL(paramsNum, 2);
+
+  SQLINTEGER fieldInt = 0;
+  SQLLEN fieldIntLen = 0;
+  char fieldString[] = "none";
+  SQLLEN fieldStringLen = SQL_NTS;
+
+  ret = SQLBindParameter(stmt, 1, SQL_PARAM_INPUT, SQL_C_SLONG, SQL_INTEGER,
+                         0, 0, &fieldInt, 0, &fieldIntLen);
+
+  if (!SQL_SUCCEEDED(ret))
+    BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+
+  ret = SQLBindParameter(stmt, 2, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_VARCHAR,
+                         sizeof(fieldString), 0, fieldString,
+                         sizeof(fieldString), &fieldStringLen);
+
+  if (!SQL_SUCCEEDED(ret))
+    BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+
+  // The translation is reused, only the values change: all the rows, no
+  // rows for a value that is too large and no rows for a null value.
+  const SQLINTEGER values[] = {0, INT32_MAX, 0};
+  const SQLLEN lens[] = {0, 0, SQL_NULL_DATA};
+  std::vector< size_t > counts;
+  for (int i = 0; i < 3; ++i) {
+    fieldInt = values[i];
+    fieldIntLen = lens[i];
+
+    ret = SQLExecute(stmt);
+
+    if (!SQL_SUCCEEDED(ret))
+      BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+
+    size_t count = 0;
+    while (SQL_SUCCEEDED(SQLFetch(stmt)))
+      ++count;
+    counts.push_back(count);
+
+    ret = SQLFreeStmt(stmt, SQL_CLOSE);
+
+    if (!SQL_SUCCEEDED(ret))
+      BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+  }
+
+  BOOST_CHECK(!expected.empty());
+  BOOST_CHECK_EQUAL(counts[0], expected.size());
+  BOOST_CHECK_EQUAL(counts[1], 0);
+  BOOST_CHECK_EQUAL(counts[2], 0);
+}
+
+BOOST_AUTO_TEST_CASE(TestPreparedQueryWithUnboundParameter) {
+  std::string dsnConnectionString;
+  CreateDsnConnectionStringForLocalServer(dsnConnectionString, "", "",
+                                          "NATIVE_QUERY_TRANSLATION=true;");
+  Connect(dsnConnectionString);
+
+  std::vector< SQLWCHAR > request = MakeSqlBuffer(
+      "SELECT queries_test_002__id FROM queries_test_002 "
+      "WHERE fieldInt >= ?");
+
+  SQLRETURN ret = SQLExecDirect(stmt, request.data(), SQL_NTS);
+
+  BOOST_REQUIRE_EQUAL(ret, SQL_ERROR);
+  BOOST_CHECK_EQUAL("07002", GetOdbcErrorState(SQL_HANDLE_STMT, stmt));
+}
+
+BOOST_AUTO_TEST_CASE(TestDataAtExecParameterUnsupportedType) {
+  std::string dsnConnectionString;
+  CreateDsnConnectionStringForLocalServer(dsnConnectionString, "", "",
+                                          "NATIVE_QUERY_TRANSLATION=true;");
+  Connect(dsnConnectionString);
+
+  std::vector< SQLWCHAR > request = MakeSqlBuffer(
+      "SELECT queries_test_002__id FROM queries_test_002 "
+      "WHERE fieldInt >= ?");
+
+  SQLRETURN ret = SQLPrepare(stmt, request.data(), SQL_NTS);
+
+  if (!SQL_SUCCEEDED(ret))
+    BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+
+  SQLCHAR value[] = {0x01, 0x02, 0x03, 0x04};
+  SQLLEN valueLen = SQL_LEN_DATA_AT_EXEC(sizeof(value));
+
+  ret = SQLBindParameter(stmt, 1, SQL_PARAM_INPUT, SQL_C_BINARY,
+                         SQL_VARBINARY, sizeof(value), 0,
+                         reinterpret_cast< SQLPOINTER >(1), 0, &valueLen);
+
+  if (!SQL_SUCCEEDED(ret))
+    BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+
+  ret = SQLExecute(stmt);
+
+  BOOST_REQUIRE_EQUAL(ret, SQL_NEED_DATA);
+
+  SQLPOINTER token = nullptr;
+  ret = SQLParamData(stmt, &token);
+
+  BOOST_REQUIRE_EQUAL(ret, SQL_NEED_DATA);
+  BOOST_CHECK_EQUAL(token, reinterpret_cast< SQLPOINTER >(1));
+
+  ret = SQLPutData(stmt, value, sizeof(value));
+
+  if (!SQL_SUCCEEDED(ret))
+    BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+
+  // Binary values cannot be compared with the column, the execution fails.
+  ret = SQLParamData(stmt, &token);
+
+  BOOST_REQUIRE_EQUAL(ret, SQL_ERROR);
+  BOOST_CHECK_EQUAL("07006", GetOdbcErrorState(SQL_HANDLE_STMT, stmt));
+}
+
+BOOST_AUTO_TEST_CASE(TestWideRowUsingBindCol) {
+  enum { FIELDS_CNT = 150 };
+
+  connectToLocalServer("odbc-test");
+
+  SQLRETURN ret;
+
+  // Columns are selected in the reverse order of the document fields.
+  std::string sql = "SELECT ";
+  for (int i = FIELDS_CNT - 1; i >= 0; --i) {
+    std::stringstream field;
+    field << "field" << std::setw(3) << std::setfill('0') << i;
+    sql += field.str() + (i > 0 ? ", " : " ");
+  }
+  sql += "FROM queries_test_007 ORDER BY field000";
+
+  std::vector< int32_t > fields(FIELDS_CNT);
+  std::vector< SQLLEN > fieldLens(FIELDS_CNT);
+
+  for (SQLUSMALLINT i = 0; i < FIELDS_CNT; ++i) {
+    ret = SQLBindCol(stmt, i + 1, SQL_C_SLONG, &fields[i], 0, &fieldLens[i]);
+    if (!SQL_SUCCEEDED(ret))
+      BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+  }
+
+  std::vector< SQLWCHAR > request = MakeSqlBuffer(sql);
+
+  ret = SQLExecDirect(stmt, request.data(), SQL_NTS);
+  if (!SQL_SUCCEEDED(ret))
+    BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+
+  int32_t row = 0;
+  while ((ret = SQLFetch(stmt)) == SQL_SUCCESS) {
+    for (int32_t i = 0; i < FIELDS_CNT; ++i) {
+      int32_t fieldIdx = FIELDS_CNT - 1 - i;
+      BOOST_CHECK_NE(fieldLens[i], SQL_NULL_DATA);
+      BOOST_CHECK_EQUAL(fields[i], row * 1000 + fieldIdx);
+    }
+    ++row;
+  }
+
+  BOOST_CHECK_EQUAL(ret, SQL_NO_DATA);
+  BOOST_CHECK_EQUAL(row, 10);
+}
+
+BOOST_AUTO_TEST_CASE(TestMixedTypeColumnUsingBindCol) {
+  connectToLocalServer("odbc-test");
+
+  SQLRETURN ret;
+
+  double doubleField = 0;
+  SQLLEN doubleFieldLen = 0;
+  SQLBIGINT longField = 0;
+  SQLLEN longFieldLen = 0;
+
+  ret = SQLBindCol(stmt, 1, SQL_C_DOUBLE, &doubleField, 0, &doubleFieldLen);
+  if (!SQL_SUCCEEDED(ret))
+    BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+
+  ret = SQLBindCol(stmt, 2, SQL_C_SBIGINT, &longField, 0, &longFieldLen);
+  if (!SQL_SUCCEEDED(ret))
+    BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+
+  // The BSON type of the field changes from row to row.
+  std::vector< SQLWCHAR > request = MakeSqlBuffer(
+      "SELECT fieldNumber, fieldNumber FROM queries_test_008 "
+      "ORDER BY queries_test_008__id");
+
+  ret = SQLExecDirect(stmt, request.data(), SQL_NTS);
+  if (!SQL_SUCCEEDED(ret))
+    BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+
+  for (int i = 1; i <= 4; ++i) {
+    ret = SQLFetch(stmt);
+    if (!SQL_SUCCEEDED(ret))
+      BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+
+    BOOST_CHECK_EQUAL(doubleFieldLen, sizeof(double));
+    BOOST_CHECK_EQUAL(doubleField, static_cast< double >(i));
+    BOOST_CHECK_EQUAL(longFieldLen, sizeof(SQLBIGINT));
+    BOOST_CHECK_EQUAL(longField, i);
+  }
+
+  ret = SQLFetch(stmt);
+  BOOST_CHECK_EQUAL(ret, SQL_NO_DATA);
+}
+
+// Enable test to measure fetch of the wide rows.
+BOOST_AUTO_TEST_CASE(TestWideRowFetchRepetitive, *disabled()) {
+  enum { FIELDS_CNT = 150 };
+  enum { ROW_ARRAY_SIZE = 10 };
+
+  connectToLocalServer("odbc-test");
+
+  SQLRETURN ret;
+
+  std::string sql = "SELECT ";
+  for (int i = FIELDS_CNT - 1; i >= 0; --i) {
+    std::stringstream field;
+    field << "field" << std::setw(3) << std::setfill('0') << i;
+    sql += field.str() + (i > 0 ? ", " : " ");
+  }
+  sql += "FROM queries_test_007";
+
+  ret = SQLSetStmtAttr(stmt, SQL_ATTR_ROW_ARRAY_SIZE,
+                       reinterpret_cast< SQLPOINTER >(ROW_ARRAY_SIZE), 0);
+  if (!SQL_SUCCEEDED(ret))
+    BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+
+  std::vector< int32_t > fields(FIELDS_CNT * ROW_ARRAY_SIZE);
+  std::vector< SQLLEN > fieldLens(FIELDS_CNT * ROW_ARRAY_SIZE);
+
+  for (SQLUSMALLINT i = 0; i < FIELDS_CNT; ++i) {
+    ret = SQLBindCol(stmt, i + 1, SQL_C_SLONG, &fields[i * ROW_ARRAY_SIZE], 0,
+                     &fieldLens[i * ROW_ARRAY_SIZE]);
+    if (!SQL_SUCCEEDED(ret))
+      BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+  }
+
+  std::vector< SQLWCHAR > request = MakeSqlBuffer(sql);
+
+  std::chrono::nanoseconds fetchTime(0);
+  for (int i = 0; i < 100; i++) {
+    ret = SQLExecDirect(stmt, request.data(), SQL_NTS);
+    if (!SQL_SUCCEEDED(ret))
+      BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+
+    auto t1 = std::chrono::high_resolution_clock::now();
+    while (SQL_SUCCEEDED(ret = SQLFetch(stmt)))
+      ;
+    auto t2 = std::chrono::high_resolution_clock::now();
+    fetchTime += t2 - t1;
+
+    BOOST_CHECK_EQUAL(ret, SQL_NO_DATA);
+
+    ret = SQLFreeStmt(stmt, SQL_CLOSE);
+    if (!SQL_SUCCEEDED(ret))
+      BOOST_FAIL(GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+  }
+  std::cout << fetchTime.count() << " nanoseconds\n";
+}
+
 // Maybe needed for TS
 BOOST_AUTO_TEST_CASE(TestParamsNum, *disabled()) {
   connectToLocalServer("odbc-test");
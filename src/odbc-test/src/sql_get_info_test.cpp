@@ -153,7 +153,7 @@ BOOST_AUTO_TEST_CASE(TestValues) {
 
   CheckStrInfo(SQL_DRIVER_NAME, "Amazon DocumentDB");
   CheckStrInfo(SQL_DBMS_NAME, "Amazon DocumentDB");
-  CheckStrInfo(SQL_DRIVER_ODBC_VER, "03.00");
+  CheckStrInfo(SQL_DRIVER_ODBC_VER, "03.80");
   CheckStrInfo(SQL_DRIVER_VER, Configuration::GetFormatedDriverVersion());
   CheckDbmsVerInfo();
   CheckStrInfo(SQL_COLUMN_ALIAS, "Y");
@@ -0,0 +1,234 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <documentdb/odbc/sql/sql_lexer.h>
+#include <documentdb/odbc/sql/sql_select_command.h>
+#include <documentdb/odbc/sql/sql_select_translator.h>
+
+#include <boost/test/unit_test.hpp>
+#include <string>
+
+using documentdb::odbc::SqlLexer;
+using documentdb::odbc::SqlSelectCommand;
+using documentdb::odbc::SqlSelectTranslator;
+using documentdb::odbc::TokenType;
+using namespace boost::unit_test;
+
+BOOST_AUTO_TEST_SUITE(SqlSelectCommandTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestSqlLexerOperators) {
+  std::string sql = "* = <> != < <= > >= ! / + ?";
+  SqlLexer lexer(sql);
+
+  const TokenType::Type expected[] = {
+      TokenType::ASTERISK,   TokenType::COMPARISON,
+      TokenType::COMPARISON, TokenType::COMPARISON,
+      TokenType::COMPARISON, TokenType::COMPARISON,
+      TokenType::COMPARISON, TokenType::COMPARISON,
+      TokenType::OTHER,      TokenType::OTHER,
+      TokenType::OTHER,      TokenType::PARAMETER_MARKER};
+  const char* values[] = {"*",  "=", "<>", "!=", "<", "<=",
+                          ">", ">=", "!",  "/",  "+", "?"};
+
+  for (size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); ++i) {
+    BOOST_REQUIRE(*lexer.Shift());
+    BOOST_CHECK_EQUAL(expected[i], lexer.GetCurrentToken().GetType());
+    BOOST_CHECK_EQUAL(values[i], lexer.GetCurrentToken().ToString());
+  }
+
+  BOOST_CHECK(!*lexer.Shift());
+}
+
+BOOST_AUTO_TEST_CASE(TestSqlSelectParseAllColumns) {
+  std::shared_ptr< SqlSelectCommand > select =
+      SqlSelectTranslator::Parse("SELECT * FROM \"my\"\"table\";");
+
+  BOOST_REQUIRE(select);
+  BOOST_CHECK(select->IsAllColumns());
+  BOOST_CHECK(select->GetColumns().empty());
+  BOOST_CHECK(select->GetSchema().empty());
+  BOOST_CHECK_EQUAL("my\"table", select->GetTable());
+  BOOST_CHECK(select->GetPredicates().empty());
+  BOOST_CHECK(select->GetOrderBy().empty());
+  BOOST_CHECK_EQUAL(-1, select->GetLimit());
+
+  BOOST_CHECK_EQUAL("SELECT * FROM \"my\"\"table\"",
+                    SqlSelectTranslator::GetTableQuery(*select));
+}
+
+BOOST_AUTO_TEST_CASE(TestSqlSelectParseClauses) {
+  std::shared_ptr< SqlSelectCommand > select = SqlSelectTranslator::Parse(
+      "select \"t\".\"a\", b from \"s\".\"t\" "
+      "where a >= -1.5 and b = 'it''s' and t.c is not null and d is null "
+      "order by a desc, b limit 10");
+
+  BOOST_REQUIRE(select);
+  BOOST_CHECK(!select->IsAllColumns());
+  BOOST_REQUIRE_EQUAL(2, select->GetColumns().size());
+  BOOST_CHECK_EQUAL("a", select->GetColumns()[0]);
+  BOOST_CHECK_EQUAL("b", select->GetColumns()[1]);
+  BOOST_CHECK_EQUAL("s", select->GetSchema());
+  BOOST_CHECK_EQUAL("t", select->GetTable());
+
+  const std::vector< SqlSelectCommand::Predicate >& predicates =
+      select->GetPredicates();
+  BOOST_REQUIRE_EQUAL(4, predicates.size());
+
+  BOOST_CHECK_EQUAL("a", predicates[0].column);
+  BOOST_CHECK_EQUAL(SqlSelectCommand::Predicate::GE, predicates[0].op);
+  BOOST_CHECK_EQUAL(SqlSelectCommand::Literal::DECIMAL,
+                    predicates[0].literal.type);
+  BOOST_CHECK_EQUAL("-1.5", predicates[0].literal.value);
+
+  BOOST_CHECK_EQUAL("b", predicates[1].column);
+  BOOST_CHECK_EQUAL(SqlSelectCommand::Predicate::EQ, predicates[1].op);
+  BOOST_CHECK_EQUAL(SqlSelectCommand::Literal::STRING,
+                    predicates[1].literal.type);
+  BOOST_CHECK_EQUAL("it's", predicates[1].literal.value);
+
+  BOOST_CHECK_EQUAL("c", predicates[2].column);
+  BOOST_CHECK_EQUAL(SqlSelectCommand::Predicate::IS_NOT_NULL,
+                    predicates[2].op);
+
+  BOOST_CHECK_EQUAL("d", predicates[3].column);
+  BOOST_CHECK_EQUAL(SqlSelectCommand::Predicate::IS_NULL, predicates[3].op);
+
+  const std::vector< SqlSelectCommand::SortKey >& orderBy =
+      select->GetOrderBy();
+  BOOST_REQUIRE_EQUAL(2, orderBy.size());
+  BOOST_CHECK_EQUAL("a", orderBy[0].column);
+  BOOST_CHECK(!orderBy[0].ascending);
+  BOOST_CHECK_EQUAL("b", orderBy[1].column);
+  BOOST_CHECK(orderBy[1].ascending);
+
+  BOOST_CHECK_EQUAL(10, select->GetLimit());
+
+  BOOST_CHECK_EQUAL("SELECT * FROM \"s\".\"t\"",
+                    SqlSelectTranslator::GetTableQuery(*select));
+}
+
+BOOST_AUTO_TEST_CASE(TestSqlSelectParseParameters) {
+  std::shared_ptr< SqlSelectCommand > select = SqlSelectTranslator::Parse(
+      "SELECT a FROM t WHERE a = ? AND b > 1 AND c <> ?");
+
+  BOOST_REQUIRE(select);
+  BOOST_CHECK_EQUAL(2, select->GetParametersNumber());
+
+  const std::vector< SqlSelectCommand::Predicate >& predicates =
+      select->GetPredicates();
+  BOOST_REQUIRE_EQUAL(3, predicates.size());
+
+  BOOST_CHECK_EQUAL(SqlSelectCommand::Literal::PARAMETER,
+                    predicates[0].literal.type);
+  BOOST_CHECK_EQUAL("1", predicates[0].literal.value);
+
+  BOOST_CHECK_EQUAL(SqlSelectCommand::Literal::INTEGER,
+                    predicates[1].literal.type);
+
+  BOOST_CHECK_EQUAL("c", predicates[2].column);
+  BOOST_CHECK_EQUAL(SqlSelectCommand::Predicate::NE, predicates[2].op);
+  BOOST_CHECK_EQUAL(SqlSelectCommand::Literal::PARAMETER,
+                    predicates[2].literal.type);
+  BOOST_CHECK_EQUAL("2", predicates[2].literal.value);
+}
+
+BOOST_AUTO_TEST_CASE(TestSqlSelectParameterize) {
+  std::shared_ptr< SqlSelectCommand > first = SqlSelectTranslator::Parse(
+      "select a, \"b\" from s.t where a >= -1.5 and b = 'x' "
+      "and c is null order by a desc limit 10");
+  std::shared_ptr< SqlSelectCommand > second = SqlSelectTranslator::Parse(
+      "SELECT a,b FROM s.t WHERE a >= 7 AND b = 'it''s' "
+      "AND c IS NULL ORDER BY a DESC LIMIT 10");
+
+  BOOST_REQUIRE(first);
+  BOOST_REQUIRE(second);
+
+  std::vector< boost::optional< SqlSelectCommand::Literal > > literals;
+  std::string shape = SqlSelectTranslator::Parameterize(*first, literals);
+
+  BOOST_CHECK_EQUAL(
+      "SELECT \"a\", \"b\" FROM \"s\".\"t\" WHERE \"a\" >= ? "
+      "AND \"b\" = ? AND \"c\" IS NULL ORDER BY \"a\" DESC LIMIT 10",
+      shape);
+  BOOST_REQUIRE_EQUAL(2, literals.size());
+  BOOST_CHECK_EQUAL("-1.5", literals[0]->value);
+  BOOST_CHECK_EQUAL(SqlSelectCommand::Literal::STRING, literals[1]->type);
+  BOOST_CHECK_EQUAL("x", literals[1]->value);
+
+  BOOST_CHECK_EQUAL(shape,
+                    SqlSelectTranslator::Parameterize(*second, literals));
+  BOOST_REQUIRE_EQUAL(2, literals.size());
+  BOOST_CHECK_EQUAL("7", literals[0]->value);
+  BOOST_CHECK_EQUAL("it's", literals[1]->value);
+
+  // The statement of the shape is parsed to the same command with markers.
+  std::shared_ptr< SqlSelectCommand > parsed =
+      SqlSelectTranslator::Parse(shape);
+  BOOST_REQUIRE(parsed);
+  BOOST_CHECK_EQUAL(2, parsed->GetParametersNumber());
+  BOOST_CHECK_EQUAL(10, parsed->GetLimit());
+
+  // The row limit is part of the shape.
+  std::shared_ptr< SqlSelectCommand > limit = SqlSelectTranslator::Parse(
+      "SELECT a, b FROM s.t WHERE a >= 7 AND b = 'x' AND c IS NULL "
+      "ORDER BY a DESC LIMIT 5");
+  BOOST_REQUIRE(limit);
+  BOOST_CHECK_NE(shape, SqlSelectTranslator::Parameterize(*limit, literals));
+
+  // Nothing to replace.
+  std::shared_ptr< SqlSelectCommand > noLiterals =
+      SqlSelectTranslator::Parse("SELECT * FROM t WHERE a IS NOT NULL");
+  BOOST_REQUIRE(noLiterals);
+  BOOST_CHECK(SqlSelectTranslator::Parameterize(*noLiterals, literals).empty());
+  BOOST_CHECK(literals.empty());
+
+  std::shared_ptr< SqlSelectCommand > markers =
+      SqlSelectTranslator::Parse("SELECT * FROM t WHERE a = ? AND b = 1");
+  BOOST_REQUIRE(markers);
+  BOOST_CHECK(SqlSelectTranslator::Parameterize(*markers, literals).empty());
+}
+
+BOOST_AUTO_TEST_CASE(TestSqlSelectParseUnsupported) {
+  const char* queries[] = {
+      "SELECT COUNT(*) FROM t",
+      "SELECT a AS b FROM t",
+      "SELECT DISTINCT a FROM t",
+      "SELECT a FROM t1, t2",
+      "SELECT a FROM t JOIN u ON t.a = u.a",
+      "SELECT x.a FROM t",
+      "SELECT a FROM t WHERE a = b",
+      "SELECT a FROM t WHERE ? = a",
+      "SELECT a FROM t LIMIT ?",
+      "SELECT a FROM t WHERE a = 1 OR a = 2",
+      "SELECT a FROM t WHERE a + 1 = 2",
+      "SELECT a FROM t WHERE (a = 1)",
+      "SELECT a FROM t WHERE a = 1 . 5",
+      "SELECT a FROM t WHERE a = 1234567890123456789",
+      "SELECT a FROM t GROUP BY a",
+      "SELECT a FROM t ORDER BY 1",
+      "SELECT a FROM t LIMIT 10 OFFSET 5",
+      "SELECT a FROM t; SELECT b FROM t",
+      "SELECT a FROM t WHERE a = 'unterminated",
+      "SET STREAMING ON",
+      "SELECT a FROM",
+      ""};
+
+  for (const char* query : queries)
+    BOOST_CHECK_MESSAGE(!SqlSelectTranslator::Parse(query), query);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -15,12 +15,14 @@
  * limitations under the License.
  */
 
+#include <documentdb/odbc/common/number_parser.h>
 #include <documentdb/odbc/common/utils.h>
 #include <documentdb/odbc/impl/binary/binary_writer_impl.h>
 #include <documentdb/odbc/utility.h>
 
 #include <boost/test/unit_test.hpp>
 #include <chrono>
+#include <limits>
 #include <stdio.h>
 
 using namespace documentdb::odbc;
@@ -274,4 +276,137 @@ BOOST_AUTO_TEST_CASE(TestUtilityWriteReadDecimal) {
   CheckDecimalWriteRead("-0.34729864879625196");
 }
 
+/**
+ * Make finite decimal128 value in binary integer decimal encoding.
+ */
+void MakeDecimal128(bool negative, uint64_t coefficient, int32_t exponent,
+                    uint64_t& high, uint64_t& low) {
+  high = (static_cast< uint64_t >(negative) << 63)
+         | (static_cast< uint64_t >(exponent + 6176) << 49);
+  low = coefficient;
+}
+
+BOOST_AUTO_TEST_CASE(TestUtilityParseInt64) {
+  int64_t value = 0;
+
+  std::string str("42");
+  BOOST_CHECK(common::ParseInt64(str.data(), str.size(), value));
+  BOOST_CHECK_EQUAL(value, 42);
+
+  // Parsing stops at the first non-digit, like std::stoll.
+  str = "  -17.9";
+  BOOST_CHECK(common::ParseInt64(str.data(), str.size(), value));
+  BOOST_CHECK_EQUAL(value, -17);
+
+  str = "0x1F";
+  BOOST_CHECK(common::ParseInt64(str.data(), str.size(), value));
+  BOOST_CHECK_EQUAL(value, 31);
+
+  str = "-9223372036854775808";
+  BOOST_CHECK(common::ParseInt64(str.data(), str.size(), value));
+  BOOST_CHECK_EQUAL(value, INT64_MIN);
+
+  // Only the given length is parsed.
+  str = "12345";
+  BOOST_CHECK(common::ParseInt64(str.data(), 2, value));
+  BOOST_CHECK_EQUAL(value, 12);
+
+  str = "9223372036854775808";
+  BOOST_CHECK(!common::ParseInt64(str.data(), str.size(), value));
+  str = "abc";
+  BOOST_CHECK(!common::ParseInt64(str.data(), str.size(), value));
+  str = "-";
+  BOOST_CHECK(!common::ParseInt64(str.data(), str.size(), value));
+  BOOST_CHECK(!common::ParseInt64(str.data(), 0, value));
+}
+
+BOOST_AUTO_TEST_CASE(TestUtilityParseReal) {
+  double dblValue = 0;
+  float fltValue = 0;
+
+  std::string str("1.5e3xyz");
+  BOOST_CHECK(common::ParseDouble(str.data(), 5, dblValue));
+  BOOST_CHECK_EQUAL(dblValue, 1500.0);
+  BOOST_CHECK(common::ParseFloat(str.data(), 3, fltValue));
+  BOOST_CHECK_EQUAL(fltValue, 1.5f);
+
+  str = "1e999";
+  BOOST_CHECK(!common::ParseDouble(str.data(), str.size(), dblValue));
+  str = "1e39";
+  BOOST_CHECK(!common::ParseFloat(str.data(), str.size(), fltValue));
+  str = "abc";
+  BOOST_CHECK(!common::ParseDouble(str.data(), str.size(), dblValue));
+  BOOST_CHECK(!common::ParseFloat(str.data(), str.size(), fltValue));
+
+  // Long strings take the allocating path.
+  str = std::string(100, ' ') + "2.25";
+  BOOST_CHECK(common::ParseDouble(str.data(), str.size(), dblValue));
+  BOOST_CHECK_EQUAL(dblValue, 2.25);
+}
+
+BOOST_AUTO_TEST_CASE(TestUtilityDecimal128ToInt64) {
+  uint64_t high = 0;
+  uint64_t low = 0;
+  int64_t value = 0;
+
+  // 123.45
+  MakeDecimal128(false, 12345, -2, high, low);
+  BOOST_CHECK(common::Decimal128ToInt64(high, low, value));
+  BOOST_CHECK_EQUAL(value, 123);
+
+  // -15E+2
+  MakeDecimal128(true, 15, 2, high, low);
+  BOOST_CHECK(common::Decimal128ToInt64(high, low, value));
+  BOOST_CHECK_EQUAL(value, -1500);
+
+  // 0E+6000
+  MakeDecimal128(false, 0, 6000, high, low);
+  BOOST_CHECK(common::Decimal128ToInt64(high, low, value));
+  BOOST_CHECK_EQUAL(value, 0);
+
+  // -9223372036854775808
+  MakeDecimal128(true, 9223372036854775808ULL, 0, high, low);
+  BOOST_CHECK(common::Decimal128ToInt64(high, low, value));
+  BOOST_CHECK_EQUAL(value, INT64_MIN);
+
+  // 1E+30
+  MakeDecimal128(false, 1, 30, high, low);
+  BOOST_CHECK(!common::Decimal128ToInt64(high, low, value));
+
+  // 9223372036854775808
+  MakeDecimal128(false, 9223372036854775808ULL, 0, high, low);
+  BOOST_CHECK(!common::Decimal128ToInt64(high, low, value));
+
+  // NaN and infinity
+  BOOST_CHECK(!common::Decimal128ToInt64(0x7C00000000000000ULL, 0, value));
+  BOOST_CHECK(!common::Decimal128ToInt64(0x7800000000000000ULL, 0, value));
+}
+
+BOOST_AUTO_TEST_CASE(TestUtilityDecimal128ToDouble) {
+  uint64_t high = 0;
+  uint64_t low = 0;
+  double value = 0;
+
+  // 123.45
+  MakeDecimal128(false, 12345, -2, high, low);
+  BOOST_CHECK(common::Decimal128ToDouble(high, low, value));
+  BOOST_CHECK_EQUAL(value, 123.45);
+
+  // -15E+2
+  MakeDecimal128(true, 15, 2, high, low);
+  BOOST_CHECK(common::Decimal128ToDouble(high, low, value));
+  BOOST_CHECK_EQUAL(value, -1500.0);
+
+  BOOST_CHECK(common::Decimal128ToDouble(0x7C00000000000000ULL, 0, value));
+  BOOST_CHECK(value != value);
+  BOOST_CHECK(common::Decimal128ToDouble(0xF800000000000000ULL, 0, value));
+  BOOST_CHECK_EQUAL(value, -std::numeric_limits< double >::infinity());
+
+  // Needs a correctly rounded conversion.
+  MakeDecimal128(false, 1, 30, high, low);
+  BOOST_CHECK(!common::Decimal128ToDouble(high, low, value));
+  MakeDecimal128(false, 12345678901234567ULL, -3, high, low);
+  BOOST_CHECK(!common::Decimal128ToDouble(high, low, value));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
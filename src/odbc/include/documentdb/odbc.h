@@ -54,6 +54,8 @@ SQLRETURN SQLFreeStmt(SQLHSTMT stmt, SQLUSMALLINT option);
 
 SQLRETURN SQLCloseCursor(SQLHSTMT stmt);
 
+SQLRETURN SQLCancel(SQLHSTMT stmt);
+
 SQLRETURN SQLDriverConnect(SQLHDBC conn, SQLHWND windowHandle,
                            SQLWCHAR* inConnectionString,
                            SQLSMALLINT inConnectionStringLen,
@@ -0,0 +1,123 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _DOCUMENTDB_ODBC_ADAPTIVE_BATCH_SIZE
+#define _DOCUMENTDB_ODBC_ADAPTIVE_BATCH_SIZE
+
+#include <stdint.h>
+
+namespace documentdb {
+namespace odbc {
+/**
+ * Chooses the number of documents to request in each batch of a result.
+ *
+ * The first batch is kept small so the first rows arrive quickly. Each
+ * following batch grows geometrically, or at once to the number of documents
+ * that the measured throughput delivers within the target batch time if that
+ * is more. The throughput never makes a batch smaller, as on a high latency
+ * link every batch is slow whatever its size. Batches are bounded by the
+ * maximum batch size and by the memory budget divided by the observed
+ * average document size. Batch sizes are rounded to a multiple of the
+ * application row array size so row sets do not straddle batch boundaries.
+ */
+class AdaptiveBatchSize {
+ public:
+  /** Number of documents requested in the first batch. */
+  enum { FIRST_BATCH_SIZE = 64 };
+
+  /** Growth factor between two consecutive batches. */
+  enum { GROWTH_FACTOR = 4 };
+
+  /** Target time to fetch a single batch in microseconds. */
+  enum { TARGET_BATCH_TIME_US = 500000 };
+
+  /**
+   * Constructor.
+   *
+   * @param maxBatchSize Maximum number of documents in a batch.
+   * @param memoryBudget Maximum size of a batch in bytes.
+   * @param rowArraySize Application row array size.
+   */
+  AdaptiveBatchSize(int32_t maxBatchSize, int64_t memoryBudget,
+                    int64_t rowArraySize);
+
+  /**
+   * Get the size of the first batch.
+   *
+   * @return Number of documents to request in the first batch.
+   */
+  int32_t GetFirstBatchSize() const;
+
+  /**
+   * Account a received batch and get the size of the next one.
+   *
+   * @param documents Number of documents in the received batch.
+   * @param bytes Size of the received batch in bytes.
+   * @param elapsedUs Time taken to fetch the received batch in
+   *     microseconds.
+   * @return Number of documents to request in the next batch.
+   */
+  int32_t GetNextBatchSize(int64_t documents, int64_t bytes,
+                           int64_t elapsedUs);
+
+  /**
+   * Get the last chosen batch size.
+   *
+   * @return Number of documents requested in the last batch.
+   */
+  int32_t GetBatchSize() const {
+    return batchSize_;
+  }
+
+  /**
+   * Get the average document size observed so far.
+   *
+   * @return Average document size in bytes. Zero if nothing was received.
+   */
+  int64_t GetAverageDocumentSize() const {
+    return avgDocumentSize_;
+  }
+
+ private:
+  /**
+   * Round the batch size to the row array size and clamp it to the
+   * allowed range.
+   *
+   * @param size Batch size.
+   * @return Adjusted batch size.
+   */
+  int32_t Adjust(int64_t size) const;
+
+  /** Maximum number of documents in a batch. */
+  int32_t maxBatchSize_;
+
+  /** Maximum size of a batch in bytes. */
+  int64_t memoryBudget_;
+
+  /** Application row array size. */
+  int64_t rowArraySize_;
+
+  /** Last chosen batch size. */
+  int32_t batchSize_;
+
+  /** Average document size in bytes. */
+  int64_t avgDocumentSize_ = 0;
+};
+}  // namespace odbc
+}  // namespace documentdb
+
+#endif  //_DOCUMENTDB_ODBC_ADAPTIVE_BATCH_SIZE
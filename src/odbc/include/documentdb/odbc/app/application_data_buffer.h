@@ -122,6 +122,18 @@ class ApplicationDataBuffer {
     this->elementOffset = idx;
   }
 
+  /**
+   * Set binding type. For row-wise binding it is the size of the
+   * application structure holding one row, so consecutive elements are
+   * that many bytes apart. SQL_BIND_BY_COLUMN (zero) means column-wise
+   * binding, where elements are adjacent.
+   *
+   * @param bindType Binding type.
+   */
+  void SetBindType(SqlUlen bindType) {
+    this->bindType = bindType;
+  }
+
   /**
    * Put in buffer value of type optional int8_t.
    *
@@ -243,6 +255,30 @@ class ApplicationDataBuffer {
    */
   ConversionResult::Type PutString(const std::string& value, int32_t& written);
 
+  /**
+   * Put in buffer value of type string. The value is copied or transcoded
+   * straight from the given memory, which does not need to be
+   * null-terminated.
+   *
+   * @param value UTF-8 string.
+   * @param len String length in bytes.
+   * @return Conversion result.
+   */
+  ConversionResult::Type PutString(const char* value, size_t len);
+
+  /**
+   * Put in buffer value of type string. The value is copied or transcoded
+   * straight from the given memory, which does not need to be
+   * null-terminated.
+   *
+   * @param value UTF-8 string.
+   * @param len String length in bytes.
+   * @param written Number of written characters.
+   * @return Conversion result.
+   */
+  ConversionResult::Type PutString(const char* value, size_t len,
+                                   int32_t& written);
+
   /**
    * Put in buffer value of type GUID.
    *
@@ -262,6 +298,21 @@ class ApplicationDataBuffer {
   ConversionResult::Type PutBinaryData(const void* data, size_t len,
                                        int32_t& written);
 
+  /**
+   * Put next part of already converted data in buffer.
+   *
+   * The length indicator receives the number of bytes remaining, so the
+   * application always gets an exact total rather than SQL_NO_TOTAL.
+   *
+   * @param data Data pointer. Null pointer means nothing is left to write.
+   * @param len Remaining data length in bytes.
+   * @param charSize Size of the null terminator in bytes or zero for binary.
+   * @param written Number of written bytes.
+   * @return Conversion result.
+   */
+  ConversionResult::Type PutDataPart(const void* data, size_t len,
+                                     size_t charSize, size_t& written);
+
   /**
    * Put NULL.
    * @return Conversion result.
@@ -540,9 +591,23 @@ class ApplicationDataBuffer {
    * @param written Number of characters written.
    * @return Conversion result.
    */
-  template < typename OutCharT, typename InCharT >
-  ConversionResult::Type PutStrToStrBuffer(
-      const std::basic_string< InCharT >& value, int32_t& written);
+  template < typename OutCharT >
+  ConversionResult::Type PutStrToStrBuffer(const std::string& value,
+                                           int32_t& written) {
+    return PutStrToStrBuffer< OutCharT >(value.data(), value.size(), written);
+  }
+
+  /**
+   * Put string to string buffer.
+   *
+   * @param value UTF-8 string.
+   * @param len String length in bytes.
+   * @param written Number of characters written.
+   * @return Conversion result.
+   */
+  template < typename OutCharT >
+  ConversionResult::Type PutStrToStrBuffer(const char* value, size_t len,
+                                           int32_t& written);
 
   /**
    * Put raw data to any buffer.
@@ -590,6 +655,9 @@ class ApplicationDataBuffer {
 
   /** Current element offset. */
   SqlUlen elementOffset;
+
+  /** Binding type. Row structure size or zero for column-wise binding. */
+  SqlUlen bindType;
 };
 
 /** Column binging map type alias. */
@@ -93,6 +93,34 @@ class Parameter {
    */
   const ApplicationDataBuffer& GetBuffer() const;
 
+  /**
+   * Get IPD type.
+   *
+   * @return IPD type.
+   */
+  int16_t GetSqlType() const;
+
+  /**
+   * Get IPD column size.
+   *
+   * @return IPD column size.
+   */
+  size_t GetColumnSize() const;
+
+  /**
+   * Check if the value is null.
+   *
+   * @return @c true if the value is null.
+   */
+  bool IsNull() const;
+
+  /**
+   * Get stored at-execution data.
+   *
+   * @return Stored at-execution data.
+   */
+  const std::vector< int8_t >& GetStoredData() const;
+
   /**
    * Reset stored at-execution data.
    */
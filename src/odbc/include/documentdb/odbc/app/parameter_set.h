@@ -98,7 +98,7 @@ class ParameterSet {
    *
    * @return Parameter binding offset pointer.
    */
-  int* GetParamBindOffsetPtr();
+  int* GetParamBindOffsetPtr() const;
 
   /**
    * Prepare parameters set for statement execution.
@@ -158,6 +158,14 @@ class ParameterSet {
    */
   Parameter* GetParameter(uint16_t idx);
 
+  /**
+   * Get parameter by index.
+   *
+   * @param idx Index.
+   * @return Parameter or null, if parameter is not bound.
+   */
+  const Parameter* GetParameter(uint16_t idx) const;
+
   /**
    * Get selected parameter.
    *
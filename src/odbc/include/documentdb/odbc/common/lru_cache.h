@@ -0,0 +1,187 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _DOCUMENTDB_ODBC_COMMON_LRU_CACHE
+#define _DOCUMENTDB_ODBC_COMMON_LRU_CACHE
+
+#include <stdint.h>
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+namespace documentdb {
+namespace odbc {
+namespace common {
+/**
+ * Cache of limited size, evicting the least recently used entry first.
+ *
+ * The cache is not thread safe. Callers shared between threads must
+ * serialize the access.
+ */
+template < typename K, typename V, typename H = std::hash< K > >
+class LruCache {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param capacity Maximum number of entries. Zero disables the cache.
+   */
+  explicit LruCache(size_t capacity = 0)
+      : capacity_(capacity), hits_(0), misses_(0) {
+    // No-op.
+  }
+
+  /**
+   * Find the value and mark it as the most recently used.
+   *
+   * @param key Key.
+   * @param value Found value.
+   * @return @c true if the key is found.
+   */
+  bool Get(const K& key, V& value) {
+    typename Index::iterator it = index_.find(key);
+
+    if (it == index_.end()) {
+      ++misses_;
+
+      return false;
+    }
+
+    entries_.splice(entries_.begin(), entries_, it->second);
+    value = it->second->second;
+    ++hits_;
+
+    return true;
+  }
+
+  /**
+   * Put the value, replacing the value of the same key and evicting the
+   * least recently used entry when the cache is full.
+   *
+   * @param key Key.
+   * @param value Value.
+   */
+  void Put(const K& key, const V& value) {
+    if (capacity_ == 0)
+      return;
+
+    typename Index::iterator it = index_.find(key);
+
+    if (it != index_.end()) {
+      it->second->second = value;
+      entries_.splice(entries_.begin(), entries_, it->second);
+
+      return;
+    }
+
+    while (index_.size() >= capacity_) {
+      index_.erase(entries_.back().first);
+      entries_.pop_back();
+    }
+
+    entries_.push_front(std::make_pair(key, value));
+    index_.insert(std::make_pair(key, entries_.begin()));
+  }
+
+  /**
+   * Remove all entries. Statistics are kept.
+   */
+  void Clear() {
+    index_.clear();
+    entries_.clear();
+  }
+
+  /**
+   * Set maximum number of entries, evicting the least recently used
+   * entries which do not fit.
+   *
+   * @param capacity Maximum number of entries. Zero disables the cache.
+   */
+  void SetCapacity(size_t capacity) {
+    capacity_ = capacity;
+
+    while (index_.size() > capacity_) {
+      index_.erase(entries_.back().first);
+      entries_.pop_back();
+    }
+  }
+
+  /**
+   * Get maximum number of entries.
+   *
+   * @return Capacity.
+   */
+  size_t GetCapacity() const {
+    return capacity_;
+  }
+
+  /**
+   * Get number of entries.
+   *
+   * @return Size.
+   */
+  size_t GetSize() const {
+    return index_.size();
+  }
+
+  /**
+   * Get number of lookups which found the key.
+   *
+   * @return Hits.
+   */
+  uint64_t GetHits() const {
+    return hits_;
+  }
+
+  /**
+   * Get number of lookups which did not find the key.
+   *
+   * @return Misses.
+   */
+  uint64_t GetMisses() const {
+    return misses_;
+  }
+
+ private:
+  /** Entries, the most recently used first. */
+  typedef std::list< std::pair< K, V > > Entries;
+
+  /** Entries by key. */
+  typedef std::unordered_map< K, typename Entries::iterator, H > Index;
+
+  /** Maximum number of entries. */
+  size_t capacity_;
+
+  /** Entries. */
+  Entries entries_;
+
+  /** Index. */
+  Index index_;
+
+  /** Hits. */
+  uint64_t hits_;
+
+  /** Misses. */
+  uint64_t misses_;
+};
+}  // namespace common
+}  // namespace odbc
+}  // namespace documentdb
+
+#endif  // _DOCUMENTDB_ODBC_COMMON_LRU_CACHE
@@ -0,0 +1,95 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _DOCUMENTDB_ODBC_COMMON_NUMBER_PARSER
+#define _DOCUMENTDB_ODBC_COMMON_NUMBER_PARSER
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace documentdb {
+namespace odbc {
+namespace common {
+/**
+ * Parse integer from the string. Follows the rules of std::stoll with base
+ * 0: leading whitespaces are skipped, optional sign and "0x" or "0" prefix
+ * select the base, parsing stops at the first character that is not a
+ * digit. Does not throw and does not allocate.
+ *
+ * @param str String. Does not need to be null-terminated.
+ * @param len String length in bytes.
+ * @param value Parsed value.
+ * @return @c true on success, @c false if the string does not start with
+ *         a number or the number does not fit into int64_t.
+ */
+bool ParseInt64(const char* str, size_t len, int64_t& value);
+
+/**
+ * Parse double from the string. Follows the rules of std::stod. Does not
+ * throw and does not allocate for strings shorter than 64 bytes.
+ *
+ * @param str String. Does not need to be null-terminated.
+ * @param len String length in bytes.
+ * @param value Parsed value.
+ * @return @c true on success, @c false if the string does not start with
+ *         a number or the number is out of range.
+ */
+bool ParseDouble(const char* str, size_t len, double& value);
+
+/**
+ * Parse float from the string. Follows the rules of std::stof. Does not
+ * throw and does not allocate for strings shorter than 64 bytes.
+ *
+ * @param str String. Does not need to be null-terminated.
+ * @param len String length in bytes.
+ * @param value Parsed value.
+ * @return @c true on success, @c false if the string does not start with
+ *         a number or the number is out of range.
+ */
+bool ParseFloat(const char* str, size_t len, float& value);
+
+/**
+ * Convert IEEE 754 decimal128 value in binary integer decimal encoding
+ * (as stored in BSON) to integer. Fractional part is truncated.
+ *
+ * @param high High 64 bits of the value.
+ * @param low Low 64 bits of the value.
+ * @param value Converted value.
+ * @return @c true on success, @c false if the value is NaN, infinity or
+ *         does not fit into int64_t.
+ */
+bool Decimal128ToInt64(uint64_t high, uint64_t low, int64_t& value);
+
+/**
+ * Convert IEEE 754 decimal128 value in binary integer decimal encoding
+ * (as stored in BSON) to double, when it can be done exactly. Covers
+ * values with up to 15 significant digits and small exponents, which is
+ * the case for most of the stored numbers, as well as zero, NaN and
+ * infinity.
+ *
+ * @param high High 64 bits of the value.
+ * @param low Low 64 bits of the value.
+ * @param value Converted value.
+ * @return @c true on success, @c false if the value needs a correctly
+ *         rounded conversion from its string representation.
+ */
+bool Decimal128ToDouble(uint64_t high, uint64_t low, double& value);
+}  // namespace common
+}  // namespace odbc
+}  // namespace documentdb
+
+#endif  //_DOCUMENTDB_ODBC_COMMON_NUMBER_PARSER
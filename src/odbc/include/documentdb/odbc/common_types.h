@@ -75,6 +75,9 @@ struct SqlState {
     /** The numeric or time data returned for a column was truncated. */
     S01S07_FRACTIONAL_TRUNCATION,
 
+    /** The number of parameters does not match the parameter markers. */
+    S07002_COUNT_FIELD_INCORRECT,
+
     /** Restricted data type attribute violation. */
     S07006_RESTRICTION_VIOLATION,
 
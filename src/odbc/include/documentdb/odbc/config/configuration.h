@@ -179,6 +179,51 @@ class Configuration {
 
     /** Default value for defaultFetchSize attribute. */
     static const int32_t defaultFetchSize;
+
+    /** Default value for prefetchBatches attribute. */
+    static const int32_t prefetchBatches;
+
+    /** Default value for prefetchMemoryLimit attribute. */
+    static const int32_t prefetchMemoryLimit;
+
+    /** Default value for adaptiveFetch attribute. */
+    static const bool adaptiveFetch;
+
+    /** Default value for fetchMemoryLimit attribute. */
+    static const int32_t fetchMemoryLimit;
+
+    /** Default value for queryCacheSize attribute. */
+    static const int32_t queryCacheSize;
+
+    /** Default value for nativeQueryTranslation attribute. */
+    static const bool nativeQueryTranslation;
+
+    /** Default value for jvmInitialHeapSize attribute. */
+    static const int32_t jvmInitialHeapSize;
+
+    /** Default value for jvmMaxHeapSize attribute. */
+    static const int32_t jvmMaxHeapSize;
+
+    /** Default value for jvmGarbageCollector attribute. */
+    static const std::string jvmGarbageCollector;
+
+    /** Default value for jvmCdsArchive attribute. */
+    static const std::string jvmCdsArchive;
+
+    /** Default value for metadataCacheDir attribute. */
+    static const std::string metadataCacheDir;
+
+    /** Default value for metadataCacheTtl attribute. */
+    static const int32_t metadataCacheTtl;
+
+    /** Default value for nativeCatalog attribute. */
+    static const bool nativeCatalog;
+
+    /** Default value for maxPoolSize attribute. */
+    static const int32_t maxPoolSize;
+
+    /** Default value for minPoolSize attribute. */
+    static const int32_t minPoolSize;
   };
 
   /**
@@ -801,6 +846,328 @@ class Configuration {
    */
   bool IsDefaultFetchSizeSet() const;
 
+  /**
+   * Get number of batches to prefetch in background.
+   *
+   * @return Number of batches to prefetch. Zero if prefetching is disabled.
+   */
+  int32_t GetPrefetchBatches() const;
+
+  /**
+   * Set number of batches to prefetch in background.
+   *
+   * @param batches Number of batches to prefetch.
+   */
+  void SetPrefetchBatches(int32_t batches);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if the value set.
+   */
+  bool IsPrefetchBatchesSet() const;
+
+  /**
+   * Get prefetch memory limit.
+   *
+   * @return Prefetch memory limit in megabytes.
+   */
+  int32_t GetPrefetchMemoryLimit() const;
+
+  /**
+   * Set prefetch memory limit.
+   *
+   * @param limit Prefetch memory limit in megabytes.
+   */
+  void SetPrefetchMemoryLimit(int32_t limit);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if the value set.
+   */
+  bool IsPrefetchMemoryLimitSet() const;
+
+  /**
+   * Get adaptive fetch flag.
+   *
+   * @return @true if batch sizes are adapted to the result.
+   */
+  bool IsAdaptiveFetch() const;
+
+  /**
+   * Set adaptive fetch flag.
+   *
+   * @param val Adaptive fetch flag.
+   */
+  void SetAdaptiveFetch(bool val);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if the value set.
+   */
+  bool IsAdaptiveFetchSet() const;
+
+  /**
+   * Get fetch memory limit.
+   *
+   * @return Maximum size of a single fetched batch in megabytes.
+   */
+  int32_t GetFetchMemoryLimit() const;
+
+  /**
+   * Set fetch memory limit.
+   *
+   * @param limit Maximum size of a single fetched batch in megabytes.
+   */
+  void SetFetchMemoryLimit(int32_t limit);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if the value set.
+   */
+  bool IsFetchMemoryLimitSet() const;
+
+  /**
+   * Get query cache size.
+   *
+   * @return Maximum number of translated queries cached by the connection.
+   */
+  int32_t GetQueryCacheSize() const;
+
+  /**
+   * Set query cache size.
+   *
+   * @param size Maximum number of translated queries cached by
+   * the connection. Zero disables the cache.
+   */
+  void SetQueryCacheSize(int32_t size);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if the value set.
+   */
+  bool IsQueryCacheSizeSet() const;
+
+  /**
+   * Get native query translation flag.
+   *
+   * @return @c true if simple queries are translated without the JVM.
+   */
+  bool IsNativeQueryTranslation() const;
+
+  /**
+   * Set native query translation flag.
+   *
+   * @param val Translate simple queries without the JVM.
+   */
+  void SetNativeQueryTranslation(bool val);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if the value set.
+   */
+  bool IsNativeQueryTranslationSet() const;
+
+  /**
+   * Get JVM initial heap size.
+   *
+   * @return Initial heap size of the JVM in megabytes.
+   */
+  int32_t GetJvmInitialHeapSize() const;
+
+  /**
+   * Set JVM initial heap size.
+   *
+   * @param size Initial heap size of the JVM in megabytes.
+   */
+  void SetJvmInitialHeapSize(int32_t size);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if the value set.
+   */
+  bool IsJvmInitialHeapSizeSet() const;
+
+  /**
+   * Get JVM maximum heap size.
+   *
+   * @return Maximum heap size of the JVM in megabytes.
+   */
+  int32_t GetJvmMaxHeapSize() const;
+
+  /**
+   * Set JVM maximum heap size.
+   *
+   * @param size Maximum heap size of the JVM in megabytes.
+   */
+  void SetJvmMaxHeapSize(int32_t size);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if the value set.
+   */
+  bool IsJvmMaxHeapSizeSet() const;
+
+  /**
+   * Get JVM garbage collector.
+   *
+   * @return Garbage collector of the JVM: serial, parallel, g1 or empty
+   *     for the default of the JVM.
+   */
+  const std::string& GetJvmGarbageCollector() const;
+
+  /**
+   * Set JVM garbage collector.
+   *
+   * @param gc Garbage collector of the JVM.
+   */
+  void SetJvmGarbageCollector(const std::string& gc);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if the value set.
+   */
+  bool IsJvmGarbageCollectorSet() const;
+
+  /**
+   * Get JVM class data sharing archive.
+   *
+   * @return Path of the class data sharing archive of the JVM or empty
+   *     string if class data sharing is not used.
+   */
+  const std::string& GetJvmCdsArchive() const;
+
+  /**
+   * Set JVM class data sharing archive.
+   *
+   * @param path Path of the class data sharing archive.
+   */
+  void SetJvmCdsArchive(const std::string& path);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if the value set.
+   */
+  bool IsJvmCdsArchiveSet() const;
+
+  /**
+   * Get the directory of the metadata cache files.
+   *
+   * @return Directory of the metadata cache files or empty if the metadata
+   *     cache is disabled.
+   */
+  const std::string& GetMetadataCacheDir() const;
+
+  /**
+   * Set the directory of the metadata cache files.
+   *
+   * @param dir Directory of the metadata cache files.
+   */
+  void SetMetadataCacheDir(const std::string& dir);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if the value set.
+   */
+  bool IsMetadataCacheDirSet() const;
+
+  /**
+   * Get the time to live of the metadata cache entries.
+   *
+   * @return Time to live in seconds.
+   */
+  int32_t GetMetadataCacheTtl() const;
+
+  /**
+   * Set the time to live of the metadata cache entries.
+   *
+   * @param ttl Time to live in seconds.
+   */
+  void SetMetadataCacheTtl(int32_t ttl);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if the value set.
+   */
+  bool IsMetadataCacheTtlSet() const;
+
+  /**
+   * Check whether the catalog functions are served from the native catalog.
+   *
+   * @return @true if the native catalog is enabled.
+   */
+  bool IsNativeCatalog() const;
+
+  /**
+   * Set whether the catalog functions are served from the native catalog.
+   *
+   * @param nativeCatalog Native catalog flag.
+   */
+  void SetNativeCatalog(bool nativeCatalog);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if the value set.
+   */
+  bool IsNativeCatalogSet() const;
+
+  /**
+   * Get maximum client pool size.
+   *
+   * @return Maximum number of clients in the pool shared by the
+   * connections to the same target.
+   */
+  int32_t GetMaxPoolSize() const;
+
+  /**
+   * Set maximum client pool size.
+   *
+   * @param size Maximum number of clients in the pool shared by
+   * the connections to the same target. Zero disables the pool.
+   */
+  void SetMaxPoolSize(int32_t size);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if the value set.
+   */
+  bool IsMaxPoolSizeSet() const;
+
+  /**
+   * Get minimum client pool size.
+   *
+   * @return Number of clients connected when the pool is created.
+   */
+  int32_t GetMinPoolSize() const;
+
+  /**
+   * Set minimum client pool size.
+   *
+   * @param size Number of clients connected when the pool is
+   * created.
+   */
+  void SetMinPoolSize(int32_t size);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if the value set.
+   */
+  bool IsMinPoolSizeSet() const;
+
   /**
    * Get argument map.
    *
@@ -820,6 +1187,15 @@ class Configuration {
    */
   std::string ToJdbcConnectionString() const;
 
+  /**
+   * Formats the JDBC connection string from configuration values.
+   * @param localSSHTunnelPort Local port of an already open SSH tunnel to
+   *     connect through, instead of letting the JDBC driver open its own.
+   *     Zero connects as configured.
+   * @return the JDBC connection string.
+   */
+  std::string ToJdbcConnectionString(int32_t localSSHTunnelPort) const;
+
   /**
    * Formats the MongoDB connection string from configuration values.
    * @return the MongoDB connection string.
@@ -962,6 +1338,56 @@ class Configuration {
 
   /** Default fetch size. */
   SettableValue< int32_t > defaultFetchSize = DefaultValue::defaultFetchSize;
+
+  /** Number of batches to prefetch in background. */
+  SettableValue< int32_t > prefetchBatches = DefaultValue::prefetchBatches;
+
+  /** Prefetch memory limit in megabytes. */
+  SettableValue< int32_t > prefetchMemoryLimit =
+      DefaultValue::prefetchMemoryLimit;
+
+  /** Adaptive fetch flag. */
+  SettableValue< bool > adaptiveFetch = DefaultValue::adaptiveFetch;
+
+  /** Fetch memory limit in megabytes. */
+  SettableValue< int32_t > fetchMemoryLimit = DefaultValue::fetchMemoryLimit;
+
+  /** Maximum number of cached query translations. */
+  SettableValue< int32_t > queryCacheSize = DefaultValue::queryCacheSize;
+
+  /** Native query translation flag. */
+  SettableValue< bool > nativeQueryTranslation =
+      DefaultValue::nativeQueryTranslation;
+
+  /** Initial heap size of the JVM in megabytes. */
+  SettableValue< int32_t > jvmInitialHeapSize =
+      DefaultValue::jvmInitialHeapSize;
+
+  /** Maximum heap size of the JVM in megabytes. */
+  SettableValue< int32_t > jvmMaxHeapSize = DefaultValue::jvmMaxHeapSize;
+
+  /** Garbage collector of the JVM. */
+  SettableValue< std::string > jvmGarbageCollector =
+      DefaultValue::jvmGarbageCollector;
+
+  /** Path of the class data sharing archive of the JVM. */
+  SettableValue< std::string > jvmCdsArchive = DefaultValue::jvmCdsArchive;
+
+  /** Directory of the metadata cache files. */
+  SettableValue< std::string > metadataCacheDir =
+      DefaultValue::metadataCacheDir;
+
+  /** Time to live of the metadata cache entries in seconds. */
+  SettableValue< int32_t > metadataCacheTtl = DefaultValue::metadataCacheTtl;
+
+  /** Serve the catalog functions from the native catalog. */
+  SettableValue< bool > nativeCatalog = DefaultValue::nativeCatalog;
+
+  /** Maximum number of clients in the shared client pool. */
+  SettableValue< int32_t > maxPoolSize = DefaultValue::maxPoolSize;
+
+  /** Number of clients connected when the shared client pool is created. */
+  SettableValue< int32_t > minPoolSize = DefaultValue::minPoolSize;
 };
 
 template <>
@@ -120,6 +120,51 @@ class ConnectionStringParser {
     /** Connection attribute keyword for defaultFetchSize attribute. */
     static const std::string defaultFetchSize;
 
+    /** Connection attribute keyword for prefetchBatches attribute. */
+    static const std::string prefetchBatches;
+
+    /** Connection attribute keyword for prefetchMemoryLimit attribute. */
+    static const std::string prefetchMemoryLimit;
+
+    /** Connection attribute keyword for adaptiveFetch attribute. */
+    static const std::string adaptiveFetch;
+
+    /** Connection attribute keyword for fetchMemoryLimit attribute. */
+    static const std::string fetchMemoryLimit;
+
+    /** Connection attribute keyword for queryCacheSize attribute. */
+    static const std::string queryCacheSize;
+
+    /** Connection attribute keyword for nativeQueryTranslation attribute. */
+    static const std::string nativeQueryTranslation;
+
+    /** Connection attribute keyword for jvmInitialHeapSize attribute. */
+    static const std::string jvmInitialHeapSize;
+
+    /** Connection attribute keyword for jvmMaxHeapSize attribute. */
+    static const std::string jvmMaxHeapSize;
+
+    /** Connection attribute keyword for jvmGarbageCollector attribute. */
+    static const std::string jvmGarbageCollector;
+
+    /** Connection attribute keyword for jvmCdsArchive attribute. */
+    static const std::string jvmCdsArchive;
+
+    /** Connection attribute keyword for metadataCacheDir attribute. */
+    static const std::string metadataCacheDir;
+
+    /** Connection attribute keyword for metadataCacheTtl attribute. */
+    static const std::string metadataCacheTtl;
+
+    /** Connection attribute keyword for nativeCatalog attribute. */
+    static const std::string nativeCatalog;
+
+    /** Connection attribute keyword for maxPoolSize attribute. */
+    static const std::string maxPoolSize;
+
+    /** Connection attribute keyword for minPoolSize attribute. */
+    static const std::string minPoolSize;
+
     /** Connection attribute keyword for sslMode attribute. */
     static const std::string sslMode;
 
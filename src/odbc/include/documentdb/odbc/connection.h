@@ -19,8 +19,10 @@
 #define _DOCUMENTDB_ODBC_CONNECTION
 
 #include <documentdb/odbc/common/concurrent.h>
+#include <documentdb/odbc/common/lru_cache.h>
 #include <stdint.h>
 
+#include <atomic>
 #include <vector>
 
 #include "documentdb/odbc/config/configuration.h"
@@ -31,8 +33,12 @@
 #include "documentdb/odbc/jni/documentdb_connection.h"
 #include "documentdb/odbc/jni/documentdb_connection_properties.h"
 #include "documentdb/odbc/jni/documentdb_database_metadata.h"
+#include "documentdb/odbc/jni/documentdb_mql_query_context.h"
+#include "documentdb/odbc/jni/documentdb_query_mapping_service.h"
 #include "documentdb/odbc/jni/java.h"
 #include "documentdb/odbc/log.h"
+#include "documentdb/odbc/meta/catalog.h"
+#include "documentdb/odbc/meta/metadata_cache.h"
 #include "documentdb/odbc/odbc_error.h"
 #include "documentdb/odbc/parser.h"
 #include "documentdb/odbc/streaming/streaming_context.h"
@@ -43,6 +49,8 @@ using documentdb::odbc::jni::DatabaseMetaData;
 using documentdb::odbc::jni::DocumentDbConnection;
 using documentdb::odbc::jni::DocumentDbConnectionProperties;
 using documentdb::odbc::jni::DocumentDbDatabaseMetadata;
+using documentdb::odbc::jni::DocumentDbMqlQueryContext;
+using documentdb::odbc::jni::DocumentDbQueryMappingService;
 using documentdb::odbc::jni::java::GlobalJObject;
 using documentdb::odbc::jni::java::JniContext;
 
@@ -152,7 +160,33 @@ class Connection : public diagnostic::DiagnosableAdapter {
   SharedPointer< DatabaseMetaData > GetMetaData(DocumentDbError& err);
 
   /**
-   * Gets the DocumentDB database metadata for the connection.
+   * Gets the persistent table and column metadata cache.
+   *
+   * @return Metadata cache or null if the cache is disabled.
+   */
+  meta::MetadataCache* GetMetadataCache() {
+    return metadataCache_.get();
+  }
+
+  /**
+   * Gets the native catalog. The catalog is loaded from the database
+   * metadata on the first call and kept until it is refreshed.
+   *
+   * @param err Error.
+   * @return Catalog or null if the native catalog is disabled or on error.
+   */
+  std::shared_ptr< meta::Catalog > GetCatalog(DocumentDbError& err);
+
+  /**
+   * Drops the native catalog and the persistent metadata cache entries, so
+   * that the catalog is loaded again from the database metadata on the next
+   * catalog function call. Catalogs in use by the statements stay valid.
+   */
+  void RefreshCatalog();
+
+  /**
+   * Gets the DocumentDB database metadata for the connection. The metadata
+   * is read once and kept until the connection is closed.
    *
    * @return SharedPointer to DocumentDbDatabaseMetadata.
    */
@@ -167,6 +201,39 @@ class Connection : public diagnostic::DiagnosableAdapter {
   SharedPointer< DocumentDbConnectionProperties > GetConnectionProperties(
       DocumentDbError& err);
 
+  /**
+   * Translate the SQL query to the MQL query context. Translations are
+   * looked up in the query cache first. Otherwise simple queries are
+   * translated natively, if enabled, and the rest by the query mapping
+   * service of the connection. The result is cached. Simple queries are
+   * cached by their shape, so the ones that only differ by literals share
+   * a translation.
+   *
+   * @param sql SQL query.
+   * @param err Error.
+   * @return Query context or null on error.
+   */
+  SharedPointer< DocumentDbMqlQueryContext > GetMqlQueryContext(
+      const std::string& sql, DocumentDbError& err);
+
+  /**
+   * Release the query mapping service, the database metadata and the query
+   * cache. Translations depend on the schema, so they must be released
+   * when the schema is refreshed.
+   */
+  void ResetQueryMapping();
+
+  /**
+   * Get the generation of the query mapping. It changes every time the
+   * query mapping is reset, so the state derived from the translations must
+   * be rebuilt when it changes.
+   *
+   * @return Query mapping generation.
+   */
+  uint64_t GetQueryMappingGeneration() const {
+    return queryMappingGeneration_;
+  }
+
   /**
    * Get name of the assotiated schema.
    *
@@ -261,9 +328,84 @@ class Connection : public diagnostic::DiagnosableAdapter {
     return mongoClient_;
   }
 
+  /**
+   * Get the lock that serializes the use of the mongo client between
+   * the application thread and the background prefetch workers.
+   *
+   * @return Mongo client lock.
+   */
+  inline common::concurrent::CriticalSection& GetMongoClientLock() {
+    return mongoClientLock_;
+  }
+
  private:
   DOCUMENTDB_NO_COPY_ASSIGNMENT(Connection);
 
+  /**
+   * Get the database metadata, reading it on the first use. Must be called
+   * with the query mapping lock held.
+   *
+   * @param err Error.
+   * @return Database metadata or null on error.
+   */
+  SharedPointer< DocumentDbDatabaseMetadata > InternalGetDatabaseMetadata(
+      DocumentDbError& err);
+
+  /**
+   * Get the query mapping service, creating it on the first use. Must be
+   * called with the query mapping lock held.
+   *
+   * @param err Error.
+   * @return Query mapping service or null on error.
+   */
+  SharedPointer< DocumentDbQueryMappingService > GetQueryMappingService(
+      DocumentDbError& err);
+
+  /**
+   * Translate the SQL query with the query mapping service. Must be called
+   * with the query mapping lock held.
+   *
+   * @param sql SQL query.
+   * @param err Error.
+   * @return Query context or null on error.
+   */
+  SharedPointer< DocumentDbMqlQueryContext > TranslateWithJvm(
+      const std::string& sql, DocumentDbError& err);
+
+  /**
+   * Translate the SQL query without the query mapping service, using the
+   * cached translation of its table. Must be called with the query mapping
+   * lock held.
+   *
+   * @param sql SQL query.
+   * @return Query context or null if the query is not supported.
+   */
+  SharedPointer< DocumentDbMqlQueryContext > TranslateNatively(
+      const std::string& sql);
+
+  /**
+   * Translate the SQL query by its shape. The literals of the predicates
+   * are replaced with parameter markers, the translation of the resulting
+   * query is looked up in the query cache or made natively and cached, and
+   * the literals are bound to it. Must be called with the query mapping
+   * lock held.
+   *
+   * @param sql SQL query.
+   * @return Query context or null if the query has no shape that can be
+   *     translated natively.
+   */
+  SharedPointer< DocumentDbMqlQueryContext > TranslateByShape(
+      const std::string& sql);
+
+  /**
+   * Make the query cache key. Must be called with the query mapping lock held.
+   *
+   * @param sql SQL query.
+   * @param key Query cache key.
+   * @return @c true on success, @c false if the schema can not be identified.
+   */
+  bool MakeMqlQueryCacheKey(const std::string& sql, std::string& key);
+
   /**
    * Init connection socket, using configuration.
    *
@@ -466,7 +608,8 @@ class Connection : public diagnostic::DiagnosableAdapter {
   bool TryRestoreConnection(DocumentDbError& err);
 
   /**
-   * Connect to DocumentDB using Mongo cxx driver
+   * Connect to DocumentDB using Mongo cxx driver. Runs concurrently with the
+   * opening of the JDBC connection.
    *
    * @param localSSHTunnelPort internal SSH tunnel port
    * @param err
@@ -475,22 +618,41 @@ class Connection : public diagnostic::DiagnosableAdapter {
   bool ConnectCPPDocumentDB(int32_t localSSHTunnelPort, DocumentDbError& err);
 
   /**
-   * Helper function to get internall SSH tunnel Port
-   *
-   * @param localSSHTunnelPort internal SSH tunnel port
-   * @param ctx java context
-   * @param err
-   * @return bool
+   * Fetches the server version for SQL_DBMS_VER, if not done yet since the
+   * connection was established.
    */
-  bool GetInternalSSHTunnelPort(int32_t& localSSHTunnelPort,
-                                SharedPointer< jni::java::JniContext > ctx,
-                                DocumentDbError& err);
+  void UpdateDbmsVerInfo();
 
   /**
    * Creates JVM options
    */
   void SetJvmOptions(const std::string& cp);
 
+  /**
+   * Starts dumping the class data sharing archive in the background if the
+   * JVM is recording classes for it and it is missing.
+   */
+  void DumpSharedArchive();
+
+  /**
+   * Opens the metadata cache file if the metadata cache is enabled.
+   */
+  void OpenMetadataCache();
+
+  /**
+   * Saves the changes to the metadata cache file and closes it.
+   */
+  void CloseMetadataCache();
+
+  /**
+   * Loads the native catalog from the metadata cache or the database
+   * metadata.
+   *
+   * @param err Error.
+   * @return Catalog or null on error.
+   */
+  std::shared_ptr< meta::Catalog > LoadCatalog(DocumentDbError& err);
+
   /**
    * Get the singleton instance of the JNI context for the connection.
    *
@@ -503,6 +665,13 @@ class Connection : public diagnostic::DiagnosableAdapter {
    */
   void Deinit();
 
+  /**
+   * Restores the connection attributes to the values they had when the
+   * connection was established, so that the Driver Manager can hand the
+   * connection to another application from its pool.
+   */
+  void ResetConnection();
+
   /**
    * Retrieve timeout from parameter.
    *
@@ -522,6 +691,9 @@ class Connection : public diagnostic::DiagnosableAdapter {
   /** Connection timeout in seconds. */
   int32_t timeout_ = 0;
 
+  /** Login timeout in seconds when the connection was established. */
+  int32_t establishedLoginTimeout_ = 0;
+
   /** Configuration. */
   config::Configuration config_;
 
@@ -535,8 +707,62 @@ class Connection : public diagnostic::DiagnosableAdapter {
 
   std::shared_ptr< mongocxx::client > mongoClient_;
 
+  /** Local port of the shared internal SSH tunnel, if one is used. */
+  std::shared_ptr< const int32_t > sshTunnel_;
+
+  /** Whether SQL_DBMS_VER was fetched. Guarded by the mongo client lock. */
+  bool dbmsVerUpdated_ = false;
+
+  /** Mongo client lock. */
+  common::concurrent::CriticalSection mongoClientLock_;
+
   /** JVM options */
   std::vector< char* > opts_;
+
+  /** Persistent metadata cache. Null if disabled. */
+  std::shared_ptr< meta::MetadataCache > metadataCache_;
+
+  /** Native catalog. Null until the first use. */
+  std::shared_ptr< meta::Catalog > catalog_;
+
+  /** Native catalog lock. */
+  common::concurrent::CriticalSection catalogLock_;
+
+  /** Database metadata. Null until the first use. */
+  SharedPointer< DocumentDbDatabaseMetadata > databaseMetadata_;
+
+  /** Query mapping service. Null until the first use. */
+  SharedPointer< DocumentDbQueryMappingService > queryMappingService_;
+
+  /**
+   * Query cache key prefix identifying the database and the version of
+   * the schema. Empty until the first lookup.
+   */
+  std::string mqlQueryCacheScope_;
+
+  /** Query mapping generation. Incremented when the mapping is reset. */
+  std::atomic< uint64_t > queryMappingGeneration_{0};
+
+  /**
+   * Translations of the SQL queries by scope and SQL text, and of the query
+   * shapes by scope and U+0000 followed by the text of the shape. The shapes
+   * that cannot be translated natively are null.
+   */
+  common::LruCache< std::string, SharedPointer< DocumentDbMqlQueryContext > >
+      mqlQueryCache_;
+
+  /**
+   * Translations of the "SELECT *" queries of the tables by SQL text, used
+   * for the native query translation.
+   */
+  common::LruCache< std::string, SharedPointer< DocumentDbMqlQueryContext > >
+      tableQueryCache_;
+
+  /**
+   * Query mapping lock. Serializes the use of the query mapping service,
+   * the database metadata and the query cache.
+   */
+  common::concurrent::CriticalSection queryMappingLock_;
 };
 }  // namespace odbc
 }  // namespace documentdb
@@ -0,0 +1,245 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _DOCUMENTDB_ODBC_DOCUMENT_SOURCE
+#define _DOCUMENTDB_ODBC_DOCUMENT_SOURCE
+
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include <documentdb/odbc/common/common.h>
+
+#include "documentdb/odbc/adaptive_batch_size.h"
+#include "mongocxx/client.hpp"
+#include "mongocxx/client_session.hpp"
+#include "mongocxx/cursor.hpp"
+#include "mongocxx/database.hpp"
+
+namespace documentdb {
+namespace odbc {
+/**
+ * Statistics of the documents read for a statement. Updated by the thread
+ * reading the documents and can be read from any thread.
+ */
+struct FetchStatistics {
+  /**
+   * Constructor.
+   */
+  FetchStatistics() {
+    Reset();
+  }
+
+  /**
+   * Reset all the counters.
+   */
+  void Reset() {
+    batches = 0;
+    documents = 0;
+    bytes = 0;
+    fetchTimeUs = 0;
+    batchSize = 0;
+  }
+
+  /** Number of batches received. */
+  std::atomic< int64_t > batches;
+
+  /** Number of documents received. */
+  std::atomic< int64_t > documents;
+
+  /** Number of bytes received. */
+  std::atomic< int64_t > bytes;
+
+  /** Total round trip time of the batches in microseconds. */
+  std::atomic< int64_t > fetchTimeUs;
+
+  /** Number of documents requested in the last batch. */
+  std::atomic< int32_t > batchSize;
+
+ private:
+  DOCUMENTDB_NO_COPY_ASSIGNMENT(FetchStatistics);
+};
+
+/**
+ * Source of the documents of a query result.
+ */
+class DocumentSource {
+ public:
+  /**
+   * Destructor.
+   */
+  virtual ~DocumentSource() = default;
+
+  /**
+   * Move to the next document. Can block on a round trip to the server.
+   *
+   * @return False if there are no more documents.
+   */
+  virtual bool Next() = 0;
+
+  /**
+   * Get the current document. The view is valid until the next call
+   * to Next().
+   *
+   * @return Current document.
+   */
+  virtual bsoncxx::document::view Current() const = 0;
+};
+
+/**
+ * Document source reading a mongocxx cursor. All the batches have the
+ * same size.
+ */
+class MongoCursorSource : public DocumentSource {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param cursor Cursor returned by the query/aggregate call.
+   * @param batchSize Batch size the cursor was opened with.
+   * @param stats Statistics to update.
+   */
+  MongoCursorSource(mongocxx::cursor& cursor, int32_t batchSize,
+                    FetchStatistics& stats);
+
+  /**
+   * Destructor.
+   */
+  virtual ~MongoCursorSource() = default;
+
+  virtual bool Next();
+
+  virtual bsoncxx::document::view Current() const;
+
+ private:
+  DOCUMENTDB_NO_COPY_ASSIGNMENT(MongoCursorSource);
+
+  /** The resulting cursor to query/aggregate call */
+  mongocxx::cursor cursor_;
+
+  /** The iterator to the current document */
+  mongocxx::cursor::iterator iterator_;
+
+  /** The iterator to end of cursor */
+  mongocxx::cursor::iterator iteratorEnd_;
+
+  /** Whether the iterator has been started. */
+  bool started_ = false;
+
+  /** Statistics. */
+  FetchStatistics& stats_;
+};
+
+/**
+ * Document source issuing the aggregate and getMore commands itself, so
+ * that every batch can be requested with a different size.
+ */
+class CommandCursorSource : public DocumentSource {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param client Mongo client.
+   * @param databaseName Database name.
+   * @param collectionName Collection name.
+   * @param pipeline Aggregation pipeline.
+   * @param timeout Query timeout in seconds. Zero if none.
+   * @param batchSize Batch size policy.
+   * @param stats Statistics to update.
+   */
+  CommandCursorSource(mongocxx::client& client, const std::string& databaseName,
+                      const std::string& collectionName,
+                      bsoncxx::array::view pipeline, int32_t timeout,
+                      const AdaptiveBatchSize& batchSize,
+                      FetchStatistics& stats);
+
+  /**
+   * Destructor. Kills the server cursor if it is not exhausted.
+   */
+  virtual ~CommandCursorSource();
+
+  virtual bool Next();
+
+  virtual bsoncxx::document::view Current() const;
+
+ private:
+  DOCUMENTDB_NO_COPY_ASSIGNMENT(CommandCursorSource);
+
+  /**
+   * Request the next batch from the server.
+   */
+  void FetchBatch();
+
+  /**
+   * Run a command in the cursor session.
+   *
+   * @param command Command.
+   * @return Command reply.
+   */
+  bsoncxx::document::value RunCommand(bsoncxx::document::view command);
+
+  /** Mongo client. */
+  mongocxx::client& client_;
+
+  /** Database. */
+  mongocxx::database database_;
+
+  /** Collection name. */
+  std::string collectionName_;
+
+  /** Aggregation pipeline. */
+  bsoncxx::array::value pipeline_;
+
+  /** Query timeout in seconds. */
+  int32_t timeout_;
+
+  /** Batch size policy. */
+  AdaptiveBatchSize batchSize_;
+
+  /** Statistics. */
+  FetchStatistics& stats_;
+
+  /**
+   * Session the cursor belongs to. Null if the server does not support
+   * sessions.
+   */
+  std::unique_ptr< mongocxx::client_session > session_{};
+
+  /** Server cursor ID. Zero once the cursor is exhausted. */
+  int64_t cursorId_ = 0;
+
+  /** Whether the aggregate command has been sent. */
+  bool started_ = false;
+
+  /** Reply holding the current batch. */
+  std::unique_ptr< bsoncxx::document::value > reply_{};
+
+  /** Current batch. */
+  bsoncxx::array::view batch_{};
+
+  /** Iterator to the current document of the batch. */
+  bsoncxx::array::view::const_iterator batchIt_{};
+
+  /** Whether the batch iterator points to the current document. */
+  bool positioned_ = false;
+};
+}  // namespace odbc
+}  // namespace documentdb
+
+#endif  //_DOCUMENTDB_ODBC_DOCUMENT_SOURCE
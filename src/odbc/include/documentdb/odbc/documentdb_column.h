@@ -36,6 +36,14 @@ namespace odbc {
  */
 class DocumentDbColumn {
  public:
+  /**
+   * Direct conversion function for the specific pair of BSON type and
+   * application buffer type.
+   */
+  typedef ConversionResult::Type (*DirectPutFunc)(
+      ApplicationDataBuffer& dataBuf,
+      bsoncxx::document::element const& element);
+
   /**
    * Default constructor.
    */
@@ -56,11 +64,6 @@ class DocumentDbColumn {
    */
   DocumentDbColumn& operator=(const DocumentDbColumn& other) = delete;
 
-  /**
-   * Updates the reference to the current document.
-   */
-  void Update(bsoncxx::document::view const& document);
-
   /**
    * Destructor.
    */
@@ -69,10 +72,9 @@ class DocumentDbColumn {
   /**
    * Constructor.
    *
-   * @param reader Reader to be used to retrieve column data.
+   * @param columnMetadata Column metadata.
    */
-  DocumentDbColumn(bsoncxx::document::view& document,
-                   JdbcColumnMetadata& columnMetadata, std::string& path);
+  explicit DocumentDbColumn(JdbcColumnMetadata& columnMetadata);
 
   /**
    * Get column size in bytes.
@@ -86,13 +88,75 @@ class DocumentDbColumn {
   /**
    * Read column data and store it in application data buffer.
    *
-   * @param reader Reader to use.
    * @param dataBuf Application data buffer.
+   * @param element Document element of the column. Invalid element is
+   * treated as null.
    * @return Operation result.
    */
-  ConversionResult::Type ReadToBuffer(ApplicationDataBuffer& dataBuf) const;
+  ConversionResult::Type ReadToBuffer(
+      ApplicationDataBuffer& dataBuf,
+      bsoncxx::document::element const& element) const;
+
+  /**
+   * Check if the column data can be read in parts into the application
+   * buffer of the given type. True for character data read as text and
+   * binary data read as binary.
+   *
+   * @param bufType Application buffer type.
+   * @return True if the data can be read in parts.
+   */
+  bool IsPartReadable(type_traits::OdbcNativeType::Type bufType) const;
+
+  /**
+   * Get the whole column value in the representation of the application
+   * buffer type, so it can be read in parts.
+   *
+   * @param element Document element of the column. Invalid element is
+   * treated as null.
+   * @param bufType Application buffer type.
+   * @param storage Storage for the generated or converted value.
+   * @param data Value data. Null for null value. May point into the
+   * document.
+   * @param len Value length in bytes.
+   * @return Operation result.
+   */
+  ConversionResult::Type ReadData(bsoncxx::document::element const& element,
+                                  type_traits::OdbcNativeType::Type bufType,
+                                  std::string& storage, const char*& data,
+                                  size_t& len) const;
 
  private:
+  /** Setter for the column data type. */
+  typedef ConversionResult::Type (DocumentDbColumn::*PutFunc)(
+      ApplicationDataBuffer& dataBuf,
+      bsoncxx::document::element const& element) const;
+
+  /**
+   * Resolve the setter for the column data type.
+   *
+   * @return Setter.
+   */
+  PutFunc ResolvePut() const;
+
+  /**
+   * Resolve the direct conversion for the BSON type and application buffer
+   * type, if there is one.
+   *
+   * @param bsonType BSON type of the element.
+   * @param bufType Application buffer type.
+   * @return Direct conversion function or null.
+   */
+  DirectPutFunc ResolveDirectPut(
+      bsoncxx::type bsonType, type_traits::OdbcNativeType::Type bufType) const;
+
+  /** Setter for null data type */
+  ConversionResult::Type PutNull(
+      ApplicationDataBuffer& dataBuf,
+      bsoncxx::document::element const& element) const;
+  /** Setter for unsupported data type */
+  ConversionResult::Type PutUnsupported(
+      ApplicationDataBuffer& dataBuf,
+      bsoncxx::document::element const& element) const;
   /** Setter for int8 data type */
   ConversionResult::Type PutInt8(
       ApplicationDataBuffer& dataBuf,
@@ -121,6 +185,14 @@ class DocumentDbColumn {
   ConversionResult::Type PutString(
       ApplicationDataBuffer& dataBuf,
       bsoncxx::document::element const& element) const;
+  /**
+   * Get the text of the element as UTF-8. Points into the document for
+   * strings, otherwise the text is generated into the storage. Data is null
+   * for null value.
+   */
+  ConversionResult::Type GetText(bsoncxx::document::element const& element,
+                                 std::string& storage, const char*& data,
+                                 size_t& len) const;
   /** Setter for decimal data type */
   ConversionResult::Type PutDecimal(
       ApplicationDataBuffer& dataBuf,
@@ -141,6 +213,13 @@ class DocumentDbColumn {
   ConversionResult::Type PutBinaryData(
       ApplicationDataBuffer& dataBuf,
       bsoncxx::document::element const& element) const;
+  /**
+   * Get the bytes of the element. Points into the document or into the
+   * storage. Data is null for null value.
+   */
+  ConversionResult::Type GetBinary(bsoncxx::document::element const& element,
+                                   std::string& storage, const char*& data,
+                                   size_t& len) const;
 
   /** Column type */
   int32_t type_;
@@ -148,11 +227,20 @@ class DocumentDbColumn {
   /** Column data size in bytes. */
   int32_t size_ = 0;
 
-  bsoncxx::document::view& document_;
+  /** Setter resolved for the column type. */
+  PutFunc put_;
 
-  JdbcColumnMetadata& columnMetadata_;
+  /** Direct conversion for the last observed BSON and buffer types. */
+  mutable DirectPutFunc directPut_ = nullptr;
+
+  /** Last observed BSON type. */
+  mutable bsoncxx::type directBsonType_ = bsoncxx::type::k_null;
 
-  std::string& path_;
+  /** Last observed application buffer type. */
+  mutable type_traits::OdbcNativeType::Type directBufType_ =
+      type_traits::OdbcNativeType::AI_UNSUPPORTED;
+
+  JdbcColumnMetadata& columnMetadata_;
 };
 }  // namespace odbc
 }  // namespace documentdb
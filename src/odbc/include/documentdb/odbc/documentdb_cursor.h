@@ -20,29 +20,49 @@
 
 #include <stdint.h>
 
+#include <atomic>
+#include <deque>
+#include <exception>
 #include <map>
 #include <memory>
+#include <thread>
 
+#include "documentdb/odbc/common/concurrent.h"
 #include "documentdb/odbc/common_types.h"
+#include "documentdb/odbc/document_source.h"
 #include "documentdb/odbc/result_page.h"
 #include "documentdb/odbc/documentdb_row.h"
-#include "mongocxx/client.hpp"
-#include "mongocxx/cursor.hpp"
 
 namespace documentdb {
 namespace odbc {
 /**
  * Query result cursor.
+ *
+ * When prefetching is enabled, a background worker reads documents ahead of
+ * the application into a queue bounded both by the number of documents and
+ * by their total size, so that getMore round trips overlap with the
+ * conversion of the current batch.
  */
 class DocumentDbCursor {
  public:
   /**
    * Constructor.
-   * @param queryId ID of the executed query.
+   *
+   * @param source Source of the result documents.
+   * @param columnMetadata Column metadata.
+   * @param paths Path in the resulting document for each column.
+   * @param clientLock Lock serializing the use of the mongo client.
+   * @param prefetchDocuments Maximum number of documents to read ahead in
+   *        background. Zero disables prefetching.
+   * @param prefetchMemoryLimit Maximum total size in bytes of the documents
+   *        read ahead.
    */
-  DocumentDbCursor(mongocxx::cursor& cursor,
+  DocumentDbCursor(std::unique_ptr< DocumentSource > source,
                    std::vector< JdbcColumnMetadata >& columnMetadata,
-                   std::vector< std::string >& paths);
+                   std::vector< std::string >& paths,
+                   common::concurrent::CriticalSection& clientLock,
+                   size_t prefetchDocuments = 0,
+                   size_t prefetchMemoryLimit = 0);
 
   /**
    * Destructor.
@@ -71,17 +91,65 @@ class DocumentDbCursor {
    */
   DocumentDbRow* GetRow();
 
+  /**
+   * Get number of columns in the result set.
+   *
+   * @return Number of columns.
+   */
+  int32_t GetColumnCount() const {
+    return columnMetadata_.size();
+  }
+
+  /**
+   * Cancel the cursor, if a fetch or the prefetch worker is in progress.
+   * Stops the prefetch worker, if any, and makes any further Increment()
+   * call return false. Has no effect on an idle cursor. Can be called from
+   * another thread.
+   */
+  void Cancel();
+
+  /**
+   * Check if the cursor has been canceled.
+   *
+   * @return True if the cursor has been canceled.
+   */
+  bool IsCanceled() const {
+    return canceled_;
+  }
+
  private:
   DOCUMENTDB_NO_COPY_ASSIGNMENT(DocumentDbCursor);
 
-  /** The resulting cursor to query/aggregate call */
-  mongocxx::cursor cursor_;
+  /**
+   * Move to the next document read by the prefetch worker.
+   *
+   * @return False if there is no more data.
+   */
+  bool IncrementPrefetched();
 
-  /** The iterator to beginning of cursor */
-  mongocxx::cursor::iterator iterator_;
+  /**
+   * Prefetch worker routine.
+   */
+  void Prefetch();
 
-  /** The iterator to end of cursor */
-  mongocxx::cursor::iterator iteratorEnd_;
+  /**
+   * Check if the prefetch queue can accept one more document.
+   * Must be called under the prefetch lock.
+   *
+   * @return True if the prefetch queue is not full.
+   */
+  bool CanPrefetch() const;
+
+  /**
+   * Stop the prefetch worker and wait for it to finish.
+   */
+  void StopPrefetch();
+
+  /** The source of the result documents */
+  std::unique_ptr< DocumentSource > source_;
+
+  /** Whether the source is positioned on a document */
+  bool hasData_ = false;
 
   /** The column metadata */
   std::vector< JdbcColumnMetadata > columnMetadata_;
@@ -94,6 +162,60 @@ class DocumentDbCursor {
 
   // Is this the first row of the iterator?
   bool isFirstRow_ = true;
+
+  /** Lock serializing the use of the mongo client. */
+  common::concurrent::CriticalSection& clientLock_;
+
+  /** Cancel flag. */
+  std::atomic< bool > canceled_{false};
+
+  /** Set while Increment() is in progress. */
+  std::atomic< bool > fetching_{false};
+
+  /** Maximum number of documents to read ahead. */
+  size_t prefetchDocuments_;
+
+  /** Maximum total size of the documents read ahead. */
+  size_t prefetchMemoryLimit_;
+
+  /** Prefetch worker thread. */
+  std::thread prefetchWorker_{};
+
+  /** Prefetch lock. Guards all the prefetch state below. */
+  common::concurrent::CriticalSection prefetchLock_;
+
+  /** Signalled whenever the prefetch queue changes. */
+  common::concurrent::ConditionVariable prefetchCond_;
+
+  /**
+   * Documents read ahead. When a row is current, it is backed by the front
+   * document of the queue.
+   */
+  std::deque< bsoncxx::document::value > prefetched_{};
+
+  /** Total size of the documents in the queue. */
+  size_t prefetchedBytes_ = 0;
+
+  /** Whether the front document of the queue backs the current row. */
+  bool hasCurrent_ = false;
+
+  /** Set when the application has consumed all the prefetched documents. */
+  bool prefetchExhausted_ = false;
+
+  /** Set to stop the prefetch worker. */
+  bool stopPrefetch_ = false;
+
+  /** Set by the prefetch worker when the cursor is exhausted. */
+  bool prefetchDone_ = false;
+
+  /** Error raised by the prefetch worker. */
+  std::exception_ptr prefetchError_{};
+
+  /** Number of times the application had to wait for the worker. */
+  int64_t prefetchWaits_ = 0;
+
+  /** Number of documents read by the worker. */
+  int64_t prefetchedTotal_ = 0;
 };
 }  // namespace odbc
 }  // namespace documentdb
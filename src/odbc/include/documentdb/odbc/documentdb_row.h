@@ -20,6 +20,8 @@
 
 #include <stdint.h>
 
+#include <cstring>
+#include <unordered_map>
 #include <vector>
 
 #include "documentdb/odbc/app/application_data_buffer.h"
@@ -72,6 +74,18 @@ class DocumentDbRow {
   app::ConversionResult::Type ReadColumnToBuffer(
       uint32_t columnIdx, app::ApplicationDataBuffer& dataBuf);
 
+  /**
+   * Read the next part of the column data and store it in application data
+   * buffer. Subsequent calls for the same column continue where the previous
+   * call stopped, until all of the value is returned.
+   *
+   * @param columnIdx Column index.
+   * @param dataBuf Application data buffer.
+   * @return Conversion result. AI_NO_DATA if the value is already returned.
+   */
+  app::ConversionResult::Type ReadColumnPartToBuffer(
+      uint32_t columnIdx, app::ApplicationDataBuffer& dataBuf);
+
   /**
    * Updates the row and columns with a new document.
    */
@@ -80,6 +94,40 @@ class DocumentDbRow {
  private:
   DOCUMENTDB_NO_COPY_ASSIGNMENT(DocumentDbRow);
 
+  /**
+   * Column path key. Refers to the path storage owned by the cursor or to
+   * the key of the document element.
+   */
+  struct PathKey {
+    /** Path data. */
+    const char* data;
+
+    /** Path length. */
+    size_t size;
+
+    bool operator==(const PathKey& other) const {
+      return size == other.size && std::memcmp(data, other.data, size) == 0;
+    }
+  };
+
+  /**
+   * FNV-1a hash of the column path.
+   */
+  struct PathKeyHash {
+    size_t operator()(const PathKey& key) const;
+  };
+
+  /**
+   * Build the index of column paths.
+   */
+  void IndexPaths();
+
+  /**
+   * Walk the current document once and assign its elements to the columns
+   * with the matching path.
+   */
+  void IndexDocument();
+
   /**
    * Get columns by its index.
    *
@@ -122,6 +170,39 @@ class DocumentDbRow {
 
   /** The matching paths in the document for the columns */
   std::vector< std::string >& paths_;
+
+  /** First column (zero-based) for each distinct path. */
+  std::unordered_map< PathKey, int32_t, PathKeyHash > pathIndex_;
+
+  /** Next column with the same path or -1. */
+  std::vector< int32_t > nextSamePath_;
+
+  /** Document elements of the columns. Invalid element for missing. */
+  std::vector< bsoncxx::document::element > elements_;
+
+  /** Whether elements of the current document are indexed. */
+  bool indexed_;
+
+  /** Column which is being read in parts or zero. */
+  uint32_t partColumnIdx_;
+
+  /** Buffer type the value of the column is read in parts as. */
+  type_traits::OdbcNativeType::Type partBufType_;
+
+  /** Converted value when it does not refer to the document. */
+  std::string partStorage_;
+
+  /** Value being read in parts. Null if the value is null. */
+  const char* partData_;
+
+  /** Length of the value being read in parts in bytes. */
+  size_t partLen_;
+
+  /** Bytes of the value already returned. */
+  size_t partOffset_;
+
+  /** Whether all of the value is already returned. */
+  bool partDone_;
 };
 }  // namespace odbc
 }  // namespace documentdb
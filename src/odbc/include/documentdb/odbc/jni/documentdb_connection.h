@@ -58,6 +58,17 @@ class DocumentDbConnection {
    */
   JniErrorCode Open(const Configuration& config, JniErrorInfo& errInfo);
 
+  /**
+   * Opens a DocumentDbConnection object given the configuration, through an
+   * SSH tunnel that is already open.
+   *
+   * @param localSSHTunnelPort Local port of the SSH tunnel. Zero lets the
+   *     JDBC driver open its own tunnel, if one is configured.
+   * @return a JniErrorCode indicating success or failure.
+   */
+  JniErrorCode Open(const Configuration& config, int32_t localSSHTunnelPort,
+                    JniErrorInfo& errInfo);
+
   /**
    * Closes the current DocumentDbConnection object.
    *
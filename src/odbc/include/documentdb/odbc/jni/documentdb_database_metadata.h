@@ -28,6 +28,7 @@ using documentdb::odbc::common::concurrent::SharedPointer;
 using documentdb::odbc::jni::ResultSet;
 using documentdb::odbc::jni::java::GlobalJObject;
 using documentdb::odbc::jni::java::JniContext;
+using documentdb::odbc::jni::java::JniErrorCode;
 using documentdb::odbc::jni::java::JniErrorInfo;
 
 namespace documentdb {
@@ -46,6 +47,25 @@ class DocumentDbDatabaseMetadata {
    */
   ~DocumentDbDatabaseMetadata() = default;
 
+  /**
+   * Gets the name of the schema.
+   *
+   * @param value The schema name.
+   * @param errInfo Error information.
+   * @return Error code.
+   */
+  JniErrorCode GetSchemaName(std::string& value, JniErrorInfo& errInfo);
+
+  /**
+   * Gets the version of the schema. The version changes when the schema
+   * is refreshed.
+   *
+   * @param value The schema version.
+   * @param errInfo Error information.
+   * @return Error code.
+   */
+  JniErrorCode GetSchemaVersion(int32_t& value, JniErrorInfo& errInfo);
+
  private:
   /**
    * Constructs an instance of the DocumentDbDatabaseMetadata class.
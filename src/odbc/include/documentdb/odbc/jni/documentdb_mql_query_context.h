@@ -35,6 +35,8 @@ using documentdb::odbc::jni::java::JniErrorInfo;
 
 namespace documentdb {
 namespace odbc {
+class SqlSelectTranslator;
+
 namespace jni {
 /**
  * Wrapper for the the JDBC DatabaseMetaData.
@@ -42,6 +44,7 @@ namespace jni {
 class DocumentDbMqlQueryContext {
   friend class DocumentDbConnection;
   friend class DocumentDbQueryMappingService;
+  friend class odbc::SqlSelectTranslator;
 
  public:
   /**
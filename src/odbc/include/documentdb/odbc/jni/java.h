@@ -33,6 +33,8 @@ using documentdb::odbc::common::concurrent::SharedPointer;
 namespace documentdb {
 namespace odbc {
 namespace jni {
+class JdbcColumnMetadata;
+
 namespace java {
 
 /* Handlers for callbacks from Java. */
@@ -197,11 +199,31 @@ typedef int64_t(JNICALL* InLongLongLongObjectOutLongHandler)(
  */
 bool DOCUMENTDB_IMPORT_EXPORT IsJava9OrLater();
 
+/**
+ * JVM settings.
+ */
+struct JvmSettings {
+  /** Initial heap size in megabytes. */
+  int initialHeapSize = 256;
+
+  /** Maximum heap size in megabytes. */
+  int maxHeapSize = 1024;
+
+  /** Garbage collector: serial, parallel, g1 or empty for the default. */
+  std::string garbageCollector;
+
+  /**
+   * Path of the class data sharing archive or empty if class data sharing
+   * is not used.
+   */
+  std::string cdsArchive;
+};
+
 /**
  * Builds the JVM options
  */
 void BuildJvmOptions(const std::string& cp, std::vector< char* >& opts,
-                     int xms = 256, int xmx = 1024);
+                     const JvmSettings& settings = JvmSettings());
 /**
  * JNI handlers holder.
  */
@@ -229,6 +251,7 @@ struct JniJavaMembers {
   jmethodID m_Throwable_printStackTrace;
 
   jclass c_String;
+  jmethodID m_String_join;
 
   jclass c_PlatformUtils;
   jmethodID m_PlatformUtils_getFullStackTrace;
@@ -267,9 +290,11 @@ struct JniMembers {
 
   jclass c_DocumentDbDatabaseSchemaMetadata;
   jmethodID m_DocumentDbDatabaseSchemaMetadataGetSchemaName;
+  jmethodID m_DocumentDbDatabaseSchemaMetadataGetSchemaVersion;
 
   jclass c_DriverManager;
   jmethodID m_DriverManagerGetConnection;
+  jmethodID m_DriverManagerGetDrivers;
 
   jclass c_Connection;
   jmethodID m_ConnectionClose;
@@ -295,6 +320,8 @@ struct JniMembers {
   jclass c_List;
   jmethodID m_ListSize;
   jmethodID m_ListGet;
+  jmethodID m_ListToArray;
+  jmethodID m_ListContains;
 
   jclass c_DocumentDbMqlQueryContext;
   jmethodID m_DocumentDbMqlQueryContextGetAggregateOperationsAsStrings;
@@ -385,6 +412,36 @@ class GlobalJObject {
   DOCUMENTDB_NO_COPY_ASSIGNMENT(GlobalJObject);
 };
 
+/**
+ * Scope for local references. Local references created while the scope is
+ * alive are released when it ends, so helpers called repeatedly from an
+ * attached native thread do not accumulate them.
+ */
+class JniLocalFrame {
+ public:
+  /**
+   * Constructor. Pushes a new local reference frame.
+   *
+   * @param env Environment.
+   * @param capacity Number of local references expected in the frame.
+   */
+  explicit JniLocalFrame(JNIEnv* env, jint capacity = 16);
+
+  /**
+   * Destructor. Pops the frame releasing its local references.
+   */
+  ~JniLocalFrame();
+
+ private:
+  /** Environment. */
+  JNIEnv* env;
+
+  /** Whether the frame was pushed. */
+  bool pushed;
+
+  DOCUMENTDB_NO_COPY_ASSIGNMENT(JniLocalFrame);
+};
+
 /**
  * JNI JVM wrapper.
  */
@@ -509,6 +566,17 @@ class DOCUMENTDB_IMPORT_EXPORT JniContext {
   JniErrorCode DriverManagerGetConnection(
       const char* connectionString, SharedPointer< GlobalJObject >& connection,
       JniErrorInfo& errInfo);
+  JniErrorCode DriverManagerLoadDrivers(JniErrorInfo& errInfo);
+  /**
+   * Get the path of the class data sharing archive that the JVM of this
+   * process is recording classes for.
+   *
+   * @return Path or empty string if the JVM was not created with
+   *     -XX:+RecordDynamicDumpInfo by this driver.
+   */
+  static std::string GetSharedArchiveDumpPath();
+  JniErrorCode DumpSharedArchive(const std::string& path,
+                                 JniErrorInfo& errInfo);
   JniErrorCode ConnectionClose(const SharedPointer< GlobalJObject >& connection,
                                JniErrorInfo& errInfo);
   JniErrorCode ConnectionGetMetaData(
@@ -533,6 +601,10 @@ class DOCUMENTDB_IMPORT_EXPORT JniContext {
       const SharedPointer< GlobalJObject >& databaseMetadata,
       std::string& value, bool& wasNull, JniErrorInfo& errInfo);
 
+  JniErrorCode DocumentDbDatabaseSchemaMetadataGetSchemaVersion(
+      const SharedPointer< GlobalJObject >& databaseMetadata, int32_t& value,
+      JniErrorInfo& errInfo);
+
   JniErrorCode DatabaseMetaDataGetTables(
       const SharedPointer< GlobalJObject >& databaseMetaData,
       const boost::optional< std::string >& catalog,
@@ -596,6 +668,31 @@ class DOCUMENTDB_IMPORT_EXPORT JniContext {
                        int32_t index, SharedPointer< GlobalJObject >& array,
                        JniErrorInfo& errInfo);
 
+  /**
+   * Read all values of a list of strings with a single call into Java.
+   *
+   * @param list List of strings.
+   * @param values Vector to append the values to.
+   * @param errInfo Error information.
+   * @return Error code.
+   */
+  JniErrorCode ListGetStrings(const SharedPointer< GlobalJObject >& list,
+                              std::vector< std::string >& values,
+                              JniErrorInfo& errInfo);
+
+  /**
+   * Read all columns of a list of JdbcColumnMetadata, attaching to the JVM
+   * once and using local references only.
+   *
+   * @param list List of JdbcColumnMetadata.
+   * @param columns Vector to append the columns to.
+   * @param errInfo Error information.
+   * @return Error code.
+   */
+  JniErrorCode JdbcColumnMetadataListRead(
+      const SharedPointer< GlobalJObject >& list,
+      std::vector< JdbcColumnMetadata >& columns, JniErrorInfo& errInfo);
+
   JniErrorCode DocumentdbMqlQueryContextGetAggregateOperationsAsStrings(
       const SharedPointer< GlobalJObject >& mqlQueryContext,
       SharedPointer< GlobalJObject >& list, JniErrorInfo& errInfo);
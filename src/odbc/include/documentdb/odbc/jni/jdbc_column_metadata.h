@@ -35,6 +35,8 @@ using documentdb::odbc::jni::java::JniErrorInfo;
 
 namespace documentdb {
 namespace odbc {
+class SqlSelectTranslator;
+
 namespace jni {
 /**
  * Wrapper for the the JDBC column metadata.
@@ -42,6 +44,8 @@ namespace jni {
 class JdbcColumnMetadata {
   friend class DocumentDbConnection;
   friend class DocumentDbQueryMappingService;
+  friend class java::JniContext;
+  friend class odbc::SqlSelectTranslator;
 
  public:
   /** Constructs a default instance */
@@ -0,0 +1,82 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _DOCUMENTDB_ODBC_JNI_JVM_PREWARM
+#define _DOCUMENTDB_ODBC_JNI_JVM_PREWARM
+
+#include <documentdb/odbc/common/concurrent.h>
+
+namespace documentdb {
+namespace odbc {
+namespace jni {
+/**
+ * Starts the JVM and loads the JDBC driver on a background thread when the
+ * first ODBC environment is allocated, so that the first connection only
+ * waits for the part of the start-up that has not finished yet.
+ *
+ * Disabled unless the DOCUMENTDB_JVM_PREWARM environment variable is set to
+ * "true". The worker thread is detached and the instance is never destroyed,
+ * so process exit never waits for the warm-up.
+ */
+class JvmPrewarm {
+ public:
+  /**
+   * Get the process-wide instance.
+   *
+   * @return Instance.
+   */
+  static JvmPrewarm& GetInstance();
+
+  /**
+   * Start the warm-up if it is enabled and has not been started yet.
+   */
+  void Start();
+
+  /**
+   * Wait for the warm-up to finish. Returns immediately if it has not been
+   * started.
+   */
+  void Wait();
+
+ private:
+  /**
+   * Constructor.
+   */
+  JvmPrewarm();
+
+  /**
+   * Start the JVM and load the JDBC driver. Runs on the worker thread.
+   */
+  void Run();
+
+  /** Whether the warm-up has been started. */
+  bool started_ = false;
+
+  /** Whether the warm-up has finished. */
+  bool finished_ = false;
+
+  /** Lock. Guards the state above. */
+  common::concurrent::CriticalSection lock_;
+
+  /** Signalled when the warm-up finishes. */
+  common::concurrent::ConditionVariable finishedCond_;
+};
+}  // namespace jni
+}  // namespace odbc
+}  // namespace documentdb
+
+#endif  //_DOCUMENTDB_ODBC_JNI_JVM_PREWARM
@@ -0,0 +1,193 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _DOCUMENTDB_ODBC_META_CATALOG
+#define _DOCUMENTDB_ODBC_META_CATALOG
+
+#include <boost/optional.hpp>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "documentdb/odbc/common/concurrent.h"
+#include "documentdb/odbc/meta/column_meta.h"
+#include "documentdb/odbc/meta/foreign_key_meta.h"
+#include "documentdb/odbc/meta/primary_key_meta.h"
+#include "documentdb/odbc/meta/table_meta.h"
+
+namespace documentdb {
+namespace odbc {
+namespace meta {
+/**
+ * In-memory catalog of the tables and columns of a connection.
+ *
+ * The catalog is loaded once from the database metadata and the catalog
+ * functions are answered from memory. Search patterns follow the ODBC
+ * rules: '%' matches any sequence of characters, '_' matches any single
+ * character and '\' escapes the next character. Matching is case
+ * sensitive. Rows are returned in the order of the database metadata.
+ *
+ * Primary and foreign keys are requested by exact table name, so they are
+ * stored per request as they are read. The catalog is thread safe.
+ */
+class Catalog {
+ public:
+  /** Escape character of the search patterns. */
+  static const char PATTERN_ESCAPE;
+
+  /**
+   * Constructor.
+   *
+   * @param tables All the tables.
+   * @param columns All the columns.
+   */
+  Catalog(const TableMetaVector& tables, const ColumnMetaVector& columns);
+
+  /**
+   * Check if the value matches the search pattern.
+   *
+   * @param value Value.
+   * @param pattern Search pattern.
+   * @return @c true if the value matches.
+   */
+  static bool MatchPattern(const std::string& value,
+                           const std::string& pattern);
+
+  /**
+   * Get the number of tables.
+   *
+   * @return Number of tables.
+   */
+  size_t GetTablesNumber() const {
+    return tables_.size();
+  }
+
+  /**
+   * Get the number of columns.
+   *
+   * @return Number of columns.
+   */
+  size_t GetColumnsNumber() const {
+    return columns_.size();
+  }
+
+  /**
+   * Find the tables.
+   *
+   * @param catalog Catalog name. Not used for filtering if not set.
+   * @param schema Schema name pattern. Not used for filtering if not set.
+   * @param table Table name pattern.
+   * @param types Table types. Not used for filtering if not set.
+   * @param meta Found tables.
+   */
+  void GetTables(const boost::optional< std::string >& catalog,
+                 const boost::optional< std::string >& schema,
+                 const std::string& table,
+                 const boost::optional< std::vector< std::string > >& types,
+                 TableMetaVector& meta) const;
+
+  /**
+   * Find the columns.
+   *
+   * @param catalog Catalog name. Not used for filtering if not set.
+   * @param schema Schema name pattern. Not used for filtering if not set.
+   * @param table Table name pattern.
+   * @param column Column name pattern.
+   * @param meta Found columns.
+   */
+  void GetColumns(const boost::optional< std::string >& catalog,
+                  const boost::optional< std::string >& schema,
+                  const std::string& table, const std::string& column,
+                  ColumnMetaVector& meta) const;
+
+  /**
+   * Find the primary keys of a table read before.
+   *
+   * @param catalog Catalog name.
+   * @param schema Schema name.
+   * @param table Table name.
+   * @param meta Found primary keys.
+   * @return @c true if found.
+   */
+  bool GetPrimaryKeys(const boost::optional< std::string >& catalog,
+                      const boost::optional< std::string >& schema,
+                      const boost::optional< std::string >& table,
+                      PrimaryKeyMetaVector& meta) const;
+
+  /**
+   * Store the primary keys of a table.
+   *
+   * @param catalog Catalog name.
+   * @param schema Schema name.
+   * @param table Table name.
+   * @param meta Primary keys.
+   */
+  void PutPrimaryKeys(const boost::optional< std::string >& catalog,
+                      const boost::optional< std::string >& schema,
+                      const boost::optional< std::string >& table,
+                      const PrimaryKeyMetaVector& meta);
+
+  /**
+   * Find the foreign keys of a table read before.
+   *
+   * @param catalog Catalog name.
+   * @param schema Schema name.
+   * @param table Table name.
+   * @param meta Found foreign keys.
+   * @return @c true if found.
+   */
+  bool GetForeignKeys(const boost::optional< std::string >& catalog,
+                      const boost::optional< std::string >& schema,
+                      const std::string& table,
+                      ForeignKeyMetaVector& meta) const;
+
+  /**
+   * Store the foreign keys of a table.
+   *
+   * @param catalog Catalog name.
+   * @param schema Schema name.
+   * @param table Table name.
+   * @param meta Foreign keys.
+   */
+  void PutForeignKeys(const boost::optional< std::string >& catalog,
+                      const boost::optional< std::string >& schema,
+                      const std::string& table,
+                      const ForeignKeyMetaVector& meta);
+
+ private:
+  DOCUMENTDB_NO_COPY_ASSIGNMENT(Catalog);
+
+  /** Tables. */
+  TableMetaVector tables_;
+
+  /** Columns. */
+  ColumnMetaVector columns_;
+
+  /** Primary keys by request. */
+  std::map< std::string, PrimaryKeyMetaVector > primaryKeys_;
+
+  /** Foreign keys by request. */
+  std::map< std::string, ForeignKeyMetaVector > foreignKeys_;
+
+  /** Keys lock. */
+  mutable common::concurrent::CriticalSection keysLock_;
+};
+}  // namespace meta
+}  // namespace odbc
+}  // namespace documentdb
+
+#endif  //_DOCUMENTDB_ODBC_META_CATALOG
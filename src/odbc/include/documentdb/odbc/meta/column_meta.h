@@ -25,6 +25,7 @@
 #include <string>
 
 #include "documentdb/odbc/impl/binary/binary_reader_impl.h"
+#include "documentdb/odbc/impl/binary/binary_writer_impl.h"
 #include "documentdb/odbc/common_types.h"
 #include "documentdb/odbc/jni/jdbc_column_metadata.h"
 #include "documentdb/odbc/jni/result_set.h"
@@ -172,6 +173,18 @@ class ColumnMeta {
   void ReadJdbcMetadata(JdbcColumnMetadata& jdbcMetadata,
                         int32_t& prevPosition);
 
+  /**
+   * Read using binary reader.
+   * @param reader Reader.
+   */
+  void Read(impl::binary::BinaryReaderImpl& reader);
+
+  /**
+   * Write using binary writer.
+   * @param writer Writer.
+   */
+  void Write(impl::binary::BinaryWriterImpl& writer) const;
+
   /**
    * Get catalog name.
    * @return Catalog name.
@@ -0,0 +1,224 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _DOCUMENTDB_ODBC_META_METADATA_CACHE
+#define _DOCUMENTDB_ODBC_META_METADATA_CACHE
+
+#include <stdint.h>
+
+#include <boost/optional.hpp>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "documentdb/odbc/common/concurrent.h"
+#include "documentdb/odbc/meta/column_meta.h"
+#include "documentdb/odbc/meta/table_meta.h"
+
+namespace documentdb {
+namespace odbc {
+namespace meta {
+/**
+ * Table and column metadata cache, persisted in a local file so that it is
+ * shared by the processes connecting to the same database and schema.
+ *
+ * The entries are keyed by the arguments of the metadata request and expire
+ * after the time to live. A file written for another key or by another
+ * version of the format is ignored. The cache is thread safe.
+ */
+class MetadataCache {
+ public:
+  /** Version of the file format. */
+  static const int32_t FORMAT_VERSION;
+
+  /**
+   * Constructor.
+   *
+   * @param path Path of the cache file.
+   * @param key Key identifying the host, database and schema.
+   * @param ttl Time to live of the entries in seconds.
+   */
+  MetadataCache(const std::string& path, const std::string& key, int32_t ttl);
+
+  /**
+   * Make the key identifying the host, database and schema.
+   *
+   * @param hostname Hostname.
+   * @param port Port.
+   * @param database Database name.
+   * @param schemaName Schema name.
+   * @return Key.
+   */
+  static std::string MakeKey(const std::string& hostname, int32_t port,
+                             const std::string& database,
+                             const std::string& schemaName);
+
+  /**
+   * Make the path of the cache file for the key.
+   *
+   * @param dir Directory of the cache files.
+   * @param key Key.
+   * @return Path.
+   */
+  static std::string MakePath(const std::string& dir, const std::string& key);
+
+  /**
+   * Get the path of the cache file.
+   *
+   * @return Path.
+   */
+  const std::string& GetPath() const {
+    return path_;
+  }
+
+  /**
+   * Load the entries from the file, replacing the entries in memory.
+   * Expired entries are skipped.
+   *
+   * @return @c true if the file exists and is valid.
+   */
+  bool Load();
+
+  /**
+   * Save the entries to the file. The file is replaced atomically where the
+   * platform allows it.
+   *
+   * @return @c true on success.
+   */
+  bool Save();
+
+  /**
+   * Remove all the entries. The file is replaced on the next save.
+   */
+  void Clear();
+
+  /**
+   * Check if there are changes that are not saved.
+   *
+   * @return @c true if there are changes that are not saved.
+   */
+  bool IsDirty() const;
+
+  /**
+   * Find the result of a tables request.
+   *
+   * @param catalog Catalog name.
+   * @param schema Schema name pattern.
+   * @param table Table name pattern.
+   * @param types Table types.
+   * @param meta Found tables.
+   * @return @c true if found.
+   */
+  bool GetTables(const boost::optional< std::string >& catalog,
+                 const boost::optional< std::string >& schema,
+                 const std::string& table,
+                 const boost::optional< std::vector< std::string > >& types,
+                 TableMetaVector& meta);
+
+  /**
+   * Store the result of a tables request.
+   *
+   * @param catalog Catalog name.
+   * @param schema Schema name pattern.
+   * @param table Table name pattern.
+   * @param types Table types.
+   * @param meta Tables.
+   */
+  void PutTables(const boost::optional< std::string >& catalog,
+                 const boost::optional< std::string >& schema,
+                 const std::string& table,
+                 const boost::optional< std::vector< std::string > >& types,
+                 const TableMetaVector& meta);
+
+  /**
+   * Find the result of a columns request.
+   *
+   * @param catalog Catalog name.
+   * @param schema Schema name pattern.
+   * @param table Table name pattern.
+   * @param column Column name pattern.
+   * @param meta Found columns.
+   * @return @c true if found.
+   */
+  bool GetColumns(const boost::optional< std::string >& catalog,
+                  const boost::optional< std::string >& schema,
+                  const std::string& table, const std::string& column,
+                  ColumnMetaVector& meta);
+
+  /**
+   * Store the result of a columns request.
+   *
+   * @param catalog Catalog name.
+   * @param schema Schema name pattern.
+   * @param table Table name pattern.
+   * @param column Column name pattern.
+   * @param meta Columns.
+   */
+  void PutColumns(const boost::optional< std::string >& catalog,
+                  const boost::optional< std::string >& schema,
+                  const std::string& table, const std::string& column,
+                  const ColumnMetaVector& meta);
+
+ private:
+  DOCUMENTDB_NO_COPY_ASSIGNMENT(MetadataCache);
+
+  /**
+   * Cache entry.
+   */
+  template < typename V >
+  struct Entry {
+    /** Creation time in seconds since the epoch. */
+    int64_t created;
+
+    /** Value. */
+    V value;
+  };
+
+  /**
+   * Check if the entry created at the time is expired.
+   *
+   * @param created Creation time in seconds since the epoch.
+   * @return @c true if expired.
+   */
+  bool IsExpired(int64_t created) const;
+
+  /** Path of the cache file. */
+  std::string path_;
+
+  /** Key identifying the host, database and schema. */
+  std::string key_;
+
+  /** Time to live of the entries in seconds. */
+  int32_t ttl_;
+
+  /** Unsaved changes flag. */
+  bool dirty_;
+
+  /** Tables by request. */
+  std::map< std::string, Entry< TableMetaVector > > tables_;
+
+  /** Columns by request. */
+  std::map< std::string, Entry< ColumnMetaVector > > columns_;
+
+  /** Lock. */
+  mutable common::concurrent::CriticalSection lock_;
+};
+}  // namespace meta
+}  // namespace odbc
+}  // namespace documentdb
+
+#endif  //_DOCUMENTDB_ODBC_META_METADATA_CACHE
@@ -26,6 +26,7 @@
 #include <boost/optional/optional_io.hpp>
 
 #include "documentdb/odbc/impl/binary/binary_reader_impl.h"
+#include "documentdb/odbc/impl/binary/binary_writer_impl.h"
 #include "documentdb/odbc/jni/result_set.h"
 #include "documentdb/odbc/utility.h"
 
@@ -102,6 +103,18 @@ class TableMeta {
    */
   void Read(SharedPointer< ResultSet >& resultSet, JniErrorInfo& errInfo);
 
+  /**
+   * Read using binary reader.
+   * @param reader Reader.
+   */
+  void Read(impl::binary::BinaryReaderImpl& reader);
+
+  /**
+   * Write using binary writer.
+   * @param writer Writer.
+   */
+  void Write(impl::binary::BinaryWriterImpl& writer) const;
+
   /**
    * Get catalog name.
    * @return Catalog name.
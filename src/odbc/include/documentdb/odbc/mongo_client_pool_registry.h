@@ -0,0 +1,170 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _DOCUMENTDB_ODBC_MONGO_CLIENT_POOL_REGISTRY
+#define _DOCUMENTDB_ODBC_MONGO_CLIENT_POOL_REGISTRY
+
+#include <documentdb/odbc/common/concurrent.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mongocxx/client.hpp>
+#include <mongocxx/pool.hpp>
+#include <string>
+
+namespace documentdb {
+namespace odbc {
+/**
+ * Process-wide registry of MongoDB client pools.
+ *
+ * Connections to the same target borrow their client from one pool, keyed
+ * by the effective MongoDB URI and TLS options, instead of making a client
+ * of their own. Clients keep their server connections when returned, so
+ * later connections skip the TLS handshake and the authentication.
+ */
+class MongoClientPoolRegistry {
+ public:
+  /**
+   * Statistics of the client pools.
+   */
+  struct Statistics {
+    /** Number of pools. */
+    uint32_t pools = 0;
+
+    /** Number of clients acquired. */
+    uint64_t acquired = 0;
+
+    /** Number of clients currently in use. */
+    uint64_t inUse = 0;
+
+    /** Number of acquisitions that waited for a client to be returned. */
+    uint64_t waits = 0;
+
+    /** Number of acquisitions currently waiting. */
+    uint64_t waiting = 0;
+
+    /** Total wait time in milliseconds. */
+    uint64_t waitTimeMs = 0;
+
+    /** Longest wait time in milliseconds. */
+    uint64_t maxWaitTimeMs = 0;
+  };
+
+  /**
+   * Get the process-wide instance.
+   *
+   * @return Instance.
+   */
+  static MongoClientPoolRegistry& GetInstance();
+
+  /**
+   * Acquire a client of the pool of the target. The pool is created on
+   * first use, with minSize clients connected. Waits for a client to be
+   * returned if maxSize clients are in use.
+   *
+   * @param uri MongoDB connection string.
+   * @param tls Whether TLS is used.
+   * @param minSize Number of clients connected when the pool is created.
+   * @param maxSize Maximum number of clients of the pool.
+   * @param waitTimeoutMs Maximum time to wait for a client in milliseconds.
+   *     Zero waits without limit.
+   * @return Client. It is returned to its pool when released.
+   * @throw mongocxx::exception on error or if the wait timed out.
+   */
+  std::shared_ptr< mongocxx::client > Acquire(const std::string& uri,
+                                              bool tls, int32_t minSize,
+                                              int32_t maxSize,
+                                              int32_t waitTimeoutMs);
+
+  /**
+   * Get the statistics of all the pools.
+   *
+   * @return Statistics.
+   */
+  Statistics GetStatistics() const;
+
+ private:
+  /**
+   * Pool of a target.
+   */
+  struct Pool {
+    /** Clients. */
+    std::unique_ptr< mongocxx::pool > clients;
+
+    /** Number of clients acquired. */
+    std::atomic< uint64_t > acquired{0};
+
+    /** Number of clients currently in use. */
+    std::atomic< uint64_t > inUse{0};
+
+    /** Number of acquisitions that waited. */
+    std::atomic< uint64_t > waits{0};
+
+    /** Number of acquisitions currently waiting. */
+    std::atomic< uint64_t > waiting{0};
+
+    /** Total wait time in milliseconds. */
+    std::atomic< uint64_t > waitTimeMs{0};
+
+    /** Longest wait time in milliseconds. */
+    std::atomic< uint64_t > maxWaitTimeMs{0};
+  };
+
+  /**
+   * Constructor.
+   */
+  MongoClientPoolRegistry();
+
+  MongoClientPoolRegistry(const MongoClientPoolRegistry&) = delete;
+
+  MongoClientPoolRegistry& operator=(const MongoClientPoolRegistry&) =
+      delete;
+
+  /**
+   * Get the pool of the target, creating it if needed.
+   *
+   * @param uri MongoDB connection string.
+   * @param tls Whether TLS is used.
+   * @param maxSize Maximum number of clients of the pool.
+   * @param waitTimeoutMs Maximum time to wait for a client in milliseconds.
+   * @param created Set to @c true if the pool was created.
+   * @return Pool.
+   */
+  std::shared_ptr< Pool > GetPool(const std::string& uri, bool tls,
+                                  int32_t maxSize, int32_t waitTimeoutMs,
+                                  bool& created);
+
+  /**
+   * Connect clients of a new pool.
+   *
+   * @param pool Pool.
+   * @param count Number of clients to connect.
+   */
+  static void Prewarm(Pool& pool, int32_t count);
+
+  /** Pools by key. */
+  std::map< std::string, std::shared_ptr< Pool > > pools_;
+
+  /** Pools lock. */
+  mutable common::concurrent::CriticalSection lock_;
+};
+}  // namespace odbc
+}  // namespace documentdb
+
+#endif  //_DOCUMENTDB_ODBC_MONGO_CLIENT_POOL_REGISTRY
@@ -18,6 +18,11 @@
 #ifndef _DOCUMENTDB_ODBC_QUERY_DATA_QUERY
 #define _DOCUMENTDB_ODBC_QUERY_DATA_QUERY
 
+#include <bsoncxx/document/value.hpp>
+#include <memory>
+#include <mongocxx/options/aggregate.hpp>
+#include <mongocxx/pipeline.hpp>
+
 #include "documentdb/odbc/app/parameter_set.h"
 #include "documentdb/odbc/documentdb_cursor.h"
 #include "documentdb/odbc/query/query.h"
@@ -44,10 +49,14 @@ class DataQuery : public Query {
    * @param sql SQL query string.
    * @param params SQL params.
    * @param timeout Timeout.
+   * @param prefetchBatches Number of result batches to prefetch in
+   *        background.
+   * @param rowArraySize Application row array size.
    */
   DataQuery(diagnostic::DiagnosableAdapter& diag, Connection& connection,
             const std::string& sql, const app::ParameterSet& params,
-            int32_t& timeout);
+            int32_t& timeout, int32_t& prefetchBatches,
+            SqlUlen& rowArraySize);
 
   /**
    * Destructor.
@@ -76,6 +85,23 @@ class DataQuery : public Query {
    */
   virtual SqlResult::Type FetchNextRow(app::ColumnBindingMap& columnBindings);
 
+  /**
+   * Fetch next row set to application buffers.
+   *
+   * Bound columns are resolved once per call and every document of the row
+   * set is decoded directly into the bound column arrays.
+   *
+   * @param columnBindings Application buffers to put data to.
+   * @param rowArraySize Number of rows in the row set.
+   * @param rowStatuses Row status array. Can be null.
+   * @param fetched Number of fetched rows.
+   * @return Operation result.
+   */
+  virtual SqlResult::Type FetchNextRowSet(app::ColumnBindingMap& columnBindings,
+                                          SqlUlen rowArraySize,
+                                          SQLUSMALLINT* rowStatuses,
+                                          SqlUlen& fetched);
+
   /**
    * Get data of the specified column in the result set.
    *
@@ -93,6 +119,11 @@ class DataQuery : public Query {
    */
   virtual SqlResult::Type Close();
 
+  /**
+   * Cancel query. Stops the cursor and its prefetch worker, if any.
+   */
+  virtual void Cancel();
+
   /**
    * Check if data is available.
    *
@@ -123,6 +154,25 @@ class DataQuery : public Query {
     return sql_;
   }
 
+  /**
+   * Get statistics of the documents read by the last execution.
+   *
+   * @return Fetch statistics.
+   */
+  const FetchStatistics& GetFetchStatistics() const {
+    return fetchStats_;
+  }
+
+  /**
+   * Get the number of parameter markers of the query if it is translated
+   * natively. Prepares the pipeline, which the execution then reuses.
+   *
+   * @param paramNum Number of parameter markers.
+   * @return @c true on success and @c false if the native query translation
+   *     is disabled or the markers of the query are not translated natively.
+   */
+  bool GetNativeParametersNumber(uint16_t& paramNum);
+
  private:
   DOCUMENTDB_NO_COPY_ASSIGNMENT(DataQuery);
 
@@ -156,6 +206,23 @@ class DataQuery : public Query {
    */
   SqlResult::Type MakeRequestFetch();
 
+  /**
+   * Prepare the aggregation pipeline and the aggregate options of the query.
+   * The ones prepared by the previous execution are reused, unless the
+   * translations of the connection or the timeout changed since.
+   *
+   * @param error Error.
+   * @return Result.
+   */
+  SqlResult::Type PreparePipeline(DocumentDbError& error);
+
+  /**
+   * Bind the values of the parameters to the prepared pipeline.
+   *
+   * @return Result.
+   */
+  SqlResult::Type BindParameters();
+
   /**
    * Gets the MQL query context.
    *
@@ -213,6 +280,23 @@ class DataQuery : public Query {
    */
   SqlResult::Type InternalClose();
 
+  /**
+   * Replace the cursor. The previous cursor is destroyed outside of the
+   * cursor lock, so that a concurrent cancel does not wait for it.
+   *
+   * @param cursor New cursor. Can be null.
+   */
+  void SetCursor(DocumentDbCursor* cursor);
+
+  /**
+   * Move cursor to the next row, reporting cancellation and errors raised
+   * while reading the result.
+   *
+   * @param result Operation result. Set only on failure.
+   * @return True if the cursor was moved to the next row.
+   */
+  bool IncrementCursor(SqlResult::Type& result);
+
   /** Connection associated with the statement. */
   Connection& connection_;
 
@@ -228,11 +312,51 @@ class DataQuery : public Query {
   /** Result set metadata. */
   meta::ColumnMetaVector resultMeta_{};
 
+  /** Statistics of the documents read. Must outlive the cursor. */
+  FetchStatistics fetchStats_;
+
   /** Cursor. */
   std::unique_ptr< DocumentDbCursor > cursor_{};
 
+  /**
+   * Cursor lock. Held while the cursor is replaced and while it is canceled
+   * from another thread.
+   */
+  common::concurrent::CriticalSection cursorLock_;
+
+  /** Bound columns of the current row set fetch. */
+  std::vector< std::pair< uint16_t, app::ApplicationDataBuffer* > >
+      boundColumns_{};
+
   /** Timeout. */
   int32_t& timeout_;
+
+  /** Translation of the query. Null until the first execution. */
+  SharedPointer< DocumentDbMqlQueryContext > mqlQueryContext_{};
+
+  /** Parsed aggregation pipeline. Null until the first execution. */
+  std::unique_ptr< mongocxx::pipeline > pipeline_{};
+
+  /** Parsed stages of the pipeline, with placeholders of the parameters. */
+  std::vector< bsoncxx::document::value > stages_{};
+
+  /** Number of parameter markers in the pipeline. */
+  uint16_t parametersNumber_ = 0;
+
+  /** Aggregate options of the pipeline. */
+  mongocxx::options::aggregate aggregateOptions_{};
+
+  /** Query mapping generation the pipeline was prepared for. */
+  uint64_t pipelineGeneration_ = 0;
+
+  /** Timeout the aggregate options were prepared for. */
+  int32_t pipelineTimeout_ = 0;
+
+  /** Number of result batches to prefetch in background. */
+  int32_t& prefetchBatches_;
+
+  /** Application row array size. */
+  SqlUlen& rowArraySize_;
 };
 }  // namespace query
 }  // namespace odbc
@@ -93,6 +93,22 @@ class Query {
   virtual SqlResult::Type FetchNextRow(
       app::ColumnBindingMap& columnBindings) = 0;
 
+  /**
+   * Fetch next row set to application buffers.
+   *
+   * Default implementation fetches rows one by one using FetchNextRow().
+   *
+   * @param columnBindings Application buffers to put data to.
+   * @param rowArraySize Number of rows in the row set.
+   * @param rowStatuses Row status array. Can be null.
+   * @param fetched Number of fetched rows.
+   * @return Operation result.
+   */
+  virtual SqlResult::Type FetchNextRowSet(app::ColumnBindingMap& columnBindings,
+                                          SqlUlen rowArraySize,
+                                          SQLUSMALLINT* rowStatuses,
+                                          SqlUlen& fetched);
+
   /**
    * Get data of the specified column in the result set.
    *
@@ -110,6 +126,14 @@ class Query {
    */
   virtual SqlResult::Type Close() = 0;
 
+  /**
+   * Cancel query processing.
+   *
+   * Can be called from another thread while the query is being fetched.
+   * Default implementation does nothing.
+   */
+  virtual void Cancel();
+
   /**
    * Get column metadata.
    *
@@ -147,6 +171,23 @@ class Query {
     return type;
   }
 
+  /**
+   * Convert SQL result to the row status value.
+   *
+   * @param value SQL result of the row fetch.
+   * @return Row status value.
+   */
+  static uint16_t SqlResultToRowResult(SqlResult::Type value);
+
+  /**
+   * Get the SQL result of the whole row set fetch.
+   *
+   * @param fetched Number of rows fetched successfully.
+   * @param errors Number of rows fetched with errors.
+   * @return Operation result.
+   */
+  static SqlResult::Type RowSetResult(SqlUlen fetched, SqlUlen errors);
+
  protected:
   /**
    * Constructor.
@@ -26,7 +26,7 @@ class SqlLexer;
  * SQL command type.
  */
 struct SqlCommandType {
-  enum Type { SET_STREAMING };
+  enum Type { SET_STREAMING, SELECT };
 };
 
 /**
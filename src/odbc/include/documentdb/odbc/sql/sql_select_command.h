@@ -0,0 +1,271 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _DOCUMENTDB_ODBC_SQL_SQL_SELECT_COMMAND
+#define _DOCUMENTDB_ODBC_SQL_SQL_SELECT_COMMAND
+
+#include <documentdb/odbc/sql/sql_command.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+namespace documentdb {
+namespace odbc {
+class SqlToken;
+
+/**
+ * SQL select command.
+ *
+ * Only the subset the driver can translate natively is recognized:
+ * SELECT * | column [, ...] FROM table
+ * [WHERE predicate [AND ...]] [ORDER BY column [ASC | DESC] [, ...]]
+ * [LIMIT n]
+ * where a predicate compares a column with a literal or a parameter marker,
+ * or checks it for null. Anything else raises a syntax error.
+ */
+class SqlSelectCommand : public SqlCommand {
+ public:
+  /**
+   * Literal of a predicate.
+   */
+  struct Literal {
+    enum Type {
+      /** Integer number. */
+      INTEGER,
+
+      /** Number with a fractional part. */
+      DECIMAL,
+
+      /** String. */
+      STRING,
+
+      /** TRUE or FALSE. */
+      BOOLEAN,
+
+      /** Parameter marker. */
+      PARAMETER
+    };
+
+    /** Type. */
+    Type type;
+
+    /**
+     * Value. Strings are unquoted, booleans are "true" or "false" and
+     * parameter markers hold their number, starting with 1.
+     */
+    std::string value;
+  };
+
+  /**
+   * Predicate on a single column.
+   */
+  struct Predicate {
+    enum Operator { EQ, NE, LT, LE, GT, GE, IS_NULL, IS_NOT_NULL };
+
+    /** Column name. */
+    std::string column;
+
+    /** Operator. */
+    Operator op;
+
+    /** Literal. Not set for IS [NOT] NULL. */
+    Literal literal;
+  };
+
+  /**
+   * Sort key.
+   */
+  struct SortKey {
+    /** Column name. */
+    std::string column;
+
+    /** Ascending order. */
+    bool ascending;
+  };
+
+  /**
+   * Default constructor.
+   */
+  SqlSelectCommand();
+
+  /**
+   * Destructor.
+   */
+  virtual ~SqlSelectCommand();
+
+  /**
+   * Parse from lexer. The current token must be SELECT.
+   *
+   * @param lexer Lexer.
+   */
+  virtual void Parse(SqlLexer& lexer);
+
+  /**
+   * Check if all columns are selected.
+   *
+   * @return @c true for SELECT *.
+   */
+  bool IsAllColumns() const {
+    return allColumns;
+  }
+
+  /**
+   * Get selected columns.
+   *
+   * @return Column names. Empty for SELECT *.
+   */
+  const std::vector< std::string >& GetColumns() const {
+    return columns;
+  }
+
+  /**
+   * Get schema name.
+   *
+   * @return Schema name or empty string if the table is not qualified.
+   */
+  const std::string& GetSchema() const {
+    return schema;
+  }
+
+  /**
+   * Get table name.
+   *
+   * @return Table name.
+   */
+  const std::string& GetTable() const {
+    return table;
+  }
+
+  /**
+   * Get predicates of the WHERE clause, joined by AND.
+   *
+   * @return Predicates.
+   */
+  const std::vector< Predicate >& GetPredicates() const {
+    return predicates;
+  }
+
+  /**
+   * Get sort keys of the ORDER BY clause.
+   *
+   * @return Sort keys.
+   */
+  const std::vector< SortKey >& GetOrderBy() const {
+    return orderBy;
+  }
+
+  /**
+   * Get row limit.
+   *
+   * @return Limit or -1 if there is no LIMIT clause.
+   */
+  int64_t GetLimit() const {
+    return limit;
+  }
+
+  /**
+   * Get number of parameter markers.
+   *
+   * @return Number of parameter markers.
+   */
+  uint16_t GetParametersNumber() const {
+    return parametersNumber;
+  }
+
+ private:
+  /**
+   * Parse identifier at the current token.
+   *
+   * @param lexer Lexer to use.
+   * @param description Identifier description to use in exception on error.
+   * @return Identifier.
+   */
+  static std::string ExpectIdentifier(SqlLexer& lexer,
+                                      const std::string& description);
+
+  /**
+   * Parse column name at the current token, optionally qualified with the
+   * table name, and shift past it.
+   *
+   * @param lexer Lexer to use.
+   * @param qualifier Set to the qualifier, if any.
+   * @return Column name.
+   */
+  static std::string ParseColumn(SqlLexer& lexer, std::string& qualifier);
+
+  /**
+   * Parse predicate at the current token and shift past it.
+   *
+   * @param lexer Lexer to use.
+   * @param qualifier Set to the qualifier of the column, if any.
+   */
+  void ParsePredicate(SqlLexer& lexer, std::string& qualifier);
+
+  /**
+   * Parse literal at the current token and shift past it.
+   *
+   * @param lexer Lexer to use.
+   * @return Literal.
+   */
+  static Literal ParseLiteral(SqlLexer& lexer);
+
+  /**
+   * Shift to the next token, which must exist.
+   *
+   * @param lexer Lexer to use.
+   * @param expected Expected details to use in exception on error.
+   */
+  static void ExpectNext(SqlLexer& lexer, const std::string& expected);
+
+  /**
+   * Throw exception, showing that token is unexpected.
+   *
+   * @param token Token.
+   * @param expected Expected details.
+   */
+  static void ThrowUnexpectedTokenError(const SqlToken& token,
+                                        const std::string& expected);
+
+  /** Whether all columns are selected. */
+  bool allColumns;
+
+  /** Selected columns. */
+  std::vector< std::string > columns;
+
+  /** Schema name. */
+  std::string schema;
+
+  /** Table name. */
+  std::string table;
+
+  /** Predicates. */
+  std::vector< Predicate > predicates;
+
+  /** Sort keys. */
+  std::vector< SortKey > orderBy;
+
+  /** Row limit. */
+  int64_t limit;
+
+  /** Number of parameter markers. */
+  uint16_t parametersNumber;
+};
+}  // namespace odbc
+}  // namespace documentdb
+
+#endif  //_DOCUMENTDB_ODBC_SQL_SQL_SELECT_COMMAND
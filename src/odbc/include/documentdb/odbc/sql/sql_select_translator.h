@@ -0,0 +1,137 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _DOCUMENTDB_ODBC_SQL_SQL_SELECT_TRANSLATOR
+#define _DOCUMENTDB_ODBC_SQL_SQL_SELECT_TRANSLATOR
+
+#include <documentdb/odbc/common/concurrent.h>
+#include <documentdb/odbc/jni/documentdb_mql_query_context.h>
+#include <documentdb/odbc/sql/sql_select_command.h>
+
+#include <boost/optional.hpp>
+#include <bsoncxx/document/value.hpp>
+#include <bsoncxx/document/view.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace documentdb {
+namespace odbc {
+/**
+ * Translates simple SELECT statements on base tables to an aggregate
+ * pipeline without calling the JVM.
+ *
+ * The column metadata and document paths of the table are taken from the
+ * translation of "SELECT * FROM table", which the caller gets once from the
+ * JVM and caches. Only single-stage $project translations (tables that are
+ * not virtual tables of arrays or sub-documents) are supported, and only
+ * predicates and sort keys whose MQL semantics match SQL. Everything else
+ * must be translated by the JVM.
+ *
+ * Predicates on parameter markers are translated to placeholders, so the
+ * pipeline can be cached and bound to the parameter values on every
+ * execution.
+ */
+class SqlSelectTranslator {
+ public:
+  /**
+   * Parse a statement of the supported subset.
+   *
+   * @param sql SQL statement.
+   * @return Select command or null if the statement is not in the subset.
+   */
+  static std::shared_ptr< SqlSelectCommand > Parse(const std::string& sql);
+
+  /**
+   * Get the statement that selects every column of the command's table.
+   *
+   * @param select Select command.
+   * @return SQL statement.
+   */
+  static std::string GetTableQuery(const SqlSelectCommand& select);
+
+  /**
+   * Translate a select command.
+   *
+   * @param select Select command.
+   * @param tableContext Translation of the table query.
+   * @return Query context or null if the command cannot be translated
+   *     natively.
+   */
+  static common::concurrent::SharedPointer< jni::DocumentDbMqlQueryContext >
+  Translate(const SqlSelectCommand& select,
+            jni::DocumentDbMqlQueryContext& tableContext);
+
+  /**
+   * Get number of parameter markers in a pipeline stage.
+   *
+   * @param stage Pipeline stage.
+   * @return Highest number of the parameter markers in the stage or zero if
+   *     the stage has no placeholders.
+   */
+  static uint16_t GetParametersNumber(const bsoncxx::document::view& stage);
+
+  /**
+   * Get the statement of the command with the literals of its predicates
+   * replaced with parameter markers. Queries that only differ by the
+   * literals of their predicates have the same statement, so they can
+   * share its translation. Literals that change the structure of the
+   * pipeline, such as the row limit, are kept.
+   *
+   * @param select Select command.
+   * @param literals Replaced literals, in the order of the markers.
+   * @return Statement or an empty string if the command has no literals to
+   *     replace or already has parameter markers.
+   */
+  static std::string Parameterize(
+      const SqlSelectCommand& select,
+      std::vector< boost::optional< SqlSelectCommand::Literal > >& literals);
+
+  /**
+   * Replace the placeholders of the parameter markers in a pipeline stage
+   * with the conditions on the parameter values.
+   *
+   * @param stage Pipeline stage.
+   * @param values Parameter values, the first parameter at index 0. Null
+   *     values never match.
+   * @return Stage with the conditions.
+   * @throw OdbcError if a value is missing or cannot be compared with the
+   *     column.
+   */
+  static bsoncxx::document::value BindParameters(
+      const bsoncxx::document::view& stage,
+      const std::vector< boost::optional< SqlSelectCommand::Literal > >&
+          values);
+
+  /**
+   * Bind the parameter values to a translation with parameter markers.
+   *
+   * @param context Translation with parameter markers.
+   * @param values Parameter values, the first parameter at index 0.
+   * @return Query context or null if a value cannot be compared with its
+   *     column or the translation has no placeholder for it.
+   */
+  static common::concurrent::SharedPointer< jni::DocumentDbMqlQueryContext >
+  BindParameters(
+      const jni::DocumentDbMqlQueryContext& context,
+      const std::vector< boost::optional< SqlSelectCommand::Literal > >&
+          values);
+};
+}  // namespace odbc
+}  // namespace documentdb
+
+#endif  //_DOCUMENTDB_ODBC_SQL_SQL_SELECT_TRANSLATOR
@@ -55,6 +55,18 @@ struct TokenType {
     /** Simple word. */
     WORD,
 
+    /** Asterisk. */
+    ASTERISK,
+
+    /** Comparison operator: =, <>, !=, <, <=, > or >=. */
+    COMPARISON,
+
+    /** Parameter marker: ?. */
+    PARAMETER_MARKER,
+
+    /** Any other single character. */
+    OTHER,
+
     /** End of data. */
     EOD
   };
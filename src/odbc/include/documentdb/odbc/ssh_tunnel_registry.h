@@ -0,0 +1,183 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _DOCUMENTDB_ODBC_SSH_TUNNEL_REGISTRY
+#define _DOCUMENTDB_ODBC_SSH_TUNNEL_REGISTRY
+
+#include <documentdb/odbc/common/concurrent.h>
+#include <stdint.h>
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "documentdb/odbc/config/configuration.h"
+#include "documentdb/odbc/documentdb_error.h"
+#include "documentdb/odbc/jni/documentdb_connection.h"
+#include "documentdb/odbc/jni/java.h"
+
+namespace documentdb {
+namespace odbc {
+/**
+ * Process-wide registry of internal SSH tunnels.
+ *
+ * Connections through the same SSH host, user and key to the same target
+ * share one tunnel instead of opening one each. The tunnel is opened by the
+ * first connection and closed when the last connection using it releases
+ * it. A tunnel that is not active anymore is opened again by the next
+ * connection that acquires it.
+ */
+class SshTunnelRegistry {
+ public:
+  /**
+   * Statistics of the tunnels.
+   */
+  struct Statistics {
+    /** Number of open tunnels. */
+    uint32_t tunnels = 0;
+
+    /** Number of tunnels opened. */
+    uint64_t opened = 0;
+
+    /** Number of acquisitions that reused an open tunnel. */
+    uint64_t reused = 0;
+
+    /** Number of references to the open tunnels. */
+    uint64_t inUse = 0;
+
+    /** Total setup time of the tunnels opened in milliseconds. */
+    uint64_t setupTimeMs = 0;
+
+    /** Longest setup time of a tunnel in milliseconds. */
+    uint64_t maxSetupTimeMs = 0;
+  };
+
+  /**
+   * Get the process-wide instance.
+   *
+   * @return Instance.
+   */
+  static SshTunnelRegistry& GetInstance();
+
+  /**
+   * Acquire the tunnel of the configuration, opening it if no connection of
+   * the process uses it yet.
+   *
+   * @param config Configuration with the SSH tunnel properties.
+   * @param ctx JNI context used to open the tunnel.
+   * @param err Set on error.
+   * @return Local port of the tunnel, or null on error. The tunnel is closed
+   *     when the last reference to it is released.
+   */
+  std::shared_ptr< const int32_t > Acquire(
+      const config::Configuration& config,
+      SharedPointer< jni::java::JniContext > ctx, DocumentDbError& err);
+
+  /**
+   * Get the statistics of all the tunnels.
+   *
+   * @return Statistics.
+   */
+  Statistics GetStatistics() const;
+
+ private:
+  /**
+   * Open tunnel.
+   */
+  struct Tunnel {
+    /** JDBC connection owning the tunnel. */
+    SharedPointer< jni::DocumentDbConnection > owner;
+
+    /** Local port of the tunnel. */
+    int32_t localPort = 0;
+
+    /** Number of references. */
+    uint64_t references = 0;
+  };
+
+  /**
+   * Constructor.
+   */
+  SshTunnelRegistry() = default;
+
+  SshTunnelRegistry(const SshTunnelRegistry&) = delete;
+
+  SshTunnelRegistry& operator=(const SshTunnelRegistry&) = delete;
+
+  /**
+   * Make the key of the tunnel of the configuration.
+   *
+   * @param config Configuration.
+   * @return Key.
+   */
+  static std::string MakeKey(const config::Configuration& config);
+
+  /**
+   * Open a tunnel.
+   *
+   * @param config Configuration with the SSH tunnel properties.
+   * @param ctx JNI context.
+   * @param localPort Set to the local port of the tunnel.
+   * @param err Set on error.
+   * @return JDBC connection owning the tunnel, or null on error.
+   */
+  static SharedPointer< jni::DocumentDbConnection > Open(
+      const config::Configuration& config,
+      SharedPointer< jni::java::JniContext > ctx, int32_t& localPort,
+      DocumentDbError& err);
+
+  /**
+   * Make a reference to a tunnel. The reference count must already account
+   * for it.
+   *
+   * @param key Key of the tunnel.
+   * @param tunnel Tunnel.
+   * @return Local port of the tunnel, releasing the reference when deleted.
+   */
+  std::shared_ptr< const int32_t > MakeReference(
+      const std::string& key, const std::shared_ptr< Tunnel >& tunnel);
+
+  /**
+   * Release a reference to a tunnel, closing it if it was the last one.
+   *
+   * @param key Key of the tunnel.
+   * @param tunnel Tunnel.
+   */
+  void Release(const std::string& key, const std::shared_ptr< Tunnel >& tunnel);
+
+  /** Open tunnels by key. */
+  std::map< std::string, std::shared_ptr< Tunnel > > tunnels_;
+
+  /** Number of tunnels opened. */
+  uint64_t opened_ = 0;
+
+  /** Number of acquisitions that reused an open tunnel. */
+  uint64_t reused_ = 0;
+
+  /** Total setup time in milliseconds. */
+  uint64_t setupTimeMs_ = 0;
+
+  /** Longest setup time in milliseconds. */
+  uint64_t maxSetupTimeMs_ = 0;
+
+  /** Tunnels lock. */
+  mutable common::concurrent::CriticalSection lock_;
+};
+}  // namespace odbc
+}  // namespace documentdb
+
+#endif  //_DOCUMENTDB_ODBC_SSH_TUNNEL_REGISTRY
@@ -25,6 +25,7 @@
 
 #include "documentdb/odbc/app/application_data_buffer.h"
 #include "documentdb/odbc/app/parameter_set.h"
+#include "documentdb/odbc/common/concurrent.h"
 #include "documentdb/odbc/common_types.h"
 #include "documentdb/odbc/diagnostic/diagnosable_adapter.h"
 #include "documentdb/odbc/meta/column_meta.h"
@@ -250,6 +251,14 @@ class Statement : public diagnostic::DiagnosableAdapter {
    */
   void Close();
 
+  /**
+   * Cancel statement processing.
+   *
+   * Only signals the current query to stop, so it can be called from
+   * another thread while a fetch is in progress.
+   */
+  void Cancel();
+
   /**
    * Fetch query result row with offset
    * @param orientation Fetch type
@@ -476,6 +485,15 @@ class Statement : public diagnostic::DiagnosableAdapter {
    */
   SqlResult::Type InternalClose();
 
+  /**
+   * Replace the current query. The previous query is destroyed outside of
+   * the current query lock, so that a concurrent cancel does not wait for
+   * it.
+   *
+   * @param qry New query. Can be null.
+   */
+  void SetCurrentQuery(query::Query* qry);
+
   /**
    * Process internal SQL command.
    *
@@ -683,13 +701,6 @@ class Statement : public diagnostic::DiagnosableAdapter {
    */
   SqlResult::Type UpdateParamsMeta();
 
-  /**
-   * Convert SQLRESULT to SQL_ROW_RESULT.
-   *
-   * @return Operation result.
-   */
-  uint16_t SqlResultToRowResult(SqlResult::Type value);
-
   /**
    * Constructor.
    * Called by friend classes.
@@ -707,6 +718,12 @@ class Statement : public diagnostic::DiagnosableAdapter {
   /** Underlying query. */
   std::unique_ptr< query::Query > currentQuery;
 
+  /**
+   * Current query lock. Held while the current query is replaced and while
+   * it is canceled from another thread.
+   */
+  common::concurrent::CriticalSection currentQueryLock;
+
   /** Buffer to store number of rows fetched by the last fetch. */
   SQLINTEGER* rowsFetched;
 
@@ -719,11 +736,17 @@ class Statement : public diagnostic::DiagnosableAdapter {
   /** Row array size. */
   SqlUlen rowArraySize;
 
+  /** Row binding type. Row structure size or SQL_BIND_BY_COLUMN. */
+  SqlUlen rowBindType;
+
   /** Parameters. */
   app::ParameterSet parameters;
 
   /** Query timeout in seconds. */
   int32_t timeout;
+
+  /** Number of result batches to prefetch in background. */
+  int32_t prefetchBatches;
 };
 }  // namespace odbc
 }  // namespace documentdb
@@ -34,6 +34,51 @@
 #include <odbcinst.h>
 #include <sqlext.h>
 
+#ifndef SQL_DRIVER_STMT_ATTR_BASE
+#define SQL_DRIVER_STMT_ATTR_BASE 0x00004000
+#endif  // SQL_DRIVER_STMT_ATTR_BASE
+
+/**
+ * Driver-specific statement attribute. Number of result batches to prefetch
+ * in background. Zero disables prefetching.
+ */
+#define SQL_ATTR_DOCUMENTDB_PREFETCH_BATCHES (SQL_DRIVER_STMT_ATTR_BASE + 1)
+
+/**
+ * Driver-specific read-only statement attributes. Statistics of the
+ * documents read by the last executed query: number of batches, number of
+ * documents, total document size in bytes, size of the last requested batch
+ * and total time spent waiting for batches in microseconds.
+ */
+#define SQL_ATTR_DOCUMENTDB_FETCH_BATCHES (SQL_DRIVER_STMT_ATTR_BASE + 2)
+#define SQL_ATTR_DOCUMENTDB_FETCH_DOCUMENTS (SQL_DRIVER_STMT_ATTR_BASE + 3)
+#define SQL_ATTR_DOCUMENTDB_FETCH_BYTES (SQL_DRIVER_STMT_ATTR_BASE + 4)
+#define SQL_ATTR_DOCUMENTDB_FETCH_BATCH_SIZE (SQL_DRIVER_STMT_ATTR_BASE + 5)
+#define SQL_ATTR_DOCUMENTDB_FETCH_TIME (SQL_DRIVER_STMT_ATTR_BASE + 6)
+
+#ifndef SQL_DRIVER_CONN_ATTR_BASE
+#define SQL_DRIVER_CONN_ATTR_BASE 0x00004000
+#endif  // SQL_DRIVER_CONN_ATTR_BASE
+
+/**
+ * Driver-specific write-only connection attribute. Setting it to any value
+ * drops the native catalog, so that it is loaded again from the database
+ * metadata on the next catalog function call.
+ */
+#define SQL_ATTR_DOCUMENTDB_REFRESH_CATALOG (SQL_DRIVER_CONN_ATTR_BASE + 1)
+
+#ifndef SQL_OV_ODBC3_80
+#define SQL_OV_ODBC3_80 380UL
+#endif  // SQL_OV_ODBC3_80
+
+#ifndef SQL_ATTR_RESET_CONNECTION
+#define SQL_ATTR_RESET_CONNECTION 116
+#endif  // SQL_ATTR_RESET_CONNECTION
+
+#ifndef SQL_RESET_CONNECTION_YES
+#define SQL_RESET_CONNECTION_YES 0UL
+#endif  // SQL_RESET_CONNECTION_YES
+
 #ifndef UNREFERENCED_PARAMETER
 #define UNREFERENCED_PARAMETER(x) (void)(x)
 #endif  // UNREFERENCED_PARAMETER
@@ -72,6 +72,21 @@ size_t CopyUtf8StringToSqlCharString(const char* inBuffer, SQLCHAR* outBuffer,
                                      size_t outBufferLenBytes,
                                      bool& isTruncated);
 
+/**
+ * Copy utf-8 string of the specific length to SQLCHAR buffer. Same as the
+ * function above, but the input does not need to be null-terminated.
+ * @param inBuffer UTF-8 string to copy data from.
+ * @param inBufferLen Length of the input string, in bytes.
+ * @param outBuffer SQLCHAR buffer to copy data to.
+ * @param outBufferLenBytes Length of the output buffer, in bytes.
+ * @return isTruncated Reference to indicator of whether the input string was
+ * truncated in the output buffer.
+ */
+size_t CopyUtf8StringToSqlCharString(const char* inBuffer, size_t inBufferLen,
+                                     SQLCHAR* outBuffer,
+                                     size_t outBufferLenBytes,
+                                     bool& isTruncated);
+
 /**
  * Copy utf-8 string to SQLWCHAR buffer of the specific length. It will ensure
  * null terminated result, possibly truncated.
@@ -91,6 +106,21 @@ size_t CopyUtf8StringToSqlWcharString(const char* inBuffer, SQLWCHAR* outBuffer,
                                       size_t outBufferLenBytes,
                                       bool& isTruncated);
 
+/**
+ * Copy utf-8 string of the specific length to SQLWCHAR buffer. Same as the
+ * function above, but the input does not need to be null-terminated.
+ * @param inBuffer UTF-8 string to copy data from.
+ * @param inBufferLen Length of the input string, in bytes.
+ * @param outBuffer SQLWCHAR buffer to copy data to.
+ * @param outBufferLenBytes Length of the output buffer, in bytes.
+ * @return isTruncated Reference to indicator of whether the input string was
+ * truncated in the output buffer.
+ */
+size_t CopyUtf8StringToSqlWcharString(const char* inBuffer, size_t inBufferLen,
+                                      SQLWCHAR* outBuffer,
+                                      size_t outBufferLenBytes,
+                                      bool& isTruncated);
+
 /**
  * Copy string to buffer of the specific length.
  * @param str String to copy data from.
@@ -128,6 +158,54 @@ void ReadString(BinaryReaderImpl& reader, std::string& str);
  */
 void WriteString(BinaryWriterImpl& writer, const std::string& str);
 
+/**
+ * Read optional string from reader.
+ * @param reader Reader.
+ * @param str String. Set to none if null was written.
+ */
+void ReadOptionalString(BinaryReaderImpl& reader,
+                        boost::optional< std::string >& str);
+
+/**
+ * Write optional string using writer.
+ * @param writer Writer.
+ * @param str String. Null is written if not set.
+ */
+void WriteOptionalString(BinaryWriterImpl& writer,
+                         const boost::optional< std::string >& str);
+
+/**
+ * Read optional 16-bit integer from reader.
+ * @param reader Reader.
+ * @param val Value. Set to none if it was not written as set.
+ */
+void ReadOptionalInt16(BinaryReaderImpl& reader,
+                       boost::optional< int16_t >& val);
+
+/**
+ * Write optional 16-bit integer using writer.
+ * @param writer Writer.
+ * @param val Value.
+ */
+void WriteOptionalInt16(BinaryWriterImpl& writer,
+                        const boost::optional< int16_t >& val);
+
+/**
+ * Read optional 32-bit integer from reader.
+ * @param reader Reader.
+ * @param val Value. Set to none if it was not written as set.
+ */
+void ReadOptionalInt32(BinaryReaderImpl& reader,
+                       boost::optional< int32_t >& val);
+
+/**
+ * Write optional 32-bit integer using writer.
+ * @param writer Writer.
+ * @param val Value.
+ */
+void WriteOptionalInt32(BinaryWriterImpl& writer,
+                        const boost::optional< int32_t >& val);
+
 /**
  * Read decimal value using reader.
  *
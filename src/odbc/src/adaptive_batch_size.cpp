@@ -0,0 +1,73 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "documentdb/odbc/adaptive_batch_size.h"
+
+#include <algorithm>
+
+namespace documentdb {
+namespace odbc {
+AdaptiveBatchSize::AdaptiveBatchSize(int32_t maxBatchSize,
+                                     int64_t memoryBudget,
+                                     int64_t rowArraySize)
+    : maxBatchSize_(std::max< int32_t >(maxBatchSize, 1)),
+      memoryBudget_(memoryBudget),
+      rowArraySize_(std::max< int64_t >(rowArraySize, 1)),
+      batchSize_(0) {
+  batchSize_ = GetFirstBatchSize();
+}
+
+int32_t AdaptiveBatchSize::GetFirstBatchSize() const {
+  return Adjust(std::max< int64_t >(FIRST_BATCH_SIZE, rowArraySize_));
+}
+
+int32_t AdaptiveBatchSize::GetNextBatchSize(int64_t documents, int64_t bytes,
+                                            int64_t elapsedUs) {
+  if (documents <= 0)
+    return batchSize_;
+
+  int64_t documentSize = std::max< int64_t >(bytes / documents, 1);
+
+  // Smooth the estimation, documents of a result are rarely uniform.
+  avgDocumentSize_ = avgDocumentSize_ == 0
+                         ? documentSize
+                         : (avgDocumentSize_ + documentSize) / 2;
+
+  int64_t size = static_cast< int64_t >(batchSize_) * GROWTH_FACTOR;
+
+  // Grow faster when the throughput allows it, but never slower.
+  if (elapsedUs > 0)
+    size = std::max(size, documents * TARGET_BATCH_TIME_US / elapsedUs);
+
+  if (memoryBudget_ > 0)
+    size = std::min(size, memoryBudget_ / avgDocumentSize_);
+
+  batchSize_ = Adjust(size);
+
+  return batchSize_;
+}
+
+int32_t AdaptiveBatchSize::Adjust(int64_t size) const {
+  if (rowArraySize_ > 1 && size > rowArraySize_)
+    size -= size % rowArraySize_;
+
+  size = std::min< int64_t >(size, maxBatchSize_);
+
+  return static_cast< int32_t >(std::max< int64_t >(size, 1));
+}
+}  // namespace odbc
+}  // namespace documentdb
@@ -40,7 +40,8 @@ ApplicationDataBuffer::ApplicationDataBuffer()
       buflen(0),
       reslen(0),
       byteOffset(0),
-      elementOffset(0) {
+      elementOffset(0),
+      bindType(SQL_BIND_BY_COLUMN) {
   // No-op.
 }
 
@@ -52,7 +53,8 @@ ApplicationDataBuffer::ApplicationDataBuffer(
       buflen(buflen),
       reslen(reslen),
       byteOffset(0),
-      elementOffset(0) {
+      elementOffset(0),
+      bindType(SQL_BIND_BY_COLUMN) {
   // No-op.
 }
 
@@ -62,7 +64,8 @@ ApplicationDataBuffer::ApplicationDataBuffer(const ApplicationDataBuffer& other)
       buflen(other.buflen),
       reslen(other.reslen),
       byteOffset(other.byteOffset),
-      elementOffset(other.elementOffset) {
+      elementOffset(other.elementOffset),
+      bindType(other.bindType) {
   // No-op.
 }
 
@@ -78,6 +81,7 @@ ApplicationDataBuffer& ApplicationDataBuffer::operator=(
   reslen = other.reslen;
   byteOffset = other.byteOffset;
   elementOffset = other.elementOffset;
+  bindType = other.bindType;
 
   return *this;
 }
@@ -232,12 +236,11 @@ ConversionResult::Type ApplicationDataBuffer::PutValToStrBuffer(
   return PutStrToStrBuffer< CharT >(converter.str(), written);
 }
 
-template < typename OutCharT, typename InCharT >
+template < typename OutCharT >
 ConversionResult::Type ApplicationDataBuffer::PutStrToStrBuffer(
-    const std::basic_string< InCharT >& value, int32_t& written) {
+    const char* value, size_t len, int32_t& written) {
   written = 0;
 
-  SqlLen inCharSize = static_cast< SqlLen >(sizeof(InCharT));
   SqlLen outCharSize = static_cast< SqlLen >(sizeof(OutCharT));
 
   SqlLen* resLenPtr = GetResLen();
@@ -251,23 +254,16 @@ ConversionResult::Type ApplicationDataBuffer::PutStrToStrBuffer(
 
   size_t lenWrittenOrRequired = 0;
   bool isTruncated = false;
-  if (inCharSize == 1) {
-    if (outCharSize == 2 || outCharSize == 4) {
-      lenWrittenOrRequired = utility::CopyUtf8StringToSqlWcharString(
-          reinterpret_cast< const char* >(value.c_str()),
-          reinterpret_cast< SQLWCHAR* >(dataPtr), buflen, isTruncated);
-    } else if (sizeof(OutCharT) == 1) {
-      lenWrittenOrRequired = utility::CopyUtf8StringToSqlCharString(
-          reinterpret_cast< const char* >(value.c_str()),
-          reinterpret_cast< SQLCHAR* >(dataPtr), buflen, isTruncated);
-    } else {
-      LOG_ERROR_MSG("Unexpected conversion from UTF8 string.");
-      assert(false);
-    }
+  if (outCharSize == 2 || outCharSize == 4) {
+    lenWrittenOrRequired = utility::CopyUtf8StringToSqlWcharString(
+        value, len, reinterpret_cast< SQLWCHAR* >(dataPtr), buflen,
+        isTruncated);
+  } else if (outCharSize == 1) {
+    lenWrittenOrRequired = utility::CopyUtf8StringToSqlCharString(
+        value, len, reinterpret_cast< SQLCHAR* >(dataPtr), buflen,
+        isTruncated);
   } else {
-    LOG_ERROR_MSG(
-        "Unexpected conversion from unknown type string, char size is "
-        << inCharSize);
+    LOG_ERROR_MSG("Unexpected conversion from UTF8 string.");
     assert(false);
   }
 
@@ -392,9 +388,22 @@ ConversionResult::Type ApplicationDataBuffer::PutString(
 
 ConversionResult::Type ApplicationDataBuffer::PutString(
     const std::string& value, int32_t& written) {
+  return PutString(value.data(), value.size(), written);
+}
+
+ConversionResult::Type ApplicationDataBuffer::PutString(const char* value,
+                                                        size_t len) {
+  int32_t written = 0;
+
+  return PutString(value, len, written);
+}
+
+ConversionResult::Type ApplicationDataBuffer::PutString(const char* value,
+                                                        size_t len,
+                                                        int32_t& written) {
   using namespace type_traits;
 
-  LOG_MSG("value: " << value);
+  LOG_MSG("value: " << std::string(value, len));
 
   switch (type) {
     case OdbcNativeType::AI_SIGNED_TINYINT:
@@ -409,13 +418,13 @@ ConversionResult::Type ApplicationDataBuffer::PutString(
     case OdbcNativeType::AI_NUMERIC: {
       std::stringstream converter;
 
-      converter << value;
+      converter.write(value, static_cast< std::streamsize >(len));
 
       int64_t numValue;
 
       converter >> numValue;
 
-      written = static_cast< int32_t >(value.size());
+      written = static_cast< int32_t >(len);
 
       return PutNum(numValue);
     }
@@ -424,13 +433,13 @@ ConversionResult::Type ApplicationDataBuffer::PutString(
     case OdbcNativeType::AI_DOUBLE: {
       std::stringstream converter;
 
-      converter << value;
+      converter.write(value, static_cast< std::streamsize >(len));
 
       double numValue;
 
       converter >> numValue;
 
-      written = static_cast< int32_t >(value.size());
+      written = static_cast< int32_t >(len);
 
       return PutNum(numValue);
     }
@@ -438,11 +447,11 @@ ConversionResult::Type ApplicationDataBuffer::PutString(
     case OdbcNativeType::AI_CHAR:
     case OdbcNativeType::AI_BINARY:
     case OdbcNativeType::AI_DEFAULT: {
-      return PutStrToStrBuffer< char >(value, written);
+      return PutStrToStrBuffer< char >(value, len, written);
     }
 
     case OdbcNativeType::AI_WCHAR: {
-      return PutStrToStrBuffer< SQLWCHAR >(value, written);
+      return PutStrToStrBuffer< SQLWCHAR >(value, len, written);
     }
 
     default:
@@ -540,6 +549,45 @@ ConversionResult::Type ApplicationDataBuffer::PutBinaryData(const void* data,
   return ConversionResult::Type::AI_UNSUPPORTED_CONVERSION;
 }
 
+ConversionResult::Type ApplicationDataBuffer::PutDataPart(const void* data,
+                                                          size_t len,
+                                                          size_t charSize,
+                                                          size_t& written) {
+  written = 0;
+
+  SqlLen* resLenPtr = GetResLen();
+  void* dataPtr = GetData();
+
+  if (resLenPtr)
+    *resLenPtr = static_cast< SqlLen >(len);
+
+  if (!dataPtr)
+    return ConversionResult::Type::AI_SUCCESS;
+
+  size_t bufLen = static_cast< size_t >(GetSize());
+  size_t capacity = bufLen;
+
+  if (charSize) {
+    if (bufLen < charSize)
+      return ConversionResult::Type::AI_VARLEN_DATA_TRUNCATED;
+
+    capacity = ((bufLen - charSize) / charSize) * charSize;
+  }
+
+  written = std::min(len, capacity);
+
+  if (written)
+    memcpy(dataPtr, data, written);
+
+  if (charSize)
+    memset(reinterpret_cast< int8_t* >(dataPtr) + written, 0, charSize);
+
+  if (written < len)
+    return ConversionResult::Type::AI_VARLEN_DATA_TRUNCATED;
+
+  return ConversionResult::Type::AI_SUCCESS;
+}
+
 ConversionResult::Type ApplicationDataBuffer::PutNull() {
   SqlLen* resLenPtr = GetResLen();
 
@@ -1674,8 +1722,12 @@ T* ApplicationDataBuffer::ApplyOffset(T* ptr, size_t elemSize) const {
   if (!ptr)
     return ptr;
 
+  size_t stride = bindType == SQL_BIND_BY_COLUMN
+                      ? elemSize
+                      : static_cast< size_t >(bindType);
+
   return utility::GetPointerWithOffset(ptr,
-                                       byteOffset + elemSize * elementOffset);
+                                       byteOffset + stride * elementOffset);
 }
 
 bool ApplicationDataBuffer::IsDataAtExec() const {
@@ -200,8 +200,25 @@ const ApplicationDataBuffer& Parameter::GetBuffer() const {
   return buffer;
 }
 
+int16_t Parameter::GetSqlType() const {
+  return sqlType;
+}
+
+size_t Parameter::GetColumnSize() const {
+  return columnSize;
+}
+
+bool Parameter::IsNull() const {
+  return nullData || buffer.GetInputSize() == SQL_NULL_DATA;
+}
+
+const std::vector< int8_t >& Parameter::GetStoredData() const {
+  return storedData;
+}
+
 void Parameter::ResetStoredData() {
   storedData.clear();
+  nullData = false;
 
   if (buffer.IsDataAtExec())
     storedData.reserve(buffer.GetDataAtExecSize());
@@ -57,7 +57,7 @@ void ParameterSet::SetParamBindOffsetPtr(int* ptr) {
   paramBindOffset = ptr;
 }
 
-int* ParameterSet::GetParamBindOffsetPtr() {
+int* ParameterSet::GetParamBindOffsetPtr() const {
   return paramBindOffset;
 }
 
@@ -145,6 +145,15 @@ Parameter* ParameterSet::GetParameter(uint16_t idx) {
   return 0;
 }
 
+const Parameter* ParameterSet::GetParameter(uint16_t idx) const {
+  ParameterBindingMap::const_iterator it = parameters.find(idx);
+
+  if (it != parameters.end())
+    return &it->second;
+
+  return 0;
+}
+
 Parameter* ParameterSet::GetSelectedParameter() {
   return GetParameter(currentParamIdx);
 }
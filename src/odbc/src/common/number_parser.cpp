@@ -0,0 +1,330 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "documentdb/odbc/common/number_parser.h"
+
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+
+namespace documentdb {
+namespace odbc {
+namespace common {
+namespace {
+/** Exponent bias of decimal128. */
+enum { DECIMAL128_EXPONENT_BIAS = 6176 };
+
+/** Largest coefficient of decimal128 (10^34 - 1), high and low words. */
+const uint64_t DECIMAL128_MAX_COEFFICIENT_HIGH = 0x0001ED09BEAD87C0ULL;
+const uint64_t DECIMAL128_MAX_COEFFICIENT_LOW = 0x378D8E63FFFFFFFFULL;
+
+/** Largest integer exactly representable by double. */
+const uint64_t DOUBLE_MAX_EXACT_INTEGER = 1ULL << 53;
+
+/** Powers of ten exactly representable by double. */
+const double EXACT_POWERS_OF_TEN[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+enum { MAX_EXACT_POWER_OF_TEN = 22 };
+
+/**
+ * Kind of decimal128 value.
+ */
+struct Decimal128Kind {
+  enum Type { FINITE, INFINITE, NOT_A_NUMBER };
+};
+
+/**
+ * Split decimal128 value into sign, coefficient and unbiased exponent.
+ *
+ * @return Kind of the value. Coefficient and exponent are only set for
+ *         finite values.
+ */
+Decimal128Kind::Type DecodeDecimal128(uint64_t high, uint64_t low,
+                                      bool& negative, uint64_t& coeffHigh,
+                                      uint64_t& coeffLow, int32_t& exponent) {
+  negative = (high >> 63) != 0;
+
+  uint64_t combination = (high >> 58) & 0x1F;
+  if (combination == 0x1F)
+    return Decimal128Kind::NOT_A_NUMBER;
+
+  if (combination == 0x1E)
+    return Decimal128Kind::INFINITE;
+
+  if (((high >> 61) & 0x3) == 0x3) {
+    // Coefficient would exceed 10^34 - 1, non-canonical zero.
+    exponent = static_cast< int32_t >((high >> 47) & 0x3FFF);
+    coeffHigh = 0;
+    coeffLow = 0;
+  } else {
+    exponent = static_cast< int32_t >((high >> 49) & 0x3FFF);
+    coeffHigh = high & 0x0001FFFFFFFFFFFFULL;
+    coeffLow = low;
+
+    if (coeffHigh > DECIMAL128_MAX_COEFFICIENT_HIGH
+        || (coeffHigh == DECIMAL128_MAX_COEFFICIENT_HIGH
+            && coeffLow > DECIMAL128_MAX_COEFFICIENT_LOW)) {
+      coeffHigh = 0;
+      coeffLow = 0;
+    }
+  }
+
+  exponent -= DECIMAL128_EXPONENT_BIAS;
+
+  return Decimal128Kind::FINITE;
+}
+
+/**
+ * Divide 128-bit unsigned integer by ten in place.
+ */
+void DivideByTen(uint64_t& high, uint64_t& low) {
+  uint32_t limbs[4] = {
+      static_cast< uint32_t >(high >> 32), static_cast< uint32_t >(high),
+      static_cast< uint32_t >(low >> 32), static_cast< uint32_t >(low)};
+
+  uint64_t remainder = 0;
+  for (int i = 0; i < 4; ++i) {
+    uint64_t current = (remainder << 32) | limbs[i];
+    limbs[i] = static_cast< uint32_t >(current / 10);
+    remainder = current % 10;
+  }
+
+  high = (static_cast< uint64_t >(limbs[0]) << 32) | limbs[1];
+  low = (static_cast< uint64_t >(limbs[2]) << 32) | limbs[3];
+}
+
+/**
+ * Get value of the digit in the given base.
+ *
+ * @return Digit value or -1 if the character is not a digit of the base.
+ */
+int DigitValue(char c, int base) {
+  int digit = -1;
+  if (c >= '0' && c <= '9')
+    digit = c - '0';
+  else if (c >= 'a' && c <= 'f')
+    digit = c - 'a' + 10;
+  else if (c >= 'A' && c <= 'F')
+    digit = c - 'A' + 10;
+
+  return digit < base ? digit : -1;
+}
+
+/**
+ * Parse real number with the C library function from a null-terminated
+ * copy of the string. Short strings are copied to the stack.
+ */
+template < typename T >
+bool ParseReal(const char* str, size_t len, T& value,
+               T (*convert)(const char*, char**)) {
+  char buffer[64];
+  std::string longStr;
+  const char* cstr = buffer;
+
+  if (len < sizeof(buffer)) {
+    memcpy(buffer, str, len);
+    buffer[len] = 0;
+  } else {
+    longStr.assign(str, len);
+    cstr = longStr.c_str();
+  }
+
+  char* end = nullptr;
+  errno = 0;
+  T res = convert(cstr, &end);
+
+  if (end == cstr || errno == ERANGE)
+    return false;
+
+  value = res;
+
+  return true;
+}
+
+double ConvertDouble(const char* str, char** end) {
+  return strtod(str, end);
+}
+
+float ConvertFloat(const char* str, char** end) {
+  return strtof(str, end);
+}
+}  // namespace
+
+bool ParseInt64(const char* str, size_t len, int64_t& value) {
+  const char* it = str;
+  const char* end = str + len;
+
+  while (it != end && isspace(static_cast< unsigned char >(*it)))
+    ++it;
+
+  bool negative = false;
+  if (it != end && (*it == '+' || *it == '-')) {
+    negative = *it == '-';
+    ++it;
+  }
+
+  int base = 10;
+  if (it != end && *it == '0') {
+    if (end - it > 2 && (it[1] == 'x' || it[1] == 'X')
+        && DigitValue(it[2], 16) >= 0) {
+      base = 16;
+      it += 2;
+    } else {
+      base = 8;
+    }
+  }
+
+  uint64_t limit = negative ? static_cast< uint64_t >(
+                                  std::numeric_limits< int64_t >::max())
+                                  + 1
+                            : static_cast< uint64_t >(
+                                std::numeric_limits< int64_t >::max());
+
+  uint64_t magnitude = 0;
+  bool hasDigits = false;
+  for (; it != end; ++it) {
+    int digit = DigitValue(*it, base);
+    if (digit < 0)
+      break;
+
+    if (magnitude > (limit - digit) / base)
+      return false;
+
+    magnitude = magnitude * base + digit;
+    hasDigits = true;
+  }
+
+  if (!hasDigits)
+    return false;
+
+  if (negative)
+    value = magnitude == limit ? std::numeric_limits< int64_t >::min()
+                               : -static_cast< int64_t >(magnitude);
+  else
+    value = static_cast< int64_t >(magnitude);
+
+  return true;
+}
+
+bool ParseDouble(const char* str, size_t len, double& value) {
+  return ParseReal< double >(str, len, value, &ConvertDouble);
+}
+
+bool ParseFloat(const char* str, size_t len, float& value) {
+  return ParseReal< float >(str, len, value, &ConvertFloat);
+}
+
+bool Decimal128ToInt64(uint64_t high, uint64_t low, int64_t& value) {
+  bool negative;
+  uint64_t coeffHigh;
+  uint64_t coeffLow;
+  int32_t exponent;
+
+  if (DecodeDecimal128(high, low, negative, coeffHigh, coeffLow, exponent)
+      != Decimal128Kind::FINITE)
+    return false;
+
+  // Drop the fractional digits. Coefficient has at most 34 digits.
+  while (exponent < 0 && (coeffHigh != 0 || coeffLow != 0)) {
+    DivideByTen(coeffHigh, coeffLow);
+    ++exponent;
+  }
+
+  if (coeffHigh == 0 && coeffLow == 0) {
+    value = 0;
+    return true;
+  }
+
+  if (coeffHigh != 0)
+    return false;
+
+  for (; exponent > 0; --exponent) {
+    if (coeffLow > std::numeric_limits< uint64_t >::max() / 10)
+      return false;
+
+    coeffLow *= 10;
+  }
+
+  uint64_t limit =
+      static_cast< uint64_t >(std::numeric_limits< int64_t >::max());
+  if (negative) {
+    if (coeffLow > limit + 1)
+      return false;
+
+    value = coeffLow == limit + 1 ? std::numeric_limits< int64_t >::min()
+                                  : -static_cast< int64_t >(coeffLow);
+  } else {
+    if (coeffLow > limit)
+      return false;
+
+    value = static_cast< int64_t >(coeffLow);
+  }
+
+  return true;
+}
+
+bool Decimal128ToDouble(uint64_t high, uint64_t low, double& value) {
+  bool negative;
+  uint64_t coeffHigh;
+  uint64_t coeffLow;
+  int32_t exponent;
+
+  switch (DecodeDecimal128(high, low, negative, coeffHigh, coeffLow,
+                           exponent)) {
+    case Decimal128Kind::NOT_A_NUMBER:
+      value = std::numeric_limits< double >::quiet_NaN();
+      return true;
+
+    case Decimal128Kind::INFINITE:
+      value = negative ? -std::numeric_limits< double >::infinity()
+                       : std::numeric_limits< double >::infinity();
+      return true;
+
+    default:
+      break;
+  }
+
+  if (coeffHigh == 0 && coeffLow == 0) {
+    value = negative ? -0.0 : 0.0;
+    return true;
+  }
+
+  // Both the coefficient and the power of ten are exact, so a single
+  // multiplication or division is correctly rounded.
+  if (coeffHigh != 0 || coeffLow > DOUBLE_MAX_EXACT_INTEGER
+      || exponent > MAX_EXACT_POWER_OF_TEN
+      || exponent < -MAX_EXACT_POWER_OF_TEN)
+    return false;
+
+  double res = static_cast< double >(coeffLow);
+  if (exponent >= 0)
+    res *= EXACT_POWERS_OF_TEN[exponent];
+  else
+    res /= EXACT_POWERS_OF_TEN[-exponent];
+
+  value = negative ? -res : res;
+
+  return true;
+}
+}  // namespace common
+}  // namespace odbc
+}  // namespace documentdb
@@ -75,6 +75,21 @@ const ReadPreference::Type Configuration::DefaultValue::readPreference =
 const std::string Configuration::DefaultValue::replicaSet = "";
 const bool Configuration::DefaultValue::retryReads = true;
 const int32_t Configuration::DefaultValue::defaultFetchSize = 2000;
+const int32_t Configuration::DefaultValue::prefetchBatches = 0;
+const int32_t Configuration::DefaultValue::prefetchMemoryLimit = 64;
+const bool Configuration::DefaultValue::adaptiveFetch = false;
+const int32_t Configuration::DefaultValue::fetchMemoryLimit = 4;
+const int32_t Configuration::DefaultValue::queryCacheSize = 100;
+const bool Configuration::DefaultValue::nativeQueryTranslation = true;
+const int32_t Configuration::DefaultValue::jvmInitialHeapSize = 256;
+const int32_t Configuration::DefaultValue::jvmMaxHeapSize = 1024;
+const std::string Configuration::DefaultValue::jvmGarbageCollector = "";
+const std::string Configuration::DefaultValue::jvmCdsArchive = "";
+const std::string Configuration::DefaultValue::metadataCacheDir = "";
+const int32_t Configuration::DefaultValue::metadataCacheTtl = 3600;
+const bool Configuration::DefaultValue::nativeCatalog = true;
+const int32_t Configuration::DefaultValue::maxPoolSize = 0;
+const int32_t Configuration::DefaultValue::minPoolSize = 0;
 
 std::string Configuration::ToConnectString() const {
   ArgumentMap arguments;
@@ -453,6 +468,186 @@ bool Configuration::IsDefaultFetchSizeSet() const {
   return defaultFetchSize.IsSet();
 }
 
+int32_t Configuration::GetPrefetchBatches() const {
+  return prefetchBatches.GetValue();
+}
+
+void Configuration::SetPrefetchBatches(int32_t batches) {
+  this->prefetchBatches.SetValue(batches);
+}
+
+bool Configuration::IsPrefetchBatchesSet() const {
+  return prefetchBatches.IsSet();
+}
+
+int32_t Configuration::GetPrefetchMemoryLimit() const {
+  return prefetchMemoryLimit.GetValue();
+}
+
+void Configuration::SetPrefetchMemoryLimit(int32_t limit) {
+  this->prefetchMemoryLimit.SetValue(limit);
+}
+
+bool Configuration::IsPrefetchMemoryLimitSet() const {
+  return prefetchMemoryLimit.IsSet();
+}
+
+bool Configuration::IsAdaptiveFetch() const {
+  return adaptiveFetch.GetValue();
+}
+
+void Configuration::SetAdaptiveFetch(bool val) {
+  this->adaptiveFetch.SetValue(val);
+}
+
+bool Configuration::IsAdaptiveFetchSet() const {
+  return adaptiveFetch.IsSet();
+}
+
+int32_t Configuration::GetFetchMemoryLimit() const {
+  return fetchMemoryLimit.GetValue();
+}
+
+void Configuration::SetFetchMemoryLimit(int32_t limit) {
+  this->fetchMemoryLimit.SetValue(limit);
+}
+
+bool Configuration::IsFetchMemoryLimitSet() const {
+  return fetchMemoryLimit.IsSet();
+}
+
+int32_t Configuration::GetQueryCacheSize() const {
+  return queryCacheSize.GetValue();
+}
+
+void Configuration::SetQueryCacheSize(int32_t size) {
+  this->queryCacheSize.SetValue(size);
+}
+
+bool Configuration::IsQueryCacheSizeSet() const {
+  return queryCacheSize.IsSet();
+}
+
+bool Configuration::IsNativeQueryTranslation() const {
+  return nativeQueryTranslation.GetValue();
+}
+
+void Configuration::SetNativeQueryTranslation(bool val) {
+  this->nativeQueryTranslation.SetValue(val);
+}
+
+bool Configuration::IsNativeQueryTranslationSet() const {
+  return nativeQueryTranslation.IsSet();
+}
+
+int32_t Configuration::GetJvmInitialHeapSize() const {
+  return jvmInitialHeapSize.GetValue();
+}
+
+void Configuration::SetJvmInitialHeapSize(int32_t size) {
+  this->jvmInitialHeapSize.SetValue(size);
+}
+
+bool Configuration::IsJvmInitialHeapSizeSet() const {
+  return jvmInitialHeapSize.IsSet();
+}
+
+int32_t Configuration::GetJvmMaxHeapSize() const {
+  return jvmMaxHeapSize.GetValue();
+}
+
+void Configuration::SetJvmMaxHeapSize(int32_t size) {
+  this->jvmMaxHeapSize.SetValue(size);
+}
+
+bool Configuration::IsJvmMaxHeapSizeSet() const {
+  return jvmMaxHeapSize.IsSet();
+}
+
+const std::string& Configuration::GetJvmGarbageCollector() const {
+  return jvmGarbageCollector.GetValue();
+}
+
+void Configuration::SetJvmGarbageCollector(const std::string& gc) {
+  this->jvmGarbageCollector.SetValue(gc);
+}
+
+bool Configuration::IsJvmGarbageCollectorSet() const {
+  return jvmGarbageCollector.IsSet();
+}
+
+const std::string& Configuration::GetJvmCdsArchive() const {
+  return jvmCdsArchive.GetValue();
+}
+
+void Configuration::SetJvmCdsArchive(const std::string& path) {
+  this->jvmCdsArchive.SetValue(path);
+}
+
+bool Configuration::IsJvmCdsArchiveSet() const {
+  return jvmCdsArchive.IsSet();
+}
+
+const std::string& Configuration::GetMetadataCacheDir() const {
+  return metadataCacheDir.GetValue();
+}
+
+void Configuration::SetMetadataCacheDir(const std::string& dir) {
+  this->metadataCacheDir.SetValue(dir);
+}
+
+bool Configuration::IsMetadataCacheDirSet() const {
+  return metadataCacheDir.IsSet();
+}
+
+int32_t Configuration::GetMetadataCacheTtl() const {
+  return metadataCacheTtl.GetValue();
+}
+
+void Configuration::SetMetadataCacheTtl(int32_t ttl) {
+  this->metadataCacheTtl.SetValue(ttl);
+}
+
+bool Configuration::IsMetadataCacheTtlSet() const {
+  return metadataCacheTtl.IsSet();
+}
+
+bool Configuration::IsNativeCatalog() const {
+  return nativeCatalog.GetValue();
+}
+
+void Configuration::SetNativeCatalog(bool nativeCatalog) {
+  this->nativeCatalog.SetValue(nativeCatalog);
+}
+
+bool Configuration::IsNativeCatalogSet() const {
+  return nativeCatalog.IsSet();
+}
+
+int32_t Configuration::GetMaxPoolSize() const {
+  return maxPoolSize.GetValue();
+}
+
+void Configuration::SetMaxPoolSize(int32_t size) {
+  this->maxPoolSize.SetValue(size);
+}
+
+bool Configuration::IsMaxPoolSizeSet() const {
+  return maxPoolSize.IsSet();
+}
+
+int32_t Configuration::GetMinPoolSize() const {
+  return minPoolSize.GetValue();
+}
+
+void Configuration::SetMinPoolSize(int32_t size) {
+  this->minPoolSize.SetValue(size);
+}
+
+bool Configuration::IsMinPoolSizeSet() const {
+  return minPoolSize.IsSet();
+}
+
 void Configuration::ToMap(ArgumentMap& res) const {
   AddToMap(res, ConnectionStringParser::Key::dsn, dsn);
   AddToMap(res, ConnectionStringParser::Key::driver, driver);
@@ -490,6 +685,29 @@ void Configuration::ToMap(ArgumentMap& res) const {
   AddToMap(res, ConnectionStringParser::Key::refreshSchema, refreshSchema);
   AddToMap(res, ConnectionStringParser::Key::defaultFetchSize,
            defaultFetchSize);
+  AddToMap(res, ConnectionStringParser::Key::prefetchBatches,
+           prefetchBatches);
+  AddToMap(res, ConnectionStringParser::Key::prefetchMemoryLimit,
+           prefetchMemoryLimit);
+  AddToMap(res, ConnectionStringParser::Key::adaptiveFetch, adaptiveFetch);
+  AddToMap(res, ConnectionStringParser::Key::fetchMemoryLimit,
+           fetchMemoryLimit);
+  AddToMap(res, ConnectionStringParser::Key::queryCacheSize, queryCacheSize);
+  AddToMap(res, ConnectionStringParser::Key::nativeQueryTranslation,
+           nativeQueryTranslation);
+  AddToMap(res, ConnectionStringParser::Key::jvmInitialHeapSize,
+           jvmInitialHeapSize);
+  AddToMap(res, ConnectionStringParser::Key::jvmMaxHeapSize, jvmMaxHeapSize);
+  AddToMap(res, ConnectionStringParser::Key::jvmGarbageCollector,
+           jvmGarbageCollector);
+  AddToMap(res, ConnectionStringParser::Key::jvmCdsArchive, jvmCdsArchive);
+  AddToMap(res, ConnectionStringParser::Key::metadataCacheDir,
+           metadataCacheDir);
+  AddToMap(res, ConnectionStringParser::Key::metadataCacheTtl,
+           metadataCacheTtl);
+  AddToMap(res, ConnectionStringParser::Key::nativeCatalog, nativeCatalog);
+  AddToMap(res, ConnectionStringParser::Key::maxPoolSize, maxPoolSize);
+  AddToMap(res, ConnectionStringParser::Key::minPoolSize, minPoolSize);
 }
 
 void Configuration::Validate() const {
@@ -510,16 +728,38 @@ void Configuration::Validate() const {
                     "If using an internal SSH tunnel, all of ssh_host, "
                     "ssh_user, ssh_private_key_file are required to connect.");
   }
+
+  // The default initial size is lowered to a smaller maximum size when the
+  // JVM options are built.
+  if (IsJvmInitialHeapSizeSet() && IsJvmMaxHeapSizeSet()
+      && GetJvmInitialHeapSize() > GetJvmMaxHeapSize()) {
+    throw OdbcError(SqlState::S01S00_INVALID_CONNECTION_STRING_ATTRIBUTE,
+                    "jvm_initial_heap_size must not be greater than "
+                    "jvm_max_heap_size.");
+  }
 }
 
 std::string Configuration::ToJdbcConnectionString() const {
+  return ToJdbcConnectionString(0);
+}
+
+std::string Configuration::ToJdbcConnectionString(
+    int32_t localSSHTunnelPort) const {
+  std::string host = "localhost";
+  std::string port = std::to_string(localSSHTunnelPort);
+
+  // localSSHTunnelPort == 0 means that the JDBC driver opens the SSH tunnel
+  // itself, if one is configured.
+  if (localSSHTunnelPort == 0) {
+    host = GetHostname();
+    port = common::LexicalCast< std::string >(GetPort());
+  }
   std::string jdbcConnectionString;
   jdbcConnectionString = "jdbc:documentdb:";
   jdbcConnectionString.append("//" + EncodeURIComponent(GetUser()));
   jdbcConnectionString.append(":" + EncodeURIComponent(GetPassword()));
-  jdbcConnectionString.append("@" + GetHostname());
-  jdbcConnectionString.append(":"
-                              + common::LexicalCast< std::string >(GetPort()));
+  jdbcConnectionString.append("@" + host);
+  jdbcConnectionString.append(":" + port);
   jdbcConnectionString.append("/" + EncodeURIComponent(GetDatabase()));
   // Always pass application name even when unset to override the JDBC default
   // application name.
@@ -534,6 +774,8 @@ std::string Configuration::ToJdbcConnectionString() const {
        it != arguments.end(); ++it) {
     const std::string& key = it->first;
     const std::string& value = it->second;
+    if (localSSHTunnelPort != 0 && key.compare(0, 3, "ssh") == 0)
+      continue;
     if (key != "logLevel" && key != "logPath" && !value.empty())
       options << '&' << key << '=' << EncodeURIComponent(value);
   }
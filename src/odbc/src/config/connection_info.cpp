@@ -590,7 +590,7 @@ ConnectionInfo::ConnectionInfo(const Configuration& config)
 
   // ODBC version.
 #ifdef SQL_DRIVER_ODBC_VER
-  strParams[SQL_DRIVER_ODBC_VER] = "03.00";
+  strParams[SQL_DRIVER_ODBC_VER] = "03.80";
 #endif  // SQL_DRIVER_ODBC_VER
 
 #ifdef SQL_DRIVER_VER
@@ -63,6 +63,33 @@ const std::string ConnectionStringParser::Key::schemaName = "schema_name";
 const std::string ConnectionStringParser::Key::refreshSchema = "refresh_schema";
 const std::string ConnectionStringParser::Key::defaultFetchSize =
     "default_fetch_size";
+const std::string ConnectionStringParser::Key::prefetchBatches =
+    "prefetch_batches";
+const std::string ConnectionStringParser::Key::prefetchMemoryLimit =
+    "prefetch_memory_limit";
+const std::string ConnectionStringParser::Key::adaptiveFetch =
+    "adaptive_fetch";
+const std::string ConnectionStringParser::Key::fetchMemoryLimit =
+    "fetch_memory_limit";
+const std::string ConnectionStringParser::Key::queryCacheSize =
+    "query_cache_size";
+const std::string ConnectionStringParser::Key::nativeQueryTranslation =
+    "native_query_translation";
+const std::string ConnectionStringParser::Key::jvmInitialHeapSize =
+    "jvm_initial_heap_size";
+const std::string ConnectionStringParser::Key::jvmMaxHeapSize =
+    "jvm_max_heap_size";
+const std::string ConnectionStringParser::Key::jvmGarbageCollector =
+    "jvm_garbage_collector";
+const std::string ConnectionStringParser::Key::jvmCdsArchive =
+    "jvm_cds_archive";
+const std::string ConnectionStringParser::Key::metadataCacheDir =
+    "metadata_cache_dir";
+const std::string ConnectionStringParser::Key::metadataCacheTtl =
+    "metadata_cache_ttl";
+const std::string ConnectionStringParser::Key::nativeCatalog = "native_catalog";
+const std::string ConnectionStringParser::Key::maxPoolSize = "max_pool_size";
+const std::string ConnectionStringParser::Key::minPoolSize = "min_pool_size";
 const std::string ConnectionStringParser::Key::uid = "uid";
 const std::string ConnectionStringParser::Key::pwd = "pwd";
 
@@ -476,6 +503,445 @@ void ConnectionStringParser::HandleAttributePair(
     }
 
     cfg.SetDefaultFetchSize(static_cast< int32_t >(numValue));
+  } else if (lKey == Key::prefetchBatches) {
+    if (!common::AllDigits(value)) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Prefetch batches attribute value contains "
+                             "unexpected characters."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (value.size() >= sizeof(std::to_string(UINT32_MAX))) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Prefetch batches attribute value is too large."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    int64_t numValue = 0;
+    std::stringstream conv;
+
+    conv << value;
+    conv >> numValue;
+
+    if (numValue < 0 || numValue > INT32_MAX) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Prefetch batches attribute value is out of range."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetPrefetchBatches(static_cast< int32_t >(numValue));
+  } else if (lKey == Key::prefetchMemoryLimit) {
+    if (!common::AllDigits(value)) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Prefetch memory limit attribute value contains "
+                             "unexpected characters."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (value.size() >= sizeof(std::to_string(UINT32_MAX))) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Prefetch memory limit attribute value is too large."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    int64_t numValue = 0;
+    std::stringstream conv;
+
+    conv << value;
+    conv >> numValue;
+
+    if (numValue <= 0 || numValue > INT32_MAX) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Prefetch memory limit attribute value is out of range."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetPrefetchMemoryLimit(static_cast< int32_t >(numValue));
+  } else if (lKey == Key::adaptiveFetch) {
+    BoolParseResult::Type res = StringToBool(value);
+
+    if (res == BoolParseResult::Type::AI_UNRECOGNIZED) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Unrecognized bool value. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetAdaptiveFetch(res == BoolParseResult::Type::AI_TRUE);
+  } else if (lKey == Key::fetchMemoryLimit) {
+    if (!common::AllDigits(value)) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Fetch memory limit attribute value contains "
+                             "unexpected characters."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (value.size() >= sizeof(std::to_string(UINT32_MAX))) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Fetch memory limit attribute value is too large."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    int64_t numValue = 0;
+    std::stringstream conv;
+
+    conv << value;
+    conv >> numValue;
+
+    if (numValue <= 0 || numValue > INT32_MAX) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Fetch memory limit attribute value is out of "
+                             "range. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetFetchMemoryLimit(static_cast< int32_t >(numValue));
+  } else if (lKey == Key::queryCacheSize) {
+    if (!common::AllDigits(value)) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Query cache size attribute value contains "
+                             "unexpected characters."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (value.size() >= sizeof(std::to_string(UINT32_MAX))) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Query cache size attribute value is too large."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    int64_t numValue = 0;
+    std::stringstream conv;
+
+    conv << value;
+    conv >> numValue;
+
+    if (numValue < 0 || numValue > INT32_MAX) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Query cache size attribute value is out of "
+                             "range. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetQueryCacheSize(static_cast< int32_t >(numValue));
+  } else if (lKey == Key::nativeQueryTranslation) {
+    BoolParseResult::Type res = StringToBool(value);
+
+    if (res == BoolParseResult::Type::AI_UNRECOGNIZED) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Unrecognized bool value. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetNativeQueryTranslation(res == BoolParseResult::Type::AI_TRUE);
+  } else if (lKey == Key::jvmInitialHeapSize) {
+    if (!common::AllDigits(value)) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("JVM initial heap size attribute value contains "
+                             "unexpected characters."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (value.size() >= sizeof(std::to_string(UINT32_MAX))) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("JVM initial heap size attribute value is too "
+                             "large. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    int64_t numValue = 0;
+    std::stringstream conv;
+
+    conv << value;
+    conv >> numValue;
+
+    if (numValue <= 0 || numValue > INT32_MAX) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("JVM initial heap size attribute value is out of "
+                             "range. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetJvmInitialHeapSize(static_cast< int32_t >(numValue));
+  } else if (lKey == Key::jvmMaxHeapSize) {
+    if (!common::AllDigits(value)) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("JVM maximum heap size attribute value contains "
+                             "unexpected characters."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (value.size() >= sizeof(std::to_string(UINT32_MAX))) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("JVM maximum heap size attribute value is too "
+                             "large. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    int64_t numValue = 0;
+    std::stringstream conv;
+
+    conv << value;
+    conv >> numValue;
+
+    if (numValue <= 0 || numValue > INT32_MAX) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("JVM maximum heap size attribute value is out of "
+                             "range. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetJvmMaxHeapSize(static_cast< int32_t >(numValue));
+  } else if (lKey == Key::jvmGarbageCollector) {
+    std::string gc = common::ToLower(value);
+
+    if (gc != "serial" && gc != "parallel" && gc != "g1") {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Specified JVM garbage collector is not "
+                             "supported. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetJvmGarbageCollector(gc);
+  } else if (lKey == Key::jvmCdsArchive) {
+    cfg.SetJvmCdsArchive(value);
+  } else if (lKey == Key::metadataCacheDir) {
+    cfg.SetMetadataCacheDir(value);
+  } else if (lKey == Key::metadataCacheTtl) {
+    if (!common::AllDigits(value)) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Metadata cache TTL attribute value contains "
+                             "unexpected characters."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (value.size() >= sizeof(std::to_string(UINT32_MAX))) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Metadata cache TTL attribute value is too large."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    int64_t numValue = 0;
+    std::stringstream conv;
+
+    conv << value;
+    conv >> numValue;
+
+    if (numValue <= 0 || numValue > INT32_MAX) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Metadata cache TTL attribute value is out of "
+                             "range. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetMetadataCacheTtl(static_cast< int32_t >(numValue));
+  } else if (lKey == Key::nativeCatalog) {
+    BoolParseResult::Type res = StringToBool(value);
+
+    if (res == BoolParseResult::Type::AI_UNRECOGNIZED) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Unrecognized bool value. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetNativeCatalog(res == BoolParseResult::Type::AI_TRUE);
+  } else if (lKey == Key::maxPoolSize) {
+    if (!common::AllDigits(value)) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Maximum pool size attribute value contains "
+                             "unexpected characters."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (value.size() >= sizeof(std::to_string(UINT32_MAX))) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Maximum pool size attribute value is too large."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    int64_t numValue = 0;
+    std::stringstream conv;
+
+    conv << value;
+    conv >> numValue;
+
+    if (numValue < 0 || numValue > INT32_MAX) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Maximum pool size attribute value is out of "
+                             "range. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetMaxPoolSize(static_cast< int32_t >(numValue));
+  } else if (lKey == Key::minPoolSize) {
+    if (!common::AllDigits(value)) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Minimum pool size attribute value contains "
+                             "unexpected characters."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (value.size() >= sizeof(std::to_string(UINT32_MAX))) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Minimum pool size attribute value is too large."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    int64_t numValue = 0;
+    std::stringstream conv;
+
+    conv << value;
+    conv >> numValue;
+
+    if (numValue < 0 || numValue > INT32_MAX) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Minimum pool size attribute value is out of "
+                             "range. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetMinPoolSize(static_cast< int32_t >(numValue));
   } else if (lKey == Key::driver) {
     cfg.SetDriver(value);
   } else if (lKey == Key::user || lKey == Key::uid) {
@@ -20,6 +20,7 @@
 #include <documentdb/odbc/documentdb_error.h>
 
 #include <algorithm>
+#include <atomic>
 #include <bsoncxx/builder/basic/document.hpp>
 #include <bsoncxx/builder/stream/array.hpp>
 #include <bsoncxx/builder/stream/document.hpp>
@@ -29,13 +30,17 @@
 #include <bsoncxx/stdx/string_view.hpp>
 #include <cstddef>
 #include <cstring>
+#include <functional>
+#include <future>
 #include <mongocxx/client.hpp>
 #include <mongocxx/exception/exception.hpp>
 #include <mongocxx/uri.hpp>
 #include <sstream>
+#include <thread>
 
 #include "documentdb/odbc/driver_instance.h"
 #include "documentdb/odbc/common/concurrent.h"
+#include "documentdb/odbc/common/platform_utils.h"
 #include "documentdb/odbc/common/utils.h"
 #include "documentdb/odbc/config/configuration.h"
 #include "documentdb/odbc/config/connection_string_parser.h"
@@ -44,9 +49,13 @@
 #include "documentdb/odbc/jni/database_metadata.h"
 #include "documentdb/odbc/jni/documentdb_connection.h"
 #include "documentdb/odbc/jni/java.h"
+#include "documentdb/odbc/jni/jvm_prewarm.h"
 #include "documentdb/odbc/jni/utils.h"
 #include "documentdb/odbc/log.h"
 #include "documentdb/odbc/message.h"
+#include "documentdb/odbc/mongo_client_pool_registry.h"
+#include "documentdb/odbc/sql/sql_select_translator.h"
+#include "documentdb/odbc/ssh_tunnel_registry.h"
 #include "documentdb/odbc/ssl_mode.h"
 #include "documentdb/odbc/statement.h"
 #include "documentdb/odbc/system/system_dsn.h"
@@ -58,9 +67,11 @@ using namespace documentdb::odbc::common::concurrent;
 using documentdb::odbc::DocumentDbError;
 using documentdb::odbc::jni::DatabaseMetaData;
 using documentdb::odbc::jni::DocumentDbConnection;
+using documentdb::odbc::jni::ResultSet;
 using documentdb::odbc::jni::java::BuildJvmOptions;
 using documentdb::odbc::jni::java::JniErrorCode;
 using documentdb::odbc::jni::java::JniHandlers;
+using documentdb::odbc::jni::java::JvmSettings;
 
 // Uncomment for per-byte debug.
 //#define PER_BYTE_DEBUG
@@ -71,11 +82,15 @@ struct OdbcProtocolHeader {
   int32_t len;
 };
 #pragma pack(pop)
+
+/** Number of table translations kept for the native query translation. */
+const size_t TABLE_QUERY_CACHE_SIZE = 64;
 }  // namespace
 
 namespace documentdb {
 namespace odbc {
-Connection::Connection(Environment* env) : env_(env), info_(config_) {
+Connection::Connection(Environment* env)
+    : env_(env), info_(config_), tableQueryCache_(TABLE_QUERY_CACHE_SIZE) {
   // No-op
 }
 
@@ -103,6 +118,13 @@ void Connection::GetInfo(config::ConnectionInfo::InfoType type, void* buf,
 SqlResult::Type Connection::InternalGetInfo(
     config::ConnectionInfo::InfoType type, void* buf, short buflen,
     short* reslen) {
+#ifdef SQL_DBMS_VER
+  // The server version is only fetched when it is first asked for, so that
+  // connecting does not wait for it.
+  if (type == SQL_DBMS_VER)
+    UpdateDbmsVerInfo();
+#endif  // SQL_DBMS_VER
+
   const config::ConnectionInfo& info = GetInfo();
 
   SqlResult::Type res = info.GetInfo(type, buf, buflen, reslen);
@@ -178,6 +200,10 @@ SqlResult::Type Connection::InternalEstablish(
     return SqlResult::AI_ERROR;
   }
 
+  OpenMetadataCache();
+
+  establishedLoginTimeout_ = config_.GetLoginTimeoutSeconds();
+
   bool errors = GetDiagnosticRecords().GetStatusRecordsNumber() > 0;
 
   return errors ? SqlResult::AI_SUCCESS_WITH_INFO : SqlResult::AI_SUCCESS;
@@ -216,7 +242,51 @@ void Connection::Close() {
       }
       connection_ = nullptr;
     }
+    DumpSharedArchive();
+  }
+
+  {
+    CsLockGuard guard(catalogLock_);
+    catalog_.reset();
+  }
+
+  bool pooled = false;
+  {
+    // Pooled clients go back to their pool.
+    CsLockGuard guard(mongoClientLock_);
+    pooled = mongoClient_ && config_.GetMaxPoolSize() > 0;
+    mongoClient_.reset();
+    dbmsVerUpdated_ = false;
+  }
+
+  if (sshTunnel_) {
+    // The tunnel is closed with the last connection using it.
+    sshTunnel_.reset();
+
+    SshTunnelRegistry::Statistics stats =
+        SshTunnelRegistry::GetInstance().GetStatistics();
+
+    LOG_DEBUG_MSG("SSH tunnels. tunnels: "
+                  << stats.tunnels << ", opened: " << stats.opened
+                  << ", reused: " << stats.reused << ", in use: "
+                  << stats.inUse << ", setup time (ms): " << stats.setupTimeMs
+                  << ", max setup time (ms): " << stats.maxSetupTimeMs);
   }
+
+  if (pooled) {
+    MongoClientPoolRegistry::Statistics stats =
+        MongoClientPoolRegistry::GetInstance().GetStatistics();
+
+    LOG_DEBUG_MSG("Client pools. pools: "
+                  << stats.pools << ", acquired: " << stats.acquired
+                  << ", in use: " << stats.inUse << ", waits: " << stats.waits
+                  << ", waiting: " << stats.waiting
+                  << ", wait time (ms): " << stats.waitTimeMs
+                  << ", max wait time (ms): " << stats.maxWaitTimeMs);
+  }
+
+  CloseMetadataCache();
+  ResetQueryMapping();
 }
 
 Statement* Connection::CreateStatement() {
@@ -246,11 +316,21 @@ SharedPointer< DatabaseMetaData > Connection::GetMetaData(DocumentDbError& err)
 
 SharedPointer< DocumentDbDatabaseMetadata > Connection::GetDatabaseMetadata(
     DocumentDbError& err) {
+  CsLockGuard guard(queryMappingLock_);
+
+  return InternalGetDatabaseMetadata(err);
+}
+
+SharedPointer< DocumentDbDatabaseMetadata >
+Connection::InternalGetDatabaseMetadata(DocumentDbError& err) {
   if (!connection_.IsValid()) {
     err = DocumentDbError(DocumentDbError::DOCUMENTDB_ERR_ILLEGAL_STATE,
                       "Must be connected.");
     return nullptr;
   }
+  if (databaseMetadata_.IsValid()) {
+    return databaseMetadata_;
+  }
   JniErrorInfo errInfo;
   auto documentDbDatabaseMetaData =
       connection_.Get()->GetDatabaseMetadata(errInfo);
@@ -261,6 +341,7 @@ SharedPointer< DocumentDbDatabaseMetadata > Connection::GetDatabaseMetadata(
         message.c_str());
     return nullptr;
   }
+  databaseMetadata_ = documentDbDatabaseMetaData;
   return documentDbDatabaseMetaData;
 }
 
@@ -284,6 +365,227 @@ Connection::GetConnectionProperties(DocumentDbError& err) {
   return connectionProperties;
 }
 
+SharedPointer< DocumentDbMqlQueryContext > Connection::GetMqlQueryContext(
+    const std::string& sql, DocumentDbError& err) {
+  CsLockGuard guard(queryMappingLock_);
+
+  std::string key;
+  bool cached =
+      mqlQueryCache_.GetCapacity() > 0 && MakeMqlQueryCacheKey(sql, key);
+
+  SharedPointer< DocumentDbMqlQueryContext > mqlQueryContext;
+  if (cached) {
+    bool found = mqlQueryCache_.Get(key, mqlQueryContext);
+
+    LOG_DEBUG_MSG("Query cache " << (found ? "hit" : "miss")
+                                 << ". hits: " << mqlQueryCache_.GetHits()
+                                 << ", misses: " << mqlQueryCache_.GetMisses()
+                                 << ", size: " << mqlQueryCache_.GetSize());
+
+    // A null entry only means that the translation has to be made again.
+    if (found && mqlQueryContext.IsValid())
+      return mqlQueryContext;
+
+    if (config_.IsNativeQueryTranslation()) {
+      mqlQueryContext = TranslateByShape(sql);
+      if (mqlQueryContext.IsValid())
+        return mqlQueryContext;
+    }
+  }
+
+  if (config_.IsNativeQueryTranslation())
+    mqlQueryContext = TranslateNatively(sql);
+
+  if (!mqlQueryContext.IsValid()) {
+    mqlQueryContext = TranslateWithJvm(sql, err);
+    if (!mqlQueryContext.IsValid())
+      return nullptr;
+  }
+
+  if (cached)
+    mqlQueryCache_.Put(key, mqlQueryContext);
+
+  return mqlQueryContext;
+}
+
+SharedPointer< DocumentDbMqlQueryContext > Connection::TranslateWithJvm(
+    const std::string& sql, DocumentDbError& err) {
+  SharedPointer< DocumentDbQueryMappingService > queryMappingService =
+      GetQueryMappingService(err);
+  if (!queryMappingService.IsValid())
+    return nullptr;
+
+  JniErrorInfo errInfo;
+  SharedPointer< DocumentDbMqlQueryContext > mqlQueryContext =
+      queryMappingService.Get()->GetMqlQueryContext(sql, 0, errInfo);
+  if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
+    DocumentDbError::SetError(errInfo.code, errInfo.errCls.c_str(),
+                              errInfo.errMsg.c_str(), err);
+    return nullptr;
+  }
+
+  return mqlQueryContext;
+}
+
+SharedPointer< DocumentDbMqlQueryContext > Connection::TranslateNatively(
+    const std::string& sql) {
+  std::shared_ptr< SqlSelectCommand > select = SqlSelectTranslator::Parse(sql);
+  if (!select)
+    return nullptr;
+
+  std::string tableQuery = SqlSelectTranslator::GetTableQuery(*select);
+
+  SharedPointer< DocumentDbMqlQueryContext > tableContext;
+  if (!tableQueryCache_.Get(tableQuery, tableContext)) {
+    DocumentDbError err;
+    tableContext = TranslateWithJvm(tableQuery, err);
+    if (!tableContext.IsValid()) {
+      LOG_DEBUG_MSG("Table query translation failed: " << err.GetText());
+      return nullptr;
+    }
+
+    tableQueryCache_.Put(tableQuery, tableContext);
+  }
+
+  SharedPointer< DocumentDbMqlQueryContext > mqlQueryContext =
+      SqlSelectTranslator::Translate(*select, *tableContext.Get());
+
+  LOG_DEBUG_MSG("Native query translation "
+                << (mqlQueryContext.IsValid() ? "succeeded" : "not supported")
+                << " for: " << sql);
+
+  return mqlQueryContext;
+}
+
+SharedPointer< DocumentDbMqlQueryContext > Connection::TranslateByShape(
+    const std::string& sql) {
+  std::shared_ptr< SqlSelectCommand > select = SqlSelectTranslator::Parse(sql);
+  if (!select)
+    return nullptr;
+
+  std::vector< boost::optional< SqlSelectCommand::Literal > > literals;
+  std::string shape = SqlSelectTranslator::Parameterize(*select, literals);
+
+  // The shapes are keyed apart from the queries, as a query can have the
+  // text of a shape. SQL text never contains U+0000.
+  std::string key;
+  if (shape.empty()
+      || !MakeMqlQueryCacheKey(std::string(1, '\0') + shape, key))
+    return nullptr;
+
+  // Shapes that cannot be translated natively are cached as null, so their
+  // queries go straight to the translation of the query itself.
+  SharedPointer< DocumentDbMqlQueryContext > shapeContext;
+  bool found = mqlQueryCache_.Get(key, shapeContext);
+
+  LOG_DEBUG_MSG("Query shape cache " << (found ? "hit" : "miss")
+                                     << ". literals: " << literals.size());
+
+  if (!found) {
+    shapeContext = TranslateNatively(shape);
+
+    mqlQueryCache_.Put(key, shapeContext);
+  }
+
+  if (!shapeContext.IsValid())
+    return nullptr;
+
+  // Literals that cannot be compared with their columns are not bound, the
+  // query is then translated on its own.
+  SharedPointer< DocumentDbMqlQueryContext > mqlQueryContext =
+      SqlSelectTranslator::BindParameters(*shapeContext.Get(), literals);
+
+  if (!mqlQueryContext.IsValid())
+    LOG_DEBUG_MSG("Literals do not match the query shape: " << shape);
+
+  return mqlQueryContext;
+}
+
+void Connection::ResetQueryMapping() {
+  CsLockGuard guard(queryMappingLock_);
+
+  if (mqlQueryCache_.GetHits() > 0 || mqlQueryCache_.GetMisses() > 0) {
+    LOG_INFO_MSG("Query cache cleared. hits: "
+                 << mqlQueryCache_.GetHits()
+                 << ", misses: " << mqlQueryCache_.GetMisses()
+                 << ", size: " << mqlQueryCache_.GetSize());
+  }
+
+  mqlQueryCache_.Clear();
+  mqlQueryCacheScope_.clear();
+  ++queryMappingGeneration_;
+  tableQueryCache_.Clear();
+  queryMappingService_ = nullptr;
+  databaseMetadata_ = nullptr;
+}
+
+SharedPointer< DocumentDbQueryMappingService >
+Connection::GetQueryMappingService(DocumentDbError& err) {
+  if (queryMappingService_.IsValid())
+    return queryMappingService_;
+
+  SharedPointer< DocumentDbConnectionProperties > connectionProperties =
+      GetConnectionProperties(err);
+  if (!connectionProperties.IsValid())
+    return nullptr;
+
+  SharedPointer< DocumentDbDatabaseMetadata > databaseMetadata =
+      InternalGetDatabaseMetadata(err);
+  if (!databaseMetadata.IsValid())
+    return nullptr;
+
+  JniErrorInfo errInfo;
+  SharedPointer< DocumentDbQueryMappingService > queryMappingService =
+      DocumentDbQueryMappingService::Create(connectionProperties,
+                                            databaseMetadata, errInfo);
+  if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
+    DocumentDbError::SetError(errInfo.code, errInfo.errCls.c_str(),
+                              errInfo.errMsg.c_str(), err);
+    return nullptr;
+  }
+
+  LOG_DEBUG_MSG("Query mapping service is created");
+
+  queryMappingService_ = queryMappingService;
+
+  return queryMappingService_;
+}
+
+bool Connection::MakeMqlQueryCacheKey(const std::string& sql,
+                                      std::string& key) {
+  if (mqlQueryCacheScope_.empty()) {
+    DocumentDbError err;
+    SharedPointer< DocumentDbDatabaseMetadata > databaseMetadata =
+        InternalGetDatabaseMetadata(err);
+    if (!databaseMetadata.IsValid())
+      return false;
+
+    JniErrorInfo errInfo;
+    std::string schemaName;
+    int32_t schemaVersion = 0;
+    if (databaseMetadata.Get()->GetSchemaName(schemaName, errInfo)
+            != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS
+        || databaseMetadata.Get()->GetSchemaVersion(schemaVersion, errInfo)
+               != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
+      LOG_ERROR_MSG("Unable to identify the schema for the query cache: "
+                    << errInfo.errMsg);
+
+      return false;
+    }
+
+    std::stringstream scope;
+    scope << config_.GetDatabase() << '\n'
+          << schemaName << '\n'
+          << schemaVersion << '\n';
+    mqlQueryCacheScope_ = scope.str();
+  }
+
+  key.reserve(mqlQueryCacheScope_.size() + sql.size());
+  key.assign(mqlQueryCacheScope_).append(sql);
+
+  return true;
+}
+
 SqlResult::Type Connection::InternalCreateStatement(Statement*& statement) {
   statement = new Statement(*this);
 
@@ -349,6 +651,14 @@ SqlResult::Type Connection::InternalGetAttribute(int attr, void* buf,
       break;
     }
 
+    case SQL_ATTR_DOCUMENTDB_REFRESH_CATALOG:
+    case SQL_ATTR_RESET_CONNECTION: {
+      AddStatusRecord(SqlState::SHY092_OPTION_TYPE_OUT_OF_RANGE,
+                      "Attribute is write only.");
+
+      return SqlResult::AI_ERROR;
+    }
+
     default: {
       AddStatusRecord(SqlState::SHYC00_OPTIONAL_FEATURE_NOT_IMPLEMENTED,
                       "Specified attribute is not supported.");
@@ -383,6 +693,28 @@ SqlResult::Type Connection::InternalSetAttribute(int attr, void* value,
       break;
     }
 
+    case SQL_ATTR_DOCUMENTDB_REFRESH_CATALOG: {
+      RefreshCatalog();
+
+      break;
+    }
+
+    case SQL_ATTR_RESET_CONNECTION: {
+      SQLUINTEGER reset =
+          static_cast< SQLUINTEGER >(reinterpret_cast< ptrdiff_t >(value));
+
+      if (reset != SQL_RESET_CONNECTION_YES) {
+        AddStatusRecord(SqlState::SHY024_INVALID_ATTRIBUTE_VALUE,
+                        "Invalid value for the reset connection attribute.");
+
+        return SqlResult::AI_ERROR;
+      }
+
+      ResetConnection();
+
+      break;
+    }
+
     default: {
       AddStatusRecord(SqlState::SHYC00_OPTIONAL_FEATURE_NOT_IMPLEMENTED,
                       "Specified attribute is not supported.");
@@ -394,6 +726,16 @@ SqlResult::Type Connection::InternalSetAttribute(int attr, void* value,
   return SqlResult::AI_SUCCESS;
 }
 
+void Connection::ResetConnection() {
+  // Only the state an application can change through the connection handle
+  // is restored. The Java connection, the SSH tunnel, the MongoDB client and
+  // the translation caches are kept, so that the next user of the pooled
+  // connection does not pay for them again.
+  config_.SetLoginTimeoutSeconds(establishedLoginTimeout_);
+
+  LOG_DEBUG_MSG("Connection reset for reuse from the connection pool");
+}
+
 void Connection::EnsureConnected() {
   if (connection_.IsValid())
     return;
@@ -432,6 +774,17 @@ bool Connection::TryRestoreConnection(DocumentDbError& err) {
     return true;
   }
 
+  // The native client does not depend on the JDBC connection, so it is
+  // connected at the same time, as soon as the port to connect to is known.
+  // The future waits for the connection attempt on every return path.
+  DocumentDbError nativeErr;
+  std::future< bool > nativeConnected;
+  if (!config_.IsSshHostSet()) {
+    nativeConnected =
+        std::async(std::launch::async, &Connection::ConnectCPPDocumentDB,
+                   this, 0, std::ref(nativeErr));
+  }
+
   JniErrorInfo errInfo;
   auto ctx = GetJniContext(errInfo);
   if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
@@ -442,9 +795,24 @@ bool Connection::TryRestoreConnection(DocumentDbError& err) {
                           .c_str());
     return false;
   }
+
+  // Connections through the same internal SSH tunnel share it.
+  std::shared_ptr< const int32_t > sshTunnel;
+  if (config_.IsSshHostSet()) {
+    sshTunnel = SshTunnelRegistry::GetInstance().Acquire(config_, ctx, err);
+    if (!sshTunnel) {
+      return false;
+    }
+
+    nativeConnected =
+        std::async(std::launch::async, &Connection::ConnectCPPDocumentDB,
+                   this, *sshTunnel, std::ref(nativeErr));
+  }
+  int32_t localSSHTunnelPort = sshTunnel ? *sshTunnel : 0;
+
   SharedPointer< DocumentDbConnection > conn = new DocumentDbConnection(ctx);
   if (!conn.IsValid()
-      || conn.Get()->Open(config_, errInfo)
+      || conn.Get()->Open(config_, localSSHTunnelPort, errInfo)
              != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
     std::string message = errInfo.errMsg;
     err = DocumentDbError(DocumentDbError::DOCUMENTDB_ERR_SECURE_CONNECTION_FAILURE,
@@ -458,46 +826,29 @@ bool Connection::TryRestoreConnection(DocumentDbError& err) {
     return connected;
   }
 
-  int32_t localSSHTunnelPort = 0;
-  if (!GetInternalSSHTunnelPort(localSSHTunnelPort, ctx, err)) {
-    return false;
+  sshTunnel_ = sshTunnel;
+
+  connected = nativeConnected.get();
+  if (!connected) {
+    err = nativeErr;
   }
 
-  connected = ConnectCPPDocumentDB(localSSHTunnelPort, err);
+  {
+    CsLockGuard guard(queryMappingLock_);
+    mqlQueryCache_.SetCapacity(
+        static_cast< size_t >(config_.GetQueryCacheSize()));
+  }
 
   UpdateConnectionRuntimeInfo(config_, info_);
 
   return connected;
 }
 
-bool Connection::GetInternalSSHTunnelPort(int32_t& localSSHTunnelPort,
-                                          SharedPointer< JniContext > ctx,
-                                          odbc::DocumentDbError& err) {
-  bool isSSHTunnelActive;
-  JniErrorInfo errInfo;
-  JniErrorCode success =
-      connection_.Get()->IsSshTunnelActive(isSSHTunnelActive, errInfo);
-
-  if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-    err = DocumentDbError(odbc::DocumentDbError::DOCUMENTDB_ERR_JVM_INIT,
-                      errInfo.errMsg.c_str());
-    return false;
-  }
-
-  if (isSSHTunnelActive) {
-    success = connection_.Get()->GetSshLocalPort(localSSHTunnelPort, errInfo);
-    if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-      err = DocumentDbError(odbc::DocumentDbError::DOCUMENTDB_ERR_JVM_INIT,
-                            errInfo.errMsg.c_str());
-      return false;
-    }
-  }
-
-  return true;
-}
-
 SharedPointer< JniContext > Connection::GetJniContext(JniErrorInfo& errInfo) {
   if (!jniContext_.IsValid()) {
+    // Let the background warm-up, if any, finish starting the JVM.
+    jni::JvmPrewarm::GetInstance().Wait();
+
     // Resolve DOCUMENTDB_HOME.
     std::string home = jni::ResolveDocumentDbHome();
 
@@ -518,6 +869,156 @@ SharedPointer< JniContext > Connection::GetJniContext(JniErrorInfo& errInfo) {
   return jniContext_;
 }
 
+void Connection::OpenMetadataCache() {
+  const std::string& dir = config_.GetMetadataCacheDir();
+  if (dir.empty())
+    return;
+
+  if (!common::IsValidDirectory(dir)) {
+    LOG_ERROR_MSG("Metadata cache disabled: \"" << dir
+                                                 << "\" is not a directory");
+    return;
+  }
+
+  std::string key = meta::MetadataCache::MakeKey(
+      config_.GetHostname(), config_.GetPort(), config_.GetDatabase(),
+      config_.GetSchemaName());
+  metadataCache_ = std::make_shared< meta::MetadataCache >(
+      meta::MetadataCache::MakePath(dir, key), key,
+      config_.GetMetadataCacheTtl());
+
+  // A refreshed schema invalidates the cached metadata.
+  if (config_.IsRefreshSchema())
+    metadataCache_->Clear();
+  else
+    metadataCache_->Load();
+}
+
+void Connection::CloseMetadataCache() {
+  if (!metadataCache_)
+    return;
+
+  if (metadataCache_->IsDirty())
+    metadataCache_->Save();
+
+  metadataCache_.reset();
+}
+
+std::shared_ptr< meta::Catalog > Connection::GetCatalog(DocumentDbError& err) {
+  if (!config_.IsNativeCatalog())
+    return nullptr;
+
+  CsLockGuard guard(catalogLock_);
+
+  if (!catalog_)
+    catalog_ = LoadCatalog(err);
+
+  return catalog_;
+}
+
+void Connection::RefreshCatalog() {
+  CsLockGuard guard(catalogLock_);
+
+  LOG_DEBUG_MSG("Native catalog refreshed");
+
+  catalog_.reset();
+
+  // Otherwise the catalog would be loaded again from the cached metadata.
+  if (metadataCache_)
+    metadataCache_->Clear();
+}
+
+std::shared_ptr< meta::Catalog > Connection::LoadCatalog(
+    DocumentDbError& err) {
+  const std::string all("%");
+  meta::TableMetaVector tables;
+  meta::ColumnMetaVector columns;
+
+  bool tablesFound =
+      metadataCache_
+      && metadataCache_->GetTables(boost::none, boost::none, all, boost::none,
+                                   tables);
+  bool columnsFound =
+      metadataCache_
+      && metadataCache_->GetColumns(boost::none, boost::none, all, all,
+                                    columns);
+
+  if (!tablesFound || !columnsFound) {
+    SharedPointer< DatabaseMetaData > databaseMetaData = GetMetaData(err);
+    if (!databaseMetaData.IsValid())
+      return nullptr;
+
+    JniErrorInfo errInfo;
+    if (!tablesFound) {
+      SharedPointer< ResultSet > resultSet = databaseMetaData.Get()->GetTables(
+          boost::none, boost::none, all, boost::none, errInfo);
+      if (!resultSet.IsValid()
+          || errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
+        err = DocumentDbError(
+            DocumentDbError::DOCUMENTDB_ERR_JNI_GET_DATABASE_METADATA,
+            errInfo.errMsg.c_str());
+        return nullptr;
+      }
+
+      meta::ReadTableMetaVector(resultSet, tables);
+
+      if (metadataCache_)
+        metadataCache_->PutTables(boost::none, boost::none, all, boost::none,
+                                  tables);
+    }
+
+    if (!columnsFound) {
+      SharedPointer< ResultSet > resultSet = databaseMetaData.Get()->GetColumns(
+          boost::none, boost::none, all, all, errInfo);
+      if (!resultSet.IsValid()
+          || errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
+        err = DocumentDbError(
+            DocumentDbError::DOCUMENTDB_ERR_JNI_GET_DATABASE_METADATA,
+            errInfo.errMsg.c_str());
+        return nullptr;
+      }
+
+      meta::ReadColumnMetaVector(resultSet, columns);
+
+      if (metadataCache_)
+        metadataCache_->PutColumns(boost::none, boost::none, all, all,
+                                   columns);
+    }
+  }
+
+  LOG_INFO_MSG("Native catalog loaded. tables: "
+               << tables.size() << ", columns: " << columns.size());
+
+  return std::make_shared< meta::Catalog >(tables, columns);
+}
+
+/**
+ * Dumps the classes loaded by the JVM to the class data sharing archive that
+ * the JVM is recording classes for, if any. Done at most once per process, on
+ * a background thread because the dump takes seconds.
+ */
+void Connection::DumpSharedArchive() {
+  static std::atomic< bool > dumped(false);
+
+  std::string archive = JniContext::GetSharedArchiveDumpPath();
+  if (archive.empty() || common::FileExists(archive) || dumped.exchange(true))
+    return;
+
+  SharedPointer< JniContext > jniContext = jniContext_;
+  std::thread([jniContext, archive]() mutable {
+    JniErrorInfo errInfo;
+    jniContext.Get()->DumpSharedArchive(archive, errInfo);
+    if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
+      LOG_ERROR_MSG("Unable to dump the class data sharing archive \""
+                    << archive << "\": " << errInfo.errMsg);
+    } else {
+      LOG_INFO_MSG("Dumped the class data sharing archive \"" << archive
+                                                                << "\"");
+    }
+    JniContext::Detach();
+  }).detach();
+}
+
 /**
  * Create JVM options from configuration.
  *
@@ -527,7 +1028,17 @@ SharedPointer< JniContext > Connection::GetJniContext(JniErrorInfo& errInfo) {
  */
 void Connection::SetJvmOptions(const std::string& cp) {
   Deinit();
-  BuildJvmOptions(cp, opts_);
+
+  JvmSettings settings;
+  // Only the default initial size can be greater than the maximum size, see
+  // Configuration::Validate.
+  settings.initialHeapSize = std::min(config_.GetJvmInitialHeapSize(),
+                                      config_.GetJvmMaxHeapSize());
+  settings.maxHeapSize = config_.GetJvmMaxHeapSize();
+  settings.garbageCollector = config_.GetJvmGarbageCollector();
+  settings.cdsArchive = config_.GetJvmCdsArchive();
+
+  BuildJvmOptions(cp, opts_, settings);
 }
 
 /**
@@ -612,6 +1123,22 @@ void UpdateSqlDbmsVerInfo(mongocxx::database& db, config::ConnectionInfo& info)
 #endif  // SQL_DBMS_VER
 }
 
+void Connection::UpdateDbmsVerInfo() {
+  CsLockGuard guard(mongoClientLock_);
+
+  if (dbmsVerUpdated_ || !mongoClient_)
+    return;
+
+  try {
+    auto db = (*mongoClient_.get())[config_.GetDatabase()];
+    UpdateSqlDbmsVerInfo(db, info_);
+
+    dbmsVerUpdated_ = true;
+  } catch (const mongocxx::exception& xcp) {
+    LOG_ERROR_MSG("Unable to get the server version: " << xcp.what());
+  }
+}
+
 bool Connection::ConnectCPPDocumentDB(int32_t localSSHTunnelPort,
                                       odbc::DocumentDbError& err) {
   using bsoncxx::builder::basic::kvp;
@@ -622,17 +1149,30 @@ bool Connection::ConnectCPPDocumentDB(int32_t localSSHTunnelPort,
   try {
     std::string mongoCPPConnectionString =
         config_.ToMongoDbConnectionString(localSSHTunnelPort);
-    mongocxx::options::client client_options;
-    mongocxx::options::tls tls_options;
-    if (config_.IsTls()) {
-      // TODO: Enable use of Amazon RDS CA certificate in driver
-      // [Enable use of Amazon RDS CA certificate in driver](https://github.com/aws/amazon-documentdb-odbc-driver/issues/177)
-      tls_options.allow_invalid_certificates(true);
-      client_options.tls_opts(tls_options);
-    }
+    if (config_.GetMaxPoolSize() > 0) {
+      // Connections wait for a client at most for the login timeout.
+      int64_t waitTimeoutMs =
+          std::chrono::milliseconds(
+              std::chrono::seconds(config_.GetLoginTimeoutSeconds()))
+              .count();
+      waitTimeoutMs = std::min< int64_t >(waitTimeoutMs, INT32_MAX);
+
+      mongoClient_ = MongoClientPoolRegistry::GetInstance().Acquire(
+          mongoCPPConnectionString, config_.IsTls(), config_.GetMinPoolSize(),
+          config_.GetMaxPoolSize(), static_cast< int32_t >(waitTimeoutMs));
+    } else {
+      mongocxx::options::client client_options;
+      mongocxx::options::tls tls_options;
+      if (config_.IsTls()) {
+        // TODO: Enable use of Amazon RDS CA certificate in driver
+        // [Enable use of Amazon RDS CA certificate in driver](https://github.com/aws/amazon-documentdb-odbc-driver/issues/177)
+        tls_options.allow_invalid_certificates(true);
+        client_options.tls_opts(tls_options);
+      }
 
-    mongoClient_ = std::make_shared< mongocxx::client >(
-        mongocxx::uri(mongoCPPConnectionString), client_options);
+      mongoClient_ = std::make_shared< mongocxx::client >(
+          mongocxx::uri(mongoCPPConnectionString), client_options);
+    }
     std::string database = config_.GetDatabase();
     bsoncxx::builder::stream::document ping;
     ping << "ping" << 1;
@@ -645,8 +1185,6 @@ bool Connection::ConnectCPPDocumentDB(int32_t localSSHTunnelPort,
       return false;
     }
 
-    UpdateSqlDbmsVerInfo(db, info_);
-
     return true;
   } catch (const mongocxx::exception& xcp) {
     std::stringstream message;
@@ -45,6 +45,9 @@ const std::string STATE_01S02 = "01S02";
 /** SQL state 01S07 constant. */
 const std::string STATE_01S07 = "01S07";
 
+/** SQL state 07002 constant. */
+const std::string STATE_07002 = "07002";
+
 /** SQL state 07009 constant. */
 const std::string STATE_07009 = "07009";
 
@@ -286,6 +289,9 @@ const std::string& DiagnosticRecord::GetSqlState() const {
     case SqlState::S01S07_FRACTIONAL_TRUNCATION:
       return STATE_01S07;
 
+    case SqlState::S07002_COUNT_FIELD_INCORRECT:
+      return STATE_07002;
+
     case SqlState::S07006_RESTRICTION_VIOLATION:
       return STATE_07006;
 
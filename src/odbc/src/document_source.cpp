@@ -0,0 +1,192 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "documentdb/odbc/document_source.h"
+
+#include <bsoncxx/builder/basic/array.hpp>
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <chrono>
+#include <mongocxx/exception/exception.hpp>
+
+#include "documentdb/odbc/log.h"
+
+using bsoncxx::builder::basic::kvp;
+using bsoncxx::builder::basic::make_array;
+using bsoncxx::builder::basic::make_document;
+
+namespace documentdb {
+namespace odbc {
+MongoCursorSource::MongoCursorSource(mongocxx::cursor& cursor,
+                                     int32_t batchSize, FetchStatistics& stats)
+    : cursor_(std::move(cursor)),
+      iterator_(cursor_.end()),
+      iteratorEnd_(cursor_.end()),
+      stats_(stats) {
+  stats_.batchSize = batchSize;
+}
+
+bool MongoCursorSource::Next() {
+  if (!started_) {
+    iterator_ = cursor_.begin();
+    started_ = true;
+  } else if (iterator_ != iteratorEnd_) {
+    ++iterator_;
+  }
+
+  if (iterator_ == iteratorEnd_)
+    return false;
+
+  ++stats_.documents;
+  stats_.bytes += (*iterator_).length();
+
+  return true;
+}
+
+bsoncxx::document::view MongoCursorSource::Current() const {
+  return *iterator_;
+}
+
+CommandCursorSource::CommandCursorSource(
+    mongocxx::client& client, const std::string& databaseName,
+    const std::string& collectionName, bsoncxx::array::view pipeline,
+    int32_t timeout, const AdaptiveBatchSize& batchSize,
+    FetchStatistics& stats)
+    : client_(client),
+      database_(client.database(databaseName)),
+      collectionName_(collectionName),
+      pipeline_(pipeline),
+      timeout_(timeout),
+      batchSize_(batchSize),
+      stats_(stats) {
+  // No-op.
+}
+
+CommandCursorSource::~CommandCursorSource() {
+  if (cursorId_ == 0)
+    return;
+
+  try {
+    RunCommand(make_document(kvp("killCursors", collectionName_),
+                             kvp("cursors", make_array(cursorId_))));
+  } catch (mongocxx::exception const& xcp) {
+    LOG_DEBUG_MSG("Unable to kill cursor " << cursorId_ << ": " << xcp.what());
+  }
+}
+
+bool CommandCursorSource::Next() {
+  if (positioned_) {
+    ++batchIt_;
+    positioned_ = false;
+  }
+
+  while (!reply_ || batchIt_ == batch_.end()) {
+    if (started_ && cursorId_ == 0)
+      return false;
+
+    FetchBatch();
+  }
+
+  positioned_ = true;
+
+  return true;
+}
+
+bsoncxx::document::view CommandCursorSource::Current() const {
+  return batchIt_->get_document().value;
+}
+
+void CommandCursorSource::FetchBatch() {
+  bsoncxx::builder::basic::document command;
+  int32_t size = 0;
+
+  if (!started_) {
+    try {
+      session_.reset(new mongocxx::client_session(client_.start_session()));
+    } catch (mongocxx::exception const& xcp) {
+      LOG_DEBUG_MSG("Running cursor commands without a session: "
+                    << xcp.what());
+    }
+
+    size = batchSize_.GetFirstBatchSize();
+
+    command.append(kvp("aggregate", collectionName_));
+    command.append(kvp("pipeline", pipeline_.view()));
+    command.append(kvp("cursor", make_document(kvp("batchSize", size))));
+    if (timeout_)
+      command.append(
+          kvp("maxTimeMS", static_cast< int64_t >(timeout_) * 1000));
+  } else {
+    size = batchSize_.GetBatchSize();
+
+    command.append(kvp("getMore", cursorId_));
+    command.append(kvp("collection", collectionName_));
+    command.append(kvp("batchSize", size));
+  }
+
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+
+  // Release the previous batch before the new one arrives.
+  reply_.reset();
+  reply_.reset(new bsoncxx::document::value(RunCommand(command.view())));
+
+  int64_t elapsedUs = std::chrono::duration_cast< std::chrono::microseconds >(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+
+  bsoncxx::document::view cursor =
+      reply_->view()["cursor"].get_document().value;
+
+  cursorId_ = cursor["id"].get_int64().value;
+  batch_ = cursor[started_ ? "nextBatch" : "firstBatch"].get_array().value;
+  batchIt_ = batch_.begin();
+  started_ = true;
+
+  int64_t documents = 0;
+  for (bsoncxx::array::view::const_iterator it = batch_.begin();
+       it != batch_.end(); ++it)
+    ++documents;
+
+  int64_t bytes = static_cast< int64_t >(batch_.length());
+
+  ++stats_.batches;
+  stats_.documents += documents;
+  stats_.bytes += bytes;
+  stats_.fetchTimeUs += elapsedUs;
+  stats_.batchSize = size;
+
+  int32_t nextSize = batchSize_.GetNextBatchSize(documents, bytes, elapsedUs);
+
+  LOG_DEBUG_MSG("Fetched batch " << stats_.batches << ". requested: " << size
+                                 << ", documents: " << documents
+                                 << ", bytes: " << bytes
+                                 << ", time (us): " << elapsedUs
+                                 << ", average document size: "
+                                 << batchSize_.GetAverageDocumentSize()
+                                 << ", next batch size: " << nextSize);
+}
+
+bsoncxx::document::value CommandCursorSource::RunCommand(
+    bsoncxx::document::view command) {
+  if (session_)
+    return database_.run_command(*session_, command);
+
+  return database_.run_command(command);
+}
+}  // namespace odbc
+}  // namespace documentdb
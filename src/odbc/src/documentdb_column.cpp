@@ -17,10 +17,13 @@
 
 #include <iostream>
 #include <chrono>
+#include <cmath>
 #include <ctime>
+#include <limits>
 #include <boost/date_time/date_facet.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include "documentdb/odbc/documentdb_column.h"
+#include "documentdb/odbc/common/number_parser.h"
 #include <documentdb/odbc/impl/interop/interop_stream_position_guard.h>
 #include "documentdb/odbc/utility.h"
 #include "bsoncxx/types.hpp"
@@ -29,17 +32,193 @@
 namespace documentdb {
 namespace odbc {
 
-void DocumentDbColumn::Update(bsoncxx::document::view const& document) {
-  document_ = document;
+namespace {
+template < typename T >
+T GetBsonValue(bsoncxx::document::element const& element);
+
+template <>
+int32_t GetBsonValue< int32_t >(bsoncxx::document::element const& element) {
+  return element.get_int32().value;
+}
+
+template <>
+int64_t GetBsonValue< int64_t >(bsoncxx::document::element const& element) {
+  return element.get_int64().value;
+}
+
+template <>
+double GetBsonValue< double >(bsoncxx::document::element const& element) {
+  return element.get_double().value;
+}
+
+/**
+ * Put numeric BSON value directly to the numeric application buffer.
+ * Conversion is the same as the column setter followed by the buffer
+ * conversion of the setter value type.
+ */
+template < typename Tbson, typename Tval, typename Tbuf >
+ConversionResult::Type PutNumDirect(
+    ApplicationDataBuffer& dataBuf,
+    bsoncxx::document::element const& element) {
+  void* dataPtr = dataBuf.GetData();
+  SqlLen* resLenPtr = dataBuf.GetResLen();
+
+  if (dataPtr)
+    *reinterpret_cast< Tbuf* >(dataPtr) = static_cast< Tbuf >(
+        static_cast< Tval >(GetBsonValue< Tbson >(element)));
+
+  if (resLenPtr)
+    *resLenPtr = static_cast< SqlLen >(sizeof(Tbuf));
+
+  return ConversionResult::Type::AI_SUCCESS;
+}
+
+template < typename Tbson, typename Tval >
+DocumentDbColumn::DirectPutFunc SelectPutNumDirect(
+    type_traits::OdbcNativeType::Type bufType) {
+  using type_traits::OdbcNativeType;
+
+  switch (bufType) {
+    case OdbcNativeType::AI_SIGNED_TINYINT:
+      return &PutNumDirect< Tbson, Tval, signed char >;
+
+    case OdbcNativeType::AI_BIT:
+    case OdbcNativeType::AI_UNSIGNED_TINYINT:
+      return &PutNumDirect< Tbson, Tval, unsigned char >;
+
+    case OdbcNativeType::AI_SIGNED_SHORT:
+      return &PutNumDirect< Tbson, Tval, SQLSMALLINT >;
+
+    case OdbcNativeType::AI_UNSIGNED_SHORT:
+      return &PutNumDirect< Tbson, Tval, SQLUSMALLINT >;
+
+    case OdbcNativeType::AI_SIGNED_LONG:
+      return &PutNumDirect< Tbson, Tval, SQLINTEGER >;
+
+    case OdbcNativeType::AI_UNSIGNED_LONG:
+      return &PutNumDirect< Tbson, Tval, SQLUINTEGER >;
+
+    case OdbcNativeType::AI_SIGNED_BIGINT:
+      return &PutNumDirect< Tbson, Tval, SQLBIGINT >;
+
+    case OdbcNativeType::AI_UNSIGNED_BIGINT:
+      return &PutNumDirect< Tbson, Tval, SQLUBIGINT >;
+
+    case OdbcNativeType::AI_FLOAT:
+      return &PutNumDirect< Tbson, Tval, SQLREAL >;
+
+    case OdbcNativeType::AI_DOUBLE:
+      return &PutNumDirect< Tbson, Tval, SQLDOUBLE >;
+
+    default:
+      return nullptr;
+  }
 }
 
-DocumentDbColumn::DocumentDbColumn(bsoncxx::document::view& document,
-                                   JdbcColumnMetadata& columnMetadata,
-                                   std::string& path)
+template < typename Tval >
+DocumentDbColumn::DirectPutFunc SelectPutNumDirect(
+    bsoncxx::type bsonType, type_traits::OdbcNativeType::Type bufType) {
+  switch (bsonType) {
+    case bsoncxx::type::k_int32:
+      return SelectPutNumDirect< int32_t, Tval >(bufType);
+
+    case bsoncxx::type::k_int64:
+      return SelectPutNumDirect< int64_t, Tval >(bufType);
+
+    case bsoncxx::type::k_double:
+      return SelectPutNumDirect< double, Tval >(bufType);
+
+    default:
+      return nullptr;
+  }
+}
+}  // namespace
+
+DocumentDbColumn::DocumentDbColumn(JdbcColumnMetadata& columnMetadata)
     : type_(columnMetadata.GetColumnType()),
-      document_(document),
-      columnMetadata_(columnMetadata),
-      path_(path) {
+      put_(nullptr),
+      columnMetadata_(columnMetadata) {
+  put_ = ResolvePut();
+}
+
+DocumentDbColumn::PutFunc DocumentDbColumn::ResolvePut() const {
+  switch (type_) {
+    case JDBC_TYPE_BOOLEAN:
+    case JDBC_TYPE_SMALLINT:
+      return &DocumentDbColumn::PutInt8;
+
+    case JDBC_TYPE_TINYINT:
+      return &DocumentDbColumn::PutInt16;
+
+    case JDBC_TYPE_INTEGER:
+      return &DocumentDbColumn::PutInt32;
+
+    case JDBC_TYPE_BIGINT:
+      return &DocumentDbColumn::PutInt64;
+
+    case JDBC_TYPE_FLOAT:
+      return &DocumentDbColumn::PutFloat;
+
+    case JDBC_TYPE_DOUBLE:
+      return &DocumentDbColumn::PutDouble;
+
+    case JDBC_TYPE_VARCHAR:
+    case JDBC_TYPE_CHAR:
+    case JDBC_TYPE_NCHAR:
+    case JDBC_TYPE_NVARCHAR:
+    case JDBC_TYPE_LONGVARCHAR:
+    case JDBC_TYPE_LONGNVARCHAR:
+      return &DocumentDbColumn::PutString;
+
+    case JDBC_TYPE_NULL:
+      return &DocumentDbColumn::PutNull;
+
+    case JDBC_TYPE_BINARY:
+    case JDBC_TYPE_VARBINARY:
+      return &DocumentDbColumn::PutBinaryData;
+
+    case JDBC_TYPE_DECIMAL:
+      return &DocumentDbColumn::PutDecimal;
+
+    case JDBC_TYPE_DATE:
+      return &DocumentDbColumn::PutDate;
+
+    case JDBC_TYPE_TIMESTAMP:
+      return &DocumentDbColumn::PutTimestamp;
+
+    case JDBC_TYPE_TIME:
+      return &DocumentDbColumn::PutTime;
+
+    default:
+      return &DocumentDbColumn::PutUnsupported;
+  }
+}
+
+DocumentDbColumn::DirectPutFunc DocumentDbColumn::ResolveDirectPut(
+    bsoncxx::type bsonType, type_traits::OdbcNativeType::Type bufType) const {
+  // Only conversions without range checks are resolved.
+  switch (type_) {
+    case JDBC_TYPE_INTEGER:
+      if (bsonType == bsoncxx::type::k_int32)
+        return SelectPutNumDirect< int32_t, int32_t >(bufType);
+      return nullptr;
+
+    case JDBC_TYPE_BIGINT:
+      if (bsonType == bsoncxx::type::k_int32)
+        return SelectPutNumDirect< int32_t, int64_t >(bufType);
+      if (bsonType == bsoncxx::type::k_int64)
+        return SelectPutNumDirect< int64_t, int64_t >(bufType);
+      return nullptr;
+
+    case JDBC_TYPE_FLOAT:
+      return SelectPutNumDirect< float >(bsonType, bufType);
+
+    case JDBC_TYPE_DOUBLE:
+      return SelectPutNumDirect< double >(bsonType, bufType);
+
+    default:
+      return nullptr;
+  }
 }
 
 int64_t ToValidLong(int64_t value, ConversionResult::Type& convRes, int64_t max,
@@ -55,18 +234,33 @@ int64_t ToValidLong(int64_t value, ConversionResult::Type& convRes, int64_t max,
   return intValue;
 }
 
-int64_t ToValidLong(std::string const& value, ConversionResult::Type& convRes,
-                    int64_t max, int64_t min) {
+int64_t ToValidLong(bsoncxx::stdx::string_view const& value,
+                    ConversionResult::Type& convRes, int64_t max, int64_t min) {
   int64_t intValue = 0;
-  try {
-    intValue =
-        ToValidLong(std::stoll(value.c_str(), nullptr, 0), convRes, max, min);
-  } catch (std::invalid_argument const&) {
+  if (!common::ParseInt64(value.data(), value.size(), intValue)) {
     convRes = ConversionResult::Type::AI_FAILURE;
-  } catch (std::out_of_range const&) {
+    return 0;
+  }
+  return ToValidLong(intValue, convRes, max, min);
+}
+
+int64_t ToValidLong(bsoncxx::decimal128 const& value,
+                    ConversionResult::Type& convRes, int64_t max, int64_t min) {
+  int64_t intValue = 0;
+  if (!common::Decimal128ToInt64(value.high(), value.low(), intValue)) {
     convRes = ConversionResult::Type::AI_FAILURE;
+    return 0;
   }
-  return intValue;
+  return ToValidLong(intValue, convRes, max, min);
+}
+
+bool ToDouble(bsoncxx::decimal128 const& value, double& result) {
+  if (common::Decimal128ToDouble(value.high(), value.low(), result))
+    return true;
+
+  // Let the C library round the values the exact conversion cannot handle.
+  std::string str = value.to_string();
+  return common::ParseDouble(str.data(), str.size(), result);
 }
 
 ConversionResult::Type DocumentDbColumn::PutInt8(
@@ -93,11 +287,11 @@ ConversionResult::Type DocumentDbColumn::PutInt8(
       }
       break;
     case bsoncxx::type::k_decimal128:
-      value = ToValidLong(element.get_decimal128().value.to_string(), convRes,
+      value = ToValidLong(element.get_decimal128().value, convRes,
                           INT8_MAX, INT8_MIN);
       break;
     case bsoncxx::type::k_utf8:
-      value = ToValidLong(element.get_utf8().value.to_string(), convRes,
+      value = ToValidLong(element.get_utf8().value, convRes,
                           INT8_MAX, INT8_MIN);
       break;
     case bsoncxx::type::k_bool:
@@ -139,11 +333,11 @@ ConversionResult::Type DocumentDbColumn::PutInt16(
       }
       break;
     case bsoncxx::type::k_decimal128:
-      value = ToValidLong(element.get_decimal128().value.to_string(), convRes,
+      value = ToValidLong(element.get_decimal128().value, convRes,
                           INT16_MAX, INT16_MIN);
       break;
     case bsoncxx::type::k_utf8:
-      value = ToValidLong(element.get_utf8().value.to_string(), convRes,
+      value = ToValidLong(element.get_utf8().value, convRes,
                           INT16_MAX, INT16_MIN);
       break;
     case bsoncxx::type::k_bool:
@@ -190,11 +384,11 @@ ConversionResult::Type DocumentDbColumn::PutInt32(
       }
       break;
     case bsoncxx::type::k_decimal128:
-      value = ToValidLong(element.get_decimal128().value.to_string(), convRes,
+      value = ToValidLong(element.get_decimal128().value, convRes,
                           INT32_MAX, INT32_MIN);
       break;
     case bsoncxx::type::k_utf8:
-      value = ToValidLong(element.get_utf8().value.to_string(), convRes,
+      value = ToValidLong(element.get_utf8().value, convRes,
                           INT32_MAX, INT32_MIN);
       break;
     case bsoncxx::type::k_bool:
@@ -240,11 +434,11 @@ ConversionResult::Type DocumentDbColumn::PutInt64(
       }
       break;
     case bsoncxx::type::k_decimal128:
-      value = ToValidLong(element.get_decimal128().value.to_string(), convRes,
+      value = ToValidLong(element.get_decimal128().value, convRes,
                           INT64_MAX, INT64_MIN);
       break;
     case bsoncxx::type::k_utf8:
-      value = ToValidLong(element.get_utf8().value.to_string(), convRes,
+      value = ToValidLong(element.get_utf8().value, convRes,
                           INT64_MAX, INT64_MIN);
       break;
     case bsoncxx::type::k_bool:
@@ -284,12 +478,25 @@ ConversionResult::Type DocumentDbColumn::PutFloat(
     case bsoncxx::type::k_double:
       value = element.get_double().value;
       break;
-    case bsoncxx::type::k_decimal128:
-      value = std::stof(element.get_decimal128().value.to_string());
-      break;
-    case bsoncxx::type::k_utf8:
-      value = std::stof(element.get_utf8().value.to_string());
-      break;
+    case bsoncxx::type::k_decimal128: {
+      double dblValue = 0;
+      if (ToDouble(element.get_decimal128().value, dblValue)
+          && !(std::isfinite(dblValue)
+               && std::fabs(dblValue) > std::numeric_limits< float >::max())) {
+        value = static_cast< float >(dblValue);
+      } else {
+        convRes = ConversionResult::Type::AI_FAILURE;
+      }
+    } break;
+    case bsoncxx::type::k_utf8: {
+      bsoncxx::stdx::string_view str = element.get_utf8().value;
+      float fltValue = 0;
+      if (common::ParseFloat(str.data(), str.size(), fltValue)) {
+        value = fltValue;
+      } else {
+        convRes = ConversionResult::Type::AI_FAILURE;
+      }
+    } break;
     case bsoncxx::type::k_bool:
       value = element.get_bool().value ? 1 : 0;
       break;
@@ -327,12 +534,23 @@ ConversionResult::Type DocumentDbColumn::PutDouble(
     case bsoncxx::type::k_double:
       value = element.get_double().value;
       break;
-    case bsoncxx::type::k_decimal128:
-      value = std::stod(element.get_decimal128().value.to_string());
-      break;
-    case bsoncxx::type::k_utf8:
-      value = std::stod(element.get_utf8().value.to_string());
-      break;
+    case bsoncxx::type::k_decimal128: {
+      double dblValue = 0;
+      if (ToDouble(element.get_decimal128().value, dblValue)) {
+        value = dblValue;
+      } else {
+        convRes = ConversionResult::Type::AI_FAILURE;
+      }
+    } break;
+    case bsoncxx::type::k_utf8: {
+      bsoncxx::stdx::string_view str = element.get_utf8().value;
+      double dblValue = 0;
+      if (common::ParseDouble(str.data(), str.size(), dblValue)) {
+        value = dblValue;
+      } else {
+        convRes = ConversionResult::Type::AI_FAILURE;
+      }
+    } break;
     case bsoncxx::type::k_bool:
       value = element.get_bool().value ? 1 : 0;
       break;
@@ -380,7 +598,25 @@ std::string ToString(const boost::posix_time::ptime& dateTime) {
 ConversionResult::Type DocumentDbColumn::PutString(
     ApplicationDataBuffer& dataBuf,
     bsoncxx::document::element const& element) const {
+  std::string storage;
+  const char* data = nullptr;
+  size_t len = 0;
+  ConversionResult::Type convRes = GetText(element, storage, data, len);
+  if (convRes == ConversionResult::Type::AI_SUCCESS) {
+    if (data)
+      dataBuf.PutString(data, len);
+    else
+      dataBuf.PutNull();
+  }
+  return convRes;
+}
+
+ConversionResult::Type DocumentDbColumn::GetText(
+    bsoncxx::document::element const& element, std::string& storage,
+    const char*& data, size_t& len) const {
   ConversionResult::Type convRes = ConversionResult::Type::AI_SUCCESS;
+  data = nullptr;
+  len = 0;
   bsoncxx::type docType = element.type();
   boost::optional< std::string > value{};
   switch (docType) {
@@ -396,9 +632,13 @@ ConversionResult::Type DocumentDbColumn::PutString(
     case bsoncxx::type::k_decimal128:
       value = element.get_decimal128().value.to_string();
       break;
-    case bsoncxx::type::k_utf8:
-      value = element.get_utf8().value.to_string();
-      break;
+    case bsoncxx::type::k_utf8: {
+      // Refer to the document, no intermediate string.
+      bsoncxx::stdx::string_view str = element.get_utf8().value;
+      data = str.data();
+      len = str.size();
+      return convRes;
+    }
     case bsoncxx::type::k_binary: {
       std::stringstream ss;
       ss << std::hex;
@@ -446,8 +686,10 @@ ConversionResult::Type DocumentDbColumn::PutString(
       convRes = ConversionResult::Type::AI_UNSUPPORTED_CONVERSION;
       break;
   }
-  if (convRes == ConversionResult::Type::AI_SUCCESS) {
-    dataBuf.PutString(value);
+  if (convRes == ConversionResult::Type::AI_SUCCESS && value) {
+    storage.swap(*value);
+    data = storage.data();
+    len = storage.size();
   }
   return convRes;
 }
@@ -592,115 +834,144 @@ ConversionResult::Type DocumentDbColumn::PutTimestamp(
 ConversionResult::Type DocumentDbColumn::PutBinaryData(
     ApplicationDataBuffer& dataBuf,
     bsoncxx::document::element const& element) const {
+  std::string storage;
+  const char* data = nullptr;
+  size_t len = 0;
+  ConversionResult::Type convRes = GetBinary(element, storage, data, len);
+  if (convRes == ConversionResult::Type::AI_SUCCESS) {
+    if (data) {
+      int32_t len_written = 0;
+      convRes = dataBuf.PutBinaryData(data, len, len_written);
+    } else {
+      convRes = dataBuf.PutNull();
+    }
+  }
+  return convRes;
+}
+
+ConversionResult::Type DocumentDbColumn::GetBinary(
+    bsoncxx::document::element const& element, std::string& storage,
+    const char*& data, size_t& len) const {
   ConversionResult::Type convRes = ConversionResult::Type::AI_SUCCESS;
   bsoncxx::type docType = element.type();
-  const void* value = nullptr;
-  size_t length = 0;
+  data = nullptr;
+  len = 0;
   switch (docType) {
-    case bsoncxx::type::k_utf8:
-      value = element.get_utf8().value.to_string().c_str();
-      length = element.get_utf8().value.to_string().length();
-      break;
-    case bsoncxx::type::k_binary:
-      value = element.get_binary().bytes;
-      length = element.get_binary().size;
-      break;
-    case bsoncxx::type::k_oid:
-      value = element.get_oid().value.bytes();
-      length = element.get_oid().value.size();
-      break;
+    case bsoncxx::type::k_utf8: {
+      bsoncxx::stdx::string_view str = element.get_utf8().value;
+      data = str.data();
+      len = str.size();
+    } break;
+    case bsoncxx::type::k_binary: {
+      bsoncxx::types::b_binary binary = element.get_binary();
+      data = reinterpret_cast< const char* >(binary.bytes);
+      len = binary.size;
+    } break;
+    case bsoncxx::type::k_oid: {
+      // The value is a copy, keep its bytes.
+      bsoncxx::oid oid = element.get_oid().value;
+      storage.assign(oid.bytes(), oid.size());
+      data = storage.data();
+      len = storage.size();
+    } break;
     case bsoncxx::type::k_null:
       break;
     default:
       convRes = ConversionResult::Type::AI_UNSUPPORTED_CONVERSION;
       break;
   }
-  if (convRes == ConversionResult::Type::AI_SUCCESS) {
-    if (value) {
-      int32_t len_written = 0;
-      convRes = dataBuf.PutBinaryData(value, length, len_written);
-    } else {
-      convRes = dataBuf.PutNull();
-    }
-  }
   return convRes;
 }
 
+ConversionResult::Type DocumentDbColumn::PutNull(
+    ApplicationDataBuffer& dataBuf,
+    bsoncxx::document::element const&) const {
+  return dataBuf.PutNull();
+}
+
+ConversionResult::Type DocumentDbColumn::PutUnsupported(
+    ApplicationDataBuffer&, bsoncxx::document::element const&) const {
+  return ConversionResult::Type::AI_UNSUPPORTED_CONVERSION;
+}
+
 ConversionResult::Type DocumentDbColumn::ReadToBuffer(
-    ApplicationDataBuffer& dataBuf) const {
-  auto element = document_[path_];
+    ApplicationDataBuffer& dataBuf,
+    bsoncxx::document::element const& element) const {
   // Invalid (or missing) element is null
   if (!element) {
     dataBuf.PutNull();
     return ConversionResult::Type::AI_SUCCESS;
   }
 
-  ConversionResult::Type convRes = ConversionResult::Type::AI_SUCCESS;
-
-  switch (type_) {
-    case JDBC_TYPE_BOOLEAN:
-    case JDBC_TYPE_SMALLINT:
-      convRes = PutInt8(dataBuf, element);
-      break;
-
-    case JDBC_TYPE_TINYINT:
-      convRes = PutInt16(dataBuf, element);
-      break;
-
-    case JDBC_TYPE_INTEGER:
-      convRes = PutInt32(dataBuf, element);
-      break;
+  bsoncxx::type bsonType = element.type();
+  type_traits::OdbcNativeType::Type bufType = dataBuf.GetType();
 
-    case JDBC_TYPE_BIGINT:
-      convRes = PutInt64(dataBuf, element);
-      break;
-
-    case JDBC_TYPE_FLOAT:
-      convRes = PutFloat(dataBuf, element);
-      break;
+  // Speculate that the element has the same type as in the previous row.
+  if (bsonType != directBsonType_ || bufType != directBufType_) {
+    directPut_ = ResolveDirectPut(bsonType, bufType);
+    directBsonType_ = bsonType;
+    directBufType_ = bufType;
+  }
 
-    case JDBC_TYPE_DOUBLE:
-      convRes = PutDouble(dataBuf, element);
-      break;
+  if (directPut_)
+    return directPut_(dataBuf, element);
 
-    case JDBC_TYPE_VARCHAR:
-    case JDBC_TYPE_CHAR:
-    case JDBC_TYPE_NCHAR:
-    case JDBC_TYPE_NVARCHAR:
-    case JDBC_TYPE_LONGVARCHAR:
-    case JDBC_TYPE_LONGNVARCHAR:
-      convRes = PutString(dataBuf, element);
-      break;
+  return (this->*put_)(dataBuf, element);
+}
 
-    case JDBC_TYPE_NULL:
-      convRes = dataBuf.PutNull();
-      break;
+bool DocumentDbColumn::IsPartReadable(
+    type_traits::OdbcNativeType::Type bufType) const {
+  using type_traits::OdbcNativeType;
 
-    case JDBC_TYPE_BINARY:
-    case JDBC_TYPE_VARBINARY:
-      convRes = PutBinaryData(dataBuf, element);
-      break;
+  if (put_ == &DocumentDbColumn::PutString)
+    return bufType == OdbcNativeType::AI_CHAR
+           || bufType == OdbcNativeType::AI_WCHAR
+           || bufType == OdbcNativeType::AI_DEFAULT;
 
-    case JDBC_TYPE_DECIMAL:
-      convRes = PutDecimal(dataBuf, element);
-      break;
+  if (put_ == &DocumentDbColumn::PutBinaryData)
+    return bufType == OdbcNativeType::AI_BINARY;
 
-    case JDBC_TYPE_DATE:
-      convRes = PutDate(dataBuf, element);
-      break;
+  return false;
+}
 
-    case JDBC_TYPE_TIMESTAMP:
-      convRes = PutTimestamp(dataBuf, element);
-      break;
+ConversionResult::Type DocumentDbColumn::ReadData(
+    bsoncxx::document::element const& element,
+    type_traits::OdbcNativeType::Type bufType, std::string& storage,
+    const char*& data, size_t& len) const {
+  data = nullptr;
+  len = 0;
 
-    case JDBC_TYPE_TIME:
-      convRes = PutTime(dataBuf, element);
-      break;
+  // Invalid (or missing) element is null
+  if (!element)
+    return ConversionResult::Type::AI_SUCCESS;
 
-    default:
-      return ConversionResult::Type::AI_UNSUPPORTED_CONVERSION;
+  if (put_ == &DocumentDbColumn::PutBinaryData)
+    return GetBinary(element, storage, data, len);
+
+  std::string text;
+  ConversionResult::Type convRes = GetText(element, text, data, len);
+  if (convRes != ConversionResult::Type::AI_SUCCESS || !data)
+    return convRes;
+
+  // Convert the whole text to the buffer encoding once.
+  bool isTruncated = false;
+  if (bufType == type_traits::OdbcNativeType::AI_WCHAR) {
+    storage.resize((len + 1) * sizeof(SQLWCHAR));
+    size_t written = utility::CopyUtf8StringToSqlWcharString(
+        data, len, reinterpret_cast< SQLWCHAR* >(&storage[0]), storage.size(),
+        isTruncated);
+    storage.resize(written);
+  } else {
+    storage.resize(len + 1);
+    size_t written = utility::CopyUtf8StringToSqlCharString(
+        data, len, reinterpret_cast< SQLCHAR* >(&storage[0]), storage.size(),
+        isTruncated);
+    storage.resize(written);
   }
 
+  data = storage.data();
+  len = storage.size();
+
   return convRes;
 }
 }  // namespace odbc
@@ -16,53 +16,251 @@
  */
 
 #include "documentdb/odbc/documentdb_cursor.h"
-#include "mongocxx/cursor.hpp"
+
+#include "documentdb/odbc/log.h"
+
+using documentdb::odbc::common::concurrent::CsLockGuard;
 
 namespace documentdb {
 namespace odbc {
 DocumentDbCursor::DocumentDbCursor(
-    mongocxx::cursor& cursor, std::vector< JdbcColumnMetadata >& columnMetadata,
-    std::vector< std::string >& paths)
-    : cursor_(std::move(cursor)),
-      iterator_(cursor_.begin()),
-      iteratorEnd_(cursor_.end()),
+    std::unique_ptr< DocumentSource > source,
+    std::vector< JdbcColumnMetadata >& columnMetadata,
+    std::vector< std::string >& paths,
+    common::concurrent::CriticalSection& clientLock, size_t prefetchDocuments,
+    size_t prefetchMemoryLimit)
+    : source_(std::move(source)),
       columnMetadata_(columnMetadata),
-      paths_(paths) {
-  // No-op.
+      paths_(paths),
+      clientLock_(clientLock),
+      prefetchDocuments_(prefetchDocuments),
+      prefetchMemoryLimit_(prefetchMemoryLimit) {
+  if (prefetchDocuments_ > 0) {
+    LOG_DEBUG_MSG("Starting prefetch worker. documents: "
+                  << prefetchDocuments_
+                  << ", memory limit: " << prefetchMemoryLimit_);
+
+    prefetchWorker_ = std::thread(&DocumentDbCursor::Prefetch, this);
+  } else {
+    CsLockGuard guard(clientLock_);
+
+    hasData_ = source_->Next();
+  }
 }
 
 DocumentDbCursor::~DocumentDbCursor() {
+  StopPrefetch();
+
   currentRow_.release();
+
+  // Closing the source can involve a round trip to the server.
+  CsLockGuard guard(clientLock_);
+
+  source_.reset();
 }
 
 bool DocumentDbCursor::Increment() {
-  bool hasData = HasData();
-  if (hasData) {
+  if (canceled_) {
+    currentRow_.reset();
+    return false;
+  }
+
+  // Lets a cancel from another thread know that a fetch is in progress.
+  struct FetchingGuard {
+    explicit FetchingGuard(std::atomic< bool >& fetching)
+        : fetching(fetching) {
+      fetching = true;
+    }
+
+    ~FetchingGuard() {
+      fetching = false;
+    }
+
+    std::atomic< bool >& fetching;
+  } fetchingGuard(fetching_);
+
+  if (prefetchDocuments_ > 0)
+    return IncrementPrefetched();
+
+  if (hasData_) {
     if (!isFirstRow_) {
-      iterator_++;
+      CsLockGuard guard(clientLock_);
+
+      hasData_ = source_->Next();
     } else {
       isFirstRow_ = false;
     }
   }
-  hasData = HasData();
-  if (hasData) {
+  if (hasData_) {
     if (currentRow_) {
-      (*currentRow_).Update(*iterator_);
+      (*currentRow_).Update(source_->Current());
     } else {
-      currentRow_.reset(new DocumentDbRow(*iterator_, columnMetadata_, paths_));
+      currentRow_.reset(
+          new DocumentDbRow(source_->Current(), columnMetadata_, paths_));
     }
   } else {
     currentRow_.reset();
   }
-  return hasData;
+  return hasData_;
 }
 
 bool DocumentDbCursor::HasData() const {
-  return iterator_ != iteratorEnd_;
+  if (prefetchDocuments_ > 0)
+    return !prefetchExhausted_ && !canceled_;
+
+  return hasData_;
 }
 
 DocumentDbRow* DocumentDbCursor::GetRow() {
   return currentRow_.get();
 }
+
+void DocumentDbCursor::Cancel() {
+  {
+    CsLockGuard guard(prefetchLock_);
+
+    bool prefetching = prefetchWorker_.joinable() && !prefetchDone_;
+    if (!fetching_ && !prefetching) {
+      LOG_DEBUG_MSG("Nothing to cancel");
+      return;
+    }
+
+    canceled_ = true;
+    stopPrefetch_ = true;
+  }
+
+  prefetchCond_.NotifyAll();
+}
+
+bool DocumentDbCursor::IncrementPrefetched() {
+  CsLockGuard guard(prefetchLock_);
+
+  if (hasCurrent_) {
+    prefetchedBytes_ -= prefetched_.front().view().length();
+    prefetched_.pop_front();
+    hasCurrent_ = false;
+
+    prefetchCond_.NotifyAll();
+  }
+
+  if (prefetched_.empty() && !prefetchDone_ && !stopPrefetch_) {
+    ++prefetchWaits_;
+
+    while (prefetched_.empty() && !prefetchDone_ && !stopPrefetch_)
+      prefetchCond_.Wait(prefetchLock_);
+  }
+
+  if (prefetched_.empty() || stopPrefetch_) {
+    prefetchExhausted_ = true;
+    currentRow_.reset();
+
+    if (prefetchError_) {
+      std::exception_ptr error = prefetchError_;
+      prefetchError_ = nullptr;
+
+      guard.Reset();
+
+      std::rethrow_exception(error);
+    }
+
+    return false;
+  }
+
+  hasCurrent_ = true;
+
+  // Only this thread pops documents, so the front document stays in place
+  // while the worker keeps appending to the queue.
+  bsoncxx::document::view document = prefetched_.front().view();
+
+  guard.Reset();
+
+  if (currentRow_) {
+    (*currentRow_).Update(document);
+  } else {
+    currentRow_.reset(new DocumentDbRow(document, columnMetadata_, paths_));
+  }
+
+  return true;
+}
+
+void DocumentDbCursor::Prefetch() {
+  try {
+    bool hasNext = false;
+
+    {
+      CsLockGuard guard(clientLock_);
+
+      hasNext = source_->Next();
+    }
+
+    while (hasNext) {
+      // The view is only valid until the source moves, so keep a copy.
+      bsoncxx::document::value document(source_->Current());
+      size_t documentSize = document.view().length();
+
+      {
+        CsLockGuard guard(prefetchLock_);
+
+        while (!stopPrefetch_ && !CanPrefetch())
+          prefetchCond_.Wait(prefetchLock_);
+
+        if (stopPrefetch_)
+          break;
+
+        prefetched_.push_back(std::move(document));
+        prefetchedBytes_ += documentSize;
+        ++prefetchedTotal_;
+      }
+
+      prefetchCond_.NotifyAll();
+
+      CsLockGuard guard(clientLock_);
+
+      hasNext = source_->Next();
+    }
+  } catch (...) {
+    CsLockGuard guard(prefetchLock_);
+
+    prefetchError_ = std::current_exception();
+  }
+
+  {
+    CsLockGuard guard(prefetchLock_);
+
+    prefetchDone_ = true;
+  }
+
+  prefetchCond_.NotifyAll();
+}
+
+bool DocumentDbCursor::CanPrefetch() const {
+  // The front document may back the current row and is not counted as read
+  // ahead. One document is always allowed so a single document larger than
+  // the memory limit does not stall the cursor.
+  size_t ahead = prefetched_.size() - (hasCurrent_ ? 1 : 0);
+
+  return ahead < prefetchDocuments_
+         && (ahead == 0 || prefetchedBytes_ < prefetchMemoryLimit_);
+}
+
+void DocumentDbCursor::StopPrefetch() {
+  if (!prefetchWorker_.joinable())
+    return;
+
+  {
+    CsLockGuard guard(prefetchLock_);
+
+    stopPrefetch_ = true;
+  }
+
+  prefetchCond_.NotifyAll();
+
+  // The worker can be in the middle of a getMore round trip, which is
+  // bounded by the query timeout.
+  prefetchWorker_.join();
+
+  LOG_DEBUG_MSG("Prefetch worker stopped. documents: "
+                << prefetchedTotal_ << ", waits: " << prefetchWaits_);
+}
 }  // namespace odbc
 }  // namespace documentdb
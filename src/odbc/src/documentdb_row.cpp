@@ -15,6 +15,8 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+
 #include "documentdb/odbc/jni/jdbc_column_metadata.h"
 #include "documentdb/odbc/documentdb_row.h"
 #include "documentdb/odbc/utility.h"
@@ -34,14 +36,82 @@ DocumentDbRow::DocumentDbRow(bsoncxx::document::view const& document,
       columns_(),
       document_(document),
       columnMetadata_(columnMetadata),
-      paths_(paths) {
+      paths_(paths),
+      pathIndex_(),
+      nextSamePath_(),
+      elements_(columnMetadata.size()),
+      indexed_(false),
+      partColumnIdx_(0),
+      partBufType_(type_traits::OdbcNativeType::AI_UNSUPPORTED),
+      partStorage_(),
+      partData_(nullptr),
+      partLen_(0),
+      partOffset_(0),
+      partDone_(false) {
+  IndexPaths();
 }
 
 void DocumentDbRow::Update(bsoncxx::document::view const& document) {
   document_ = document;
-  for (DocumentDbColumn& column : columns_) {
-    column.Update(document);
+  indexed_ = false;
+
+  partColumnIdx_ = 0;
+  partData_ = nullptr;
+  std::string().swap(partStorage_);
+}
+
+size_t DocumentDbRow::PathKeyHash::operator()(const PathKey& key) const {
+  uint64_t hash = 14695981039346656037ULL;
+  for (size_t i = 0; i < key.size; ++i) {
+    hash ^= static_cast< unsigned char >(key.data[i]);
+    hash *= 1099511628211ULL;
+  }
+  return static_cast< size_t >(hash);
+}
+
+void DocumentDbRow::IndexPaths() {
+  nextSamePath_.assign(size, -1);
+  pathIndex_.reserve(size);
+
+  // Iterate backwards, so the chain of columns sharing a path is ascending.
+  for (int32_t i = size - 1; i >= 0; --i) {
+    PathKey key = {paths_[i].data(), paths_[i].size()};
+    std::unordered_map< PathKey, int32_t, PathKeyHash >::iterator it =
+        pathIndex_.find(key);
+
+    if (it != pathIndex_.end()) {
+      nextSamePath_[i] = it->second;
+      it->second = i;
+    } else {
+      pathIndex_.insert(std::make_pair(key, i));
+    }
+  }
+}
+
+void DocumentDbRow::IndexDocument() {
+  std::fill(elements_.begin(), elements_.end(),
+            bsoncxx::document::element());
+
+  size_t found = 0;
+  for (bsoncxx::document::view::const_iterator it = document_.begin();
+       it != document_.end() && found < pathIndex_.size(); ++it) {
+    bsoncxx::stdx::string_view name = it->key();
+    PathKey key = {name.data(), name.size()};
+
+    std::unordered_map< PathKey, int32_t, PathKeyHash >::const_iterator
+        column = pathIndex_.find(key);
+
+    // The first element wins, the same way as for the document lookup.
+    if (column == pathIndex_.end() || elements_[column->second])
+      continue;
+
+    for (int32_t i = column->second; i >= 0; i = nextSamePath_[i])
+      elements_[i] = *it;
+
+    ++found;
   }
+
+  indexed_ = true;
 }
 
 app::ConversionResult::Type DocumentDbRow::ReadColumnToBuffer(
@@ -52,9 +122,79 @@ app::ConversionResult::Type DocumentDbRow::ReadColumnToBuffer(
   if (!EnsureColumnDiscovered(columnIdx))
     return app::ConversionResult::Type::AI_FAILURE;
 
+  if (!indexed_)
+    IndexDocument();
+
+  DocumentDbColumn const& column = GetColumn(columnIdx);
+
+  return column.ReadToBuffer(dataBuf, elements_[columnIdx - 1]);
+}
+
+app::ConversionResult::Type DocumentDbRow::ReadColumnPartToBuffer(
+    uint32_t columnIdx, app::ApplicationDataBuffer& dataBuf) {
+  using app::ConversionResult;
+  using type_traits::OdbcNativeType;
+
+  if (columnIdx > static_cast< uint32_t >(GetSize()) || columnIdx < 1)
+    return ConversionResult::Type::AI_FAILURE;
+
+  if (!EnsureColumnDiscovered(columnIdx))
+    return ConversionResult::Type::AI_FAILURE;
+
+  if (!indexed_)
+    IndexDocument();
+
   DocumentDbColumn const& column = GetColumn(columnIdx);
+  OdbcNativeType::Type bufType = dataBuf.GetType();
+
+  if (!column.IsPartReadable(bufType)) {
+    partColumnIdx_ = 0;
+
+    return column.ReadToBuffer(dataBuf, elements_[columnIdx - 1]);
+  }
+
+  // The value is converted once, following calls only copy the next part.
+  if (partColumnIdx_ != columnIdx || partBufType_ != bufType) {
+    ConversionResult::Type convRes =
+        column.ReadData(elements_[columnIdx - 1], bufType, partStorage_,
+                        partData_, partLen_);
+
+    if (convRes != ConversionResult::Type::AI_SUCCESS) {
+      partColumnIdx_ = 0;
+
+      return convRes;
+    }
+
+    partColumnIdx_ = columnIdx;
+    partBufType_ = bufType;
+    partOffset_ = 0;
+    partDone_ = false;
+  }
+
+  if (partDone_)
+    return ConversionResult::Type::AI_NO_DATA;
+
+  if (!partData_) {
+    partDone_ = true;
+
+    return dataBuf.PutNull();
+  }
+
+  size_t charSize = 1;
+  if (bufType == OdbcNativeType::AI_WCHAR)
+    charSize = sizeof(SQLWCHAR);
+  else if (bufType == OdbcNativeType::AI_BINARY)
+    charSize = 0;
+
+  size_t written = 0;
+  ConversionResult::Type convRes =
+      dataBuf.PutDataPart(partData_ + partOffset_, partLen_ - partOffset_,
+                          charSize, written);
+
+  partOffset_ += written;
+  partDone_ = partOffset_ == partLen_;
 
-  return column.ReadToBuffer(dataBuf);
+  return convRes;
 }
 
 bool DocumentDbRow::EnsureColumnDiscovered(uint32_t columnIdx) {
@@ -63,8 +203,7 @@ bool DocumentDbRow::EnsureColumnDiscovered(uint32_t columnIdx) {
 
   int64_t index = columns_.size();
   while (columns_.size() < columnIdx) {
-    DocumentDbColumn newColumn(document_, columnMetadata_[index],
-                               paths_[index]);
+    DocumentDbColumn newColumn(columnMetadata_[index]);
 
     columns_.push_back(newColumn);
     index++;
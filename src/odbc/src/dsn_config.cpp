@@ -296,6 +296,105 @@ void ReadDsnConfiguration(const char* dsn, Configuration& config,
   if (defaultFetchSize.IsSet() && !config.IsDefaultFetchSizeSet()
       && defaultFetchSize.GetValue() > 0)
     config.SetDefaultFetchSize(defaultFetchSize.GetValue());
+
+  SettableValue< int32_t > prefetchBatches =
+      ReadDsnInt(dsn, ConnectionStringParser::Key::prefetchBatches);
+
+  if (prefetchBatches.IsSet() && !config.IsPrefetchBatchesSet()
+      && prefetchBatches.GetValue() >= 0)
+    config.SetPrefetchBatches(prefetchBatches.GetValue());
+
+  SettableValue< int32_t > prefetchMemoryLimit =
+      ReadDsnInt(dsn, ConnectionStringParser::Key::prefetchMemoryLimit);
+
+  if (prefetchMemoryLimit.IsSet() && !config.IsPrefetchMemoryLimitSet()
+      && prefetchMemoryLimit.GetValue() > 0)
+    config.SetPrefetchMemoryLimit(prefetchMemoryLimit.GetValue());
+
+  SettableValue< bool > adaptiveFetch =
+      ReadDsnBool(dsn, ConnectionStringParser::Key::adaptiveFetch);
+
+  if (adaptiveFetch.IsSet() && !config.IsAdaptiveFetchSet())
+    config.SetAdaptiveFetch(adaptiveFetch.GetValue());
+
+  SettableValue< int32_t > fetchMemoryLimit =
+      ReadDsnInt(dsn, ConnectionStringParser::Key::fetchMemoryLimit);
+
+  if (fetchMemoryLimit.IsSet() && !config.IsFetchMemoryLimitSet()
+      && fetchMemoryLimit.GetValue() > 0)
+    config.SetFetchMemoryLimit(fetchMemoryLimit.GetValue());
+
+  SettableValue< int32_t > queryCacheSize =
+      ReadDsnInt(dsn, ConnectionStringParser::Key::queryCacheSize);
+
+  if (queryCacheSize.IsSet() && !config.IsQueryCacheSizeSet()
+      && queryCacheSize.GetValue() >= 0)
+    config.SetQueryCacheSize(queryCacheSize.GetValue());
+
+  SettableValue< bool > nativeQueryTranslation =
+      ReadDsnBool(dsn, ConnectionStringParser::Key::nativeQueryTranslation);
+
+  if (nativeQueryTranslation.IsSet() && !config.IsNativeQueryTranslationSet())
+    config.SetNativeQueryTranslation(nativeQueryTranslation.GetValue());
+
+  SettableValue< int32_t > jvmInitialHeapSize =
+      ReadDsnInt(dsn, ConnectionStringParser::Key::jvmInitialHeapSize);
+
+  if (jvmInitialHeapSize.IsSet() && !config.IsJvmInitialHeapSizeSet()
+      && jvmInitialHeapSize.GetValue() > 0)
+    config.SetJvmInitialHeapSize(jvmInitialHeapSize.GetValue());
+
+  SettableValue< int32_t > jvmMaxHeapSize =
+      ReadDsnInt(dsn, ConnectionStringParser::Key::jvmMaxHeapSize);
+
+  if (jvmMaxHeapSize.IsSet() && !config.IsJvmMaxHeapSizeSet()
+      && jvmMaxHeapSize.GetValue() > 0)
+    config.SetJvmMaxHeapSize(jvmMaxHeapSize.GetValue());
+
+  SettableValue< std::string > jvmGarbageCollector =
+      ReadDsnString(dsn, ConnectionStringParser::Key::jvmGarbageCollector);
+
+  if (jvmGarbageCollector.IsSet() && !config.IsJvmGarbageCollectorSet())
+    config.SetJvmGarbageCollector(jvmGarbageCollector.GetValue());
+
+  SettableValue< std::string > jvmCdsArchive =
+      ReadDsnString(dsn, ConnectionStringParser::Key::jvmCdsArchive);
+
+  if (jvmCdsArchive.IsSet() && !config.IsJvmCdsArchiveSet())
+    config.SetJvmCdsArchive(jvmCdsArchive.GetValue());
+
+  SettableValue< std::string > metadataCacheDir =
+      ReadDsnString(dsn, ConnectionStringParser::Key::metadataCacheDir);
+
+  if (metadataCacheDir.IsSet() && !config.IsMetadataCacheDirSet())
+    config.SetMetadataCacheDir(metadataCacheDir.GetValue());
+
+  SettableValue< int32_t > metadataCacheTtl =
+      ReadDsnInt(dsn, ConnectionStringParser::Key::metadataCacheTtl);
+
+  if (metadataCacheTtl.IsSet() && !config.IsMetadataCacheTtlSet()
+      && metadataCacheTtl.GetValue() > 0)
+    config.SetMetadataCacheTtl(metadataCacheTtl.GetValue());
+
+  SettableValue< bool > nativeCatalog =
+      ReadDsnBool(dsn, ConnectionStringParser::Key::nativeCatalog);
+
+  if (nativeCatalog.IsSet() && !config.IsNativeCatalogSet())
+    config.SetNativeCatalog(nativeCatalog.GetValue());
+
+  SettableValue< int32_t > maxPoolSize =
+      ReadDsnInt(dsn, ConnectionStringParser::Key::maxPoolSize);
+
+  if (maxPoolSize.IsSet() && !config.IsMaxPoolSizeSet()
+      && maxPoolSize.GetValue() >= 0)
+    config.SetMaxPoolSize(maxPoolSize.GetValue());
+
+  SettableValue< int32_t > minPoolSize =
+      ReadDsnInt(dsn, ConnectionStringParser::Key::minPoolSize);
+
+  if (minPoolSize.IsSet() && !config.IsMinPoolSizeSet()
+      && minPoolSize.GetValue() >= 0)
+    config.SetMinPoolSize(minPoolSize.GetValue());
 }
 
 bool WriteDsnConfiguration(const config::Configuration& config, DocumentDbError& error) {
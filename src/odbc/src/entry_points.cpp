@@ -111,6 +111,10 @@ SQLRETURN SQL_API SQLCloseCursor(SQLHSTMT stmt) {
   return documentdb::SQLCloseCursor(stmt);
 }
 
+SQLRETURN SQL_API SQLCancel(SQLHSTMT stmt) {
+  return documentdb::SQLCancel(stmt);
+}
+
 SQLRETURN SQL_API
 SQLDriverConnect(SQLHDBC conn, SQLHWND windowHandle,
                  _In_reads_(inConnectionStringLen) SQLWCHAR* inConnectionString,
@@ -446,13 +450,6 @@ SQLRETURN SQL_API SQLEndTran(SQLSMALLINT handleType, SQLHANDLE handle,
 // ==== Not implemented ====
 //
 
-SQLRETURN SQL_API SQLCancel(SQLHSTMT stmt) {
-  DOCUMENTDB_UNUSED(stmt);
-
-  LOG_DEBUG_MSG("SQLCancel called");
-  return SQL_SUCCESS;
-}
-
 SQLRETURN SQL_API SQLColAttributes(SQLHSTMT stmt, SQLUSMALLINT colNum,
                                    SQLUSMALLINT fieldId,
                                    _Out_writes_bytes_opt_(strAttrBufLen)
@@ -20,6 +20,7 @@
 #include <cstdlib>
 
 #include "documentdb/odbc/connection.h"
+#include "documentdb/odbc/jni/jvm_prewarm.h"
 #include "documentdb/odbc/system/odbc_constants.h"
 
 namespace documentdb {
@@ -27,6 +28,8 @@ namespace odbc {
 Environment::Environment()
     : connections(), odbcVersion(SQL_OV_ODBC3), odbcNts(SQL_TRUE) {
   srand(common::GetRandSeed());
+
+  jni::JvmPrewarm::GetInstance().Start();
 }
 
 Environment::~Environment() {
@@ -74,13 +77,17 @@ SqlResult::Type Environment::InternalSetAttribute(int32_t attr, void* value,
       int32_t version =
           static_cast< int32_t >(reinterpret_cast< intptr_t >(value));
 
-      if (version != odbcVersion) {
+      // The driver is an ODBC 3.80 driver, which also supports the ODBC 3.x
+      // behaviour.
+      if (version != SQL_OV_ODBC3 && version != SQL_OV_ODBC3_80) {
         AddStatusRecord(SqlState::S01S02_OPTION_VALUE_CHANGED,
                         "ODBC version is not supported.");
 
         return SqlResult::AI_SUCCESS_WITH_INFO;
       }
 
+      odbcVersion = version;
+
       return SqlResult::AI_SUCCESS;
     }
 
@@ -29,6 +29,12 @@ namespace odbc {
 namespace jni {
 JniErrorCode DocumentDbConnection::Open(const Configuration& config,
                                         JniErrorInfo& errInfo) {
+  return Open(config, 0, errInfo);
+}
+
+JniErrorCode DocumentDbConnection::Open(const Configuration& config,
+                                        int32_t localSSHTunnelPort,
+                                        JniErrorInfo& errInfo) {
   bool connected = false;
 
   if (!_jniContext.IsValid()) {
@@ -40,7 +46,8 @@ JniErrorCode DocumentDbConnection::Open(const Configuration& config,
     return JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS;
   }
 
-  std::string connectionString = config.ToJdbcConnectionString();
+  std::string connectionString =
+      config.ToJdbcConnectionString(localSSHTunnelPort);
 
   SharedPointer< GlobalJObject > result;
   JniErrorCode success = _jniContext.Get()->DriverManagerGetConnection(
@@ -15,8 +15,28 @@
  * limitations under the License.
  */
 
+#include <documentdb/odbc/jni/documentdb_database_metadata.h>
+
 namespace documentdb {
 namespace odbc {
-namespace jni {}  // namespace jni
+namespace jni {
+JniErrorCode DocumentDbDatabaseMetadata::GetSchemaName(std::string& value,
+                                                       JniErrorInfo& errInfo) {
+  bool wasNull = false;
+  JniErrorCode success =
+      jniContext_.Get()->DocumentDbDatabaseSchemaMetadataGetSchemaName(
+          databaseMetadata_, value, wasNull, errInfo);
+  if (wasNull) {
+    value.clear();
+  }
+  return success;
+}
+
+JniErrorCode DocumentDbDatabaseMetadata::GetSchemaVersion(
+    int32_t& value, JniErrorInfo& errInfo) {
+  return jniContext_.Get()->DocumentDbDatabaseSchemaMetadataGetSchemaVersion(
+      databaseMetadata_, value, errInfo);
+}
+}  // namespace jni
 }  // namespace odbc
 }  // namespace documentdb
@@ -57,187 +57,19 @@ DocumentDbQueryMappingService::Create(
 bool ReadListOfString(SharedPointer< JniContext >& _jniContext,
                       const SharedPointer< GlobalJObject >& sourceList,
                       std::vector< std::string >& targetList) {
-  JniErrorCode success;
   JniErrorInfo errInfo;
-
-  int32_t listSize;
-  success = _jniContext.Get()->ListSize(sourceList, listSize, errInfo);
-  if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-    return false;
-  }
-
-  for (int32_t index = 0; index < listSize; index++) {
-    SharedPointer< GlobalJObject > operation;
-    success = _jniContext.Get()->ListGet(sourceList, index, operation, errInfo);
-    if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-      return false;
-    }
-    std::string value =
-        _jniContext.Get()->JavaStringToCppString(operation, errInfo);
-    if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-      return false;
-    }
-    targetList.push_back(value);
-  }
-
-  return true;
+  JniErrorCode success =
+      _jniContext.Get()->ListGetStrings(sourceList, targetList, errInfo);
+  return success == JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS;
 }
 
 bool DocumentDbQueryMappingService::ReadJdbcColumnMetadata(
     SharedPointer< GlobalJObject > const& columnMetadata,
     std::vector< JdbcColumnMetadata >& columnMetadataList,
     JniErrorInfo& errInfo) {
-  JniErrorCode success;
-  int32_t listSize;
-  success = jniContext_.Get()->ListSize(columnMetadata, listSize, errInfo);
-  if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-    return false;
-  }
-
-  for (int32_t index = 0; index < listSize; index++) {
-    SharedPointer< GlobalJObject > jdbcColumnMetadata;
-    success = jniContext_.Get()->ListGet(columnMetadata, index,
-                                         jdbcColumnMetadata, errInfo);
-    if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-      return false;
-    }
-
-    int32_t ordinal;
-    success = jniContext_.Get()->JdbcColumnMetadataGetOrdinal(
-        jdbcColumnMetadata, ordinal, errInfo);
-    if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-      return false;
-    }
-    bool autoIncrement;
-    success = jniContext_.Get()->JdbcColumnMetadataIsAutoIncrement(
-        jdbcColumnMetadata, autoIncrement, errInfo);
-    if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-      return false;
-    }
-    bool caseSensitive;
-    success = jniContext_.Get()->JdbcColumnMetadataIsCaseSensitive(
-        jdbcColumnMetadata, caseSensitive, errInfo);
-    if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-      return false;
-    }
-    bool searchable;
-    success = jniContext_.Get()->JdbcColumnMetadataIsSearchable(
-        jdbcColumnMetadata, searchable, errInfo);
-    if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-      return false;
-    }
-    bool currency;
-    success = jniContext_.Get()->JdbcColumnMetadataIsCurrency(
-        jdbcColumnMetadata, currency, errInfo);
-    if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-      return false;
-    }
-    int32_t nullable;
-    success = jniContext_.Get()->JdbcColumnMetadataGetNullable(
-        jdbcColumnMetadata, nullable, errInfo);
-    if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-      return false;
-    }
-    bool isSigned;
-    success = jniContext_.Get()->JdbcColumnMetadataIsSigned(jdbcColumnMetadata,
-                                                            isSigned, errInfo);
-    if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-      return false;
-    }
-    int32_t columnDisplaySize;
-    success = jniContext_.Get()->JdbcColumnMetadataGetColumnDisplaySize(
-        jdbcColumnMetadata, columnDisplaySize, errInfo);
-    if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-      return false;
-    }
-    boost::optional< std::string > columnLabel;
-    success = jniContext_.Get()->JdbcColumnMetadataGetColumnLabel(
-        jdbcColumnMetadata, columnLabel, errInfo);
-    if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-      return false;
-    }
-    boost::optional< std::string > columnName;
-    success = jniContext_.Get()->JdbcColumnMetadataGetColumnName(
-        jdbcColumnMetadata, columnName, errInfo);
-    if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-      return false;
-    }
-    boost::optional< std::string > schemaName;
-    success = jniContext_.Get()->JdbcColumnMetadataGetSchemaName(
-        jdbcColumnMetadata, schemaName, errInfo);
-    if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-      return false;
-    }
-    int32_t precision;
-    success = jniContext_.Get()->JdbcColumnMetadataGetPrecision(
-        jdbcColumnMetadata, precision, errInfo);
-    if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-      return false;
-    }
-    int32_t scale;
-    success = jniContext_.Get()->JdbcColumnMetadataGetScale(jdbcColumnMetadata,
-                                                            scale, errInfo);
-    if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-      return false;
-    }
-    boost::optional< std::string > tableName;
-    success = jniContext_.Get()->JdbcColumnMetadataGetTableName(
-        jdbcColumnMetadata, tableName, errInfo);
-    if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-      return false;
-    }
-    boost::optional< std::string > catalogName;
-    success = jniContext_.Get()->JdbcColumnMetadataGetCatalogName(
-        jdbcColumnMetadata, catalogName, errInfo);
-    if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-      return false;
-    }
-    int32_t columnType;
-    success = jniContext_.Get()->JdbcColumnMetadataGetColumnType(
-        jdbcColumnMetadata, columnType, errInfo);
-    if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-      return false;
-    }
-    boost::optional< std::string > columnTypeName;
-    success = jniContext_.Get()->JdbcColumnMetadataGetColumnTypeName(
-        jdbcColumnMetadata, columnTypeName, errInfo);
-    if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-      return false;
-    }
-    bool readOnly;
-    success = jniContext_.Get()->JdbcColumnMetadataIsReadOnly(
-        jdbcColumnMetadata, readOnly, errInfo);
-    if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-      return false;
-    }
-    bool writable;
-    success = jniContext_.Get()->JdbcColumnMetadataIsWritable(
-        jdbcColumnMetadata, writable, errInfo);
-    if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-      return false;
-    }
-    bool definitelyWritable;
-    success = jniContext_.Get()->JdbcColumnMetadataIsDefinitelyWritable(
-        jdbcColumnMetadata, definitelyWritable, errInfo);
-    if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-      return false;
-    }
-    boost::optional< std::string > columnClassName;
-    success = jniContext_.Get()->JdbcColumnMetadataGetColumnClassName(
-        jdbcColumnMetadata, columnClassName, errInfo);
-    if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-      return false;
-    }
-
-    JdbcColumnMetadata columnMetadataNode(
-        ordinal, autoIncrement, caseSensitive, searchable, currency, nullable,
-        isSigned, columnDisplaySize, columnLabel, columnName, schemaName,
-        precision, scale, tableName, catalogName, columnType, columnTypeName,
-        readOnly, writable, definitelyWritable, columnClassName);
-    columnMetadataList.push_back(columnMetadataNode);
-  }
-
-  return true;
+  JniErrorCode success = jniContext_.Get()->JdbcColumnMetadataListRead(
+      columnMetadata, columnMetadataList, errInfo);
+  return success == JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS;
 }
 
 SharedPointer< DocumentDbMqlQueryContext >
@@ -291,9 +123,11 @@ DocumentDbQueryMappingService::GetMqlQueryContext(const std::string& sql,
   if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
     return nullptr;
   }
-  ReadJdbcColumnMetadata(columnMetadata,
-                         documentDbMqlQueryContext.Get()->GetColumnMetadata(),
-                         errInfo);
+  if (!ReadJdbcColumnMetadata(
+          columnMetadata, documentDbMqlQueryContext.Get()->GetColumnMetadata(),
+          errInfo)) {
+    return nullptr;
+  }
 
   return documentDbMqlQueryContext;
 }
@@ -17,9 +17,11 @@
 
 // ReSharper disable once CppUnusedIncludeDirective
 #include <documentdb/odbc/common/common.h>
+#include <documentdb/odbc/common/platform_utils.h>
 #include <documentdb/odbc/common/utils.h>
 #include <documentdb/odbc/documentdb_error.h>
 #include <documentdb/odbc/jni/java.h>
+#include <documentdb/odbc/jni/jdbc_column_metadata.h>
 #include <documentdb/odbc/jni/utils.h>
 #include <documentdb/odbc/log.h>
 
@@ -93,6 +95,12 @@ namespace jni {
 namespace java {
 namespace iocc = documentdb::odbc::common::concurrent;
 
+/** JVM option recording the classes to dump to a CDS archive. */
+const char* const OPT_RECORD_DYNAMIC_DUMP_INFO = "-XX:+RecordDynamicDumpInfo";
+
+/** JVM option naming the CDS archive to dump the recorded classes to. */
+const char* const OPT_CDS_DUMP_ARCHIVE = "-Ddocumentdb.cds.dumpArchive=";
+
 bool DOCUMENTDB_IMPORT_EXPORT IsJava9OrLater() {
   LOG_DEBUG_MSG("IsJava9OrLater called");
 
@@ -107,16 +115,17 @@ bool DOCUMENTDB_IMPORT_EXPORT IsJava9OrLater() {
   return JNI_GetDefaultJavaVMInitArgs(&args) == JNI_OK;
 }
 
-void BuildJvmOptions(const std::string& cp, std::vector< char* >& opts, int xms,
-                     int xmx) {
+void BuildJvmOptions(const std::string& cp, std::vector< char* >& opts,
+                     const JvmSettings& settings) {
   LOG_DEBUG_MSG("BuildJvmOptions is called");
 
   using namespace common;
 
   const size_t REQ_OPTS_CNT = 4;
   const size_t JAVA9_OPTS_CNT = 6;
+  const size_t TUNING_OPTS_CNT = 4;
 
-  opts.reserve(REQ_OPTS_CNT + JAVA9_OPTS_CNT);
+  opts.reserve(REQ_OPTS_CNT + JAVA9_OPTS_CNT + TUNING_OPTS_CNT);
 
   // 1. Set calcite default charset to utf8.
   opts.push_back(CopyChars("-Dcalcite.default.charset=utf8"));
@@ -126,8 +135,8 @@ void BuildJvmOptions(const std::string& cp, std::vector< char* >& opts, int xms,
   opts.push_back(CopyChars(cpFull.c_str()));
 
   // 3. Set Xms, Xmx.
-  std::string xmsStr = "-Xms" + std::to_string(xms) + "m";
-  std::string xmxStr = "-Xmx" + std::to_string(xmx) + "m";
+  std::string xmsStr = "-Xms" + std::to_string(settings.initialHeapSize) + "m";
+  std::string xmxStr = "-Xmx" + std::to_string(settings.maxHeapSize) + "m";
 
   opts.push_back(CopyChars(xmsStr.c_str()));
   opts.push_back(CopyChars(xmxStr.c_str()));
@@ -142,6 +151,32 @@ void BuildJvmOptions(const std::string& cp, std::vector< char* >& opts, int xms,
   std::string fileEncFull = fileEncParam + "UTF-8";
   opts.push_back(CopyChars(fileEncFull.c_str()));
 
+  // 6. Set the garbage collector.
+  if (settings.garbageCollector == "serial") {
+    opts.push_back(CopyChars("-XX:+UseSerialGC"));
+  } else if (settings.garbageCollector == "parallel") {
+    opts.push_back(CopyChars("-XX:+UseParallelGC"));
+  } else if (settings.garbageCollector == "g1") {
+    opts.push_back(CopyChars("-XX:+UseG1GC"));
+  }
+
+  // 7. Set class data sharing. An existing archive is mapped if it matches
+  // the JVM and the classpath, and silently ignored otherwise. A missing
+  // archive is dumped later by JniContext::DumpSharedArchive, which requires
+  // Java 17 or later; older versions ignore the options.
+  if (!settings.cdsArchive.empty()) {
+    if (FileExists(settings.cdsArchive)) {
+      std::string archive = "-XX:SharedArchiveFile=" + settings.cdsArchive;
+      opts.push_back(CopyChars(archive.c_str()));
+      opts.push_back(CopyChars("-Xshare:auto"));
+    } else {
+      std::string dumpArchive = OPT_CDS_DUMP_ARCHIVE + settings.cdsArchive;
+      opts.push_back(CopyChars(OPT_RECORD_DYNAMIC_DUMP_INFO));
+      opts.push_back(CopyChars(dumpArchive.c_str()));
+    }
+    opts.push_back(CopyChars("-XX:+IgnoreUnrecognizedVMOptions"));
+  }
+
   // Adding options for Java 9 or later
   if (jni::java::IsJava9OrLater()) {
     opts.push_back(
@@ -224,6 +259,9 @@ JniMethod const M_CLASS_GET_NAME =
     JniMethod("getName", "()Ljava/lang/String;", false);
 
 const char* const C_STRING = "java/lang/String";
+JniMethod const M_STRING_JOIN = JniMethod(
+    "join", "(Ljava/lang/CharSequence;Ljava/lang/Iterable;)Ljava/lang/String;",
+    true);
 
 const char* const C_DOCUMENTDB_CONNECTION_PROPERTIES =
     "software/amazon/documentdb/jdbc/DocumentDbConnectionProperties";
@@ -295,10 +333,14 @@ const char* const C_DOCUMENTDB_DATABASE_SCHEMA_METADATA =
     "software/amazon/documentdb/jdbc/metadata/DocumentDbDatabaseSchemaMetadata";
 JniMethod const M_DOCUMENTDB_DATABASE_SCHEMA_METADATA_GET_SCHEMA_NAME =
     JniMethod("getSchemaName", "()Ljava/lang/String;", false);
+JniMethod const M_DOCUMENTDB_DATABASE_SCHEMA_METADATA_GET_SCHEMA_VERSION =
+    JniMethod("getSchemaVersion", "()I", false);
 
 const char* const C_DRIVERMANAGER = "java/sql/DriverManager";
 JniMethod const M_DRIVERMANAGER_GET_CONNECTION = JniMethod(
     "getConnection", "(Ljava/lang/String;)Ljava/sql/Connection;", true);
+JniMethod const M_DRIVERMANAGER_GET_DRIVERS =
+    JniMethod("getDrivers", "()Ljava/util/Enumeration;", true);
 
 const char* const C_JAVA_SQL_CONNECTION = "java/sql/Connection";
 JniMethod const M_JAVA_SQL_CONNECTION_CLOSE = JniMethod("close", "()V", false);
@@ -310,6 +352,8 @@ JniMethod const M_LIST_SIZE = JniMethod("size", "()I", false);
 JniMethod const M_LIST_TO_ARRAY =
     JniMethod("toArray", "()[Ljava/lang/Object;", false);
 JniMethod const M_LIST_GET = JniMethod("get", "(I)Ljava/lang/Object;", false);
+JniMethod const M_LIST_CONTAINS =
+    JniMethod("contains", "(Ljava/lang/Object;)Z", false);
 
 const char* const C_ITERATOR = "java/util/Iterator";
 JniMethod const M_ITERATOR_NEXT =
@@ -400,6 +444,7 @@ iocc::CriticalSection JVM_LOCK;
 iocc::CriticalSection CONSOLE_LOCK;
 JniJvm JVM;
 bool PRINT_EXCEPTION = false;
+std::string CDS_DUMP_ARCHIVE;
 std::vector< ConsoleWriteHandler > consoleWriteHandlers;
 
 /* HELPER METHODS. */
@@ -551,6 +596,7 @@ void JniJavaMembers::Initialize(JNIEnv* env) {
       FindMethod(env, c_Throwable, M_THROWABLE_PRINT_STACK_TRACE);
 
   c_String = FindClass(env, C_STRING);
+  m_String_join = FindMethod(env, c_String, M_STRING_JOIN);
 
   // TODO: Provide "getFullStackTrace" in DocumentDB
   // m_PlatformUtils_getFullStackTrace = FindMethod(env, c_PlatformUtils,
@@ -652,10 +698,15 @@ void JniMembers::Initialize(JNIEnv* env) {
   m_DocumentDbDatabaseSchemaMetadataGetSchemaName =
       FindMethod(env, c_DocumentDbDatabaseSchemaMetadata,
                  M_DOCUMENTDB_DATABASE_SCHEMA_METADATA_GET_SCHEMA_NAME);
+  m_DocumentDbDatabaseSchemaMetadataGetSchemaVersion =
+      FindMethod(env, c_DocumentDbDatabaseSchemaMetadata,
+                 M_DOCUMENTDB_DATABASE_SCHEMA_METADATA_GET_SCHEMA_VERSION);
 
   c_DriverManager = FindClass(env, C_DRIVERMANAGER);
   m_DriverManagerGetConnection =
       FindMethod(env, c_DriverManager, M_DRIVERMANAGER_GET_CONNECTION);
+  m_DriverManagerGetDrivers =
+      FindMethod(env, c_DriverManager, M_DRIVERMANAGER_GET_DRIVERS);
 
   c_ResultSet = FindClass(env, C_RECORD_SET);
   m_ResultSetClose = FindMethod(env, c_ResultSet, M_RECORD_SET_CLOSE);
@@ -692,6 +743,8 @@ void JniMembers::Initialize(JNIEnv* env) {
   c_List = FindClass(env, C_LIST);
   m_ListSize = FindMethod(env, c_List, M_LIST_SIZE);
   m_ListGet = FindMethod(env, c_List, M_LIST_GET);
+  m_ListToArray = FindMethod(env, c_List, M_LIST_TO_ARRAY);
+  m_ListContains = FindMethod(env, c_List, M_LIST_CONTAINS);
 
   c_DocumentDbMqlQueryContext = FindClass(env, C_DOCUMENTDB_MQL_QUERY_CONTEXT);
   m_DocumentDbMqlQueryContextGetAggregateOperationsAsStrings = FindMethod(
@@ -830,6 +883,44 @@ jobject GlobalJObject::GetRef() const {
   return ref;
 }
 
+/** Environment of the current thread, set when it is first attached. */
+static thread_local JNIEnv* threadEnv = nullptr;
+
+/**
+ * Attach the current thread to the JVM once and cache its environment.
+ *
+ * @param jvm JVM.
+ * @return Environment or null if the thread could not be attached.
+ */
+JNIEnv* AttachThread(JavaVM* jvm) {
+  if (threadEnv)
+    return threadEnv;
+
+  JNIEnv* env = nullptr;
+  jint attachRes =
+      jvm->AttachCurrentThread(reinterpret_cast< void** >(&env), nullptr);
+  if (attachRes != JNI_OK) {
+    LOG_INFO_MSG("attachRes: " << attachRes);
+    return nullptr;
+  }
+
+  // Detaches the thread when it exits.
+  AttachHelper::OnThreadAttach();
+  threadEnv = env;
+
+  return env;
+}
+
+JniLocalFrame::JniLocalFrame(JNIEnv* env, jint capacity)
+    : env(env), pushed(env->PushLocalFrame(capacity) == JNI_OK) {
+  // No-op.
+}
+
+JniLocalFrame::~JniLocalFrame() {
+  if (pushed)
+    env->PopLocalFrame(nullptr);
+}
+
 /**
  * Create JVM.
  */
@@ -868,6 +959,21 @@ jint GetOrCreateJvm(char** opts, int optsLen, JavaVM** jvm, JNIEnv** env) {
 
   delete[] opts0;
 
+  // The archive can only be dumped if the classes are being recorded, which
+  // is decided once, by the options the JVM is created with.
+  if (res == JNI_OK) {
+    bool recording = false;
+    std::string archive;
+    size_t prefixLen = strlen(OPT_CDS_DUMP_ARCHIVE);
+    for (int i = 0; i < optsLen; i++) {
+      if (strcmp(opts[i], OPT_RECORD_DYNAMIC_DUMP_INFO) == 0)
+        recording = true;
+      else if (strncmp(opts[i], OPT_CDS_DUMP_ARCHIVE, prefixLen) == 0)
+        archive = opts[i] + prefixLen;
+    }
+    CDS_DUMP_ARCHIVE = recording ? archive : std::string();
+  }
+
   LOG_INFO_MSG("There is no previous Jvm created. Created new Jvm.");
   LOG_DEBUG_MSG("GetOrCreateJvm exiting");
 
@@ -1031,18 +1137,9 @@ JniContext* JniContext::Create(char** opts, int optsLen,
 int JniContext::Reallocate(int64_t memPtr, int cap) {
   LOG_DEBUG_MSG("Reallocate is called");
 
-  JavaVM* jvm = JVM.GetJvm();
-
-  JNIEnv* env;
-
-  int attachRes =
-      jvm->AttachCurrentThread(reinterpret_cast< void** >(&env), nullptr);
-
-  if (attachRes == JNI_OK)
-    AttachHelper::OnThreadAttach();
-  else {
+  JNIEnv* env = AttachThread(JVM.GetJvm());
+  if (!env) {
     LOG_ERROR_MSG("Reallocate exiting with -1");
-    LOG_INFO_MSG("attachRes: " << attachRes);
     return -1;
   }
 
@@ -1064,6 +1161,8 @@ int JniContext::Reallocate(int64_t memPtr, int cap) {
 void JniContext::Detach() {
   iocc::Memory::Fence();
 
+  threadEnv = nullptr;
+
   if (JVM.GetJvm()) {
     JNIEnv* env;
 
@@ -1097,6 +1196,7 @@ JniErrorCode JniContext::DriverManagerGetConnection(
   if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
     return errInfo.code;
   }
+  JniLocalFrame localFrame(env);
 
   // TODO enable string logging and hide the user password.
   // https://github.com/aws/amazon-documentdb-odbc-driver/issues/180
@@ -1120,6 +1220,130 @@ JniErrorCode JniContext::DriverManagerGetConnection(
   return errInfo.code;
 }
 
+JniErrorCode JniContext::DriverManagerLoadDrivers(JniErrorInfo& errInfo) {
+  LOG_DEBUG_MSG("DriverManagerLoadDrivers is called");
+
+  JNIEnv* env = Attach(errInfo);
+  if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
+    return errInfo.code;
+  }
+  JniLocalFrame localFrame(env);
+
+  // Loads and registers the JDBC drivers found on the classpath, the same way
+  // as the first call of getConnection.
+  env->CallStaticObjectMethod(jvm->GetMembers().c_DriverManager,
+                              jvm->GetMembers().m_DriverManagerGetDrivers);
+  ExceptionCheck(env, &errInfo);
+
+  LOG_DEBUG_MSG("DriverManagerLoadDrivers exiting");
+
+  return errInfo.code;
+}
+
+std::string JniContext::GetSharedArchiveDumpPath() {
+  iocc::CsLockGuard guard(JVM_LOCK);
+
+  return CDS_DUMP_ARCHIVE;
+}
+
+JniErrorCode JniContext::DumpSharedArchive(const std::string& path,
+                                           JniErrorInfo& errInfo) {
+  LOG_DEBUG_MSG("DumpSharedArchive is called");
+
+  JNIEnv* env = Attach(errInfo);
+  if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
+    return errInfo.code;
+  }
+  JniLocalFrame localFrame(env);
+
+  // The archive is dumped at most once per process, so the members are looked
+  // up here instead of when the JVM is created. This is the equivalent of
+  // "jcmd <pid> VM.cds dynamic_dump <path>".
+  jclass cManagementFactory =
+      env->FindClass("java/lang/management/ManagementFactory");
+  ExceptionCheck(env, &errInfo);
+  if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
+    return errInfo.code;
+  }
+
+  jmethodID mGetPlatformMBeanServer = env->GetStaticMethodID(
+      cManagementFactory, "getPlatformMBeanServer",
+      "()Ljavax/management/MBeanServer;");
+  ExceptionCheck(env, &errInfo);
+  if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
+    return errInfo.code;
+  }
+
+  jobject server =
+      env->CallStaticObjectMethod(cManagementFactory, mGetPlatformMBeanServer);
+  ExceptionCheck(env, &errInfo);
+  if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
+    return errInfo.code;
+  }
+
+  jclass cObjectName = env->FindClass("javax/management/ObjectName");
+  ExceptionCheck(env, &errInfo);
+  if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
+    return errInfo.code;
+  }
+
+  jmethodID mObjectNameCtor =
+      env->GetMethodID(cObjectName, "<init>", "(Ljava/lang/String;)V");
+  ExceptionCheck(env, &errInfo);
+  if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
+    return errInfo.code;
+  }
+
+  jobject name = env->NewObject(
+      cObjectName, mObjectNameCtor,
+      env->NewStringUTF("com.sun.management:type=DiagnosticCommand"));
+  ExceptionCheck(env, &errInfo);
+  if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
+    return errInfo.code;
+  }
+
+  jclass cMBeanServer = env->GetObjectClass(server);
+  jmethodID mInvoke = env->GetMethodID(
+      cMBeanServer, "invoke",
+      "(Ljavax/management/ObjectName;Ljava/lang/String;[Ljava/lang/Object;"
+      "[Ljava/lang/String;)Ljava/lang/Object;");
+  ExceptionCheck(env, &errInfo);
+  if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
+    return errInfo.code;
+  }
+
+  jclass cString = jvm->GetJavaMembers().c_String;
+
+  // The arguments of the command are joined by spaces, so a path with spaces
+  // must be quoted.
+  std::string quotedPath = path.find(' ') == std::string::npos
+                               ? path
+                               : "\"" + path + "\"";
+
+  jobjectArray cmdArgs = env->NewObjectArray(2, cString, nullptr);
+  env->SetObjectArrayElement(cmdArgs, 0, env->NewStringUTF("dynamic_dump"));
+  env->SetObjectArrayElement(cmdArgs, 1,
+                             env->NewStringUTF(quotedPath.c_str()));
+
+  jclass cObject = env->FindClass("java/lang/Object");
+  ExceptionCheck(env, &errInfo);
+  if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
+    return errInfo.code;
+  }
+  jobjectArray params = env->NewObjectArray(1, cObject, cmdArgs);
+
+  jobjectArray signature = env->NewObjectArray(
+      1, cString, env->NewStringUTF("[Ljava.lang.String;"));
+
+  env->CallObjectMethod(server, mInvoke, name, env->NewStringUTF("vmCds"),
+                        params, signature);
+  ExceptionCheck(env, &errInfo);
+
+  LOG_DEBUG_MSG("DumpSharedArchive exiting");
+
+  return errInfo.code;
+}
+
 JniErrorCode JniContext::ConnectionClose(
     const SharedPointer< GlobalJObject >& connection, JniErrorInfo& errInfo) {
   LOG_DEBUG_MSG("ConnectionClose is called");
@@ -1226,6 +1450,7 @@ JniErrorCode JniContext::DocumentDbConnectionGetDatabaseMetadata(
   if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
     return errInfo.code;
   }
+  JniLocalFrame localFrame(env);
 
   jobject result = env->CallObjectMethod(
       connection.Get()->GetRef(),
@@ -1268,6 +1493,7 @@ JniErrorCode JniContext::DocumentDbConnectionGetConnectionProperties(
   if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
     return errInfo.code;
   }
+  JniLocalFrame localFrame(env);
 
   jobject result = env->CallObjectMethod(
       connection.Get()->GetRef(),
@@ -1306,6 +1532,7 @@ JniErrorCode JniContext::DocumentDbDatabaseSchemaMetadataGetSchemaName(
   if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
     return errInfo.code;
   }
+  JniLocalFrame localFrame(env);
 
   jobject result = env->CallObjectMethod(
       databaseMetadata.Get()->GetRef(),
@@ -1326,6 +1553,35 @@ JniErrorCode JniContext::DocumentDbDatabaseSchemaMetadataGetSchemaName(
   return errInfo.code;
 }
 
+JniErrorCode JniContext::DocumentDbDatabaseSchemaMetadataGetSchemaVersion(
+    const SharedPointer< GlobalJObject >& databaseMetadata, int32_t& value,
+    JniErrorInfo& errInfo) {
+  LOG_DEBUG_MSG("DocumentDbDatabaseSchemaMetadataGetSchemaVersion is called");
+  if (!databaseMetadata.Get()) {
+    errInfo.code = JniErrorCode::DOCUMENTDB_JNI_ERR_GENERIC;
+    errInfo.errMsg = "DatabaseMetadata object must be set.";
+    LOG_ERROR_MSG(
+        "DocumentDbDatabaseSchemaMetadataGetSchemaVersion exiting with error "
+        "msg: "
+        << errInfo.errMsg);
+    return errInfo.code;
+  }
+
+  JNIEnv* env = Attach(errInfo);
+  if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
+    return errInfo.code;
+  }
+
+  value = env->CallIntMethod(
+      databaseMetadata.Get()->GetRef(),
+      jvm->GetMembers().m_DocumentDbDatabaseSchemaMetadataGetSchemaVersion);
+  ExceptionCheck(env, &errInfo);
+
+  LOG_DEBUG_MSG("DocumentDbDatabaseSchemaMetadataGetSchemaVersion exiting");
+
+  return errInfo.code;
+}
+
 JniErrorCode JniContext::ConnectionGetMetaData(
     const SharedPointer< GlobalJObject >& connection,
     SharedPointer< GlobalJObject >& databaseMetaData, JniErrorInfo& errInfo) {
@@ -1345,6 +1601,7 @@ JniErrorCode JniContext::ConnectionGetMetaData(
   if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
     return errInfo.code;
   }
+  JniLocalFrame localFrame(env);
 
   jobject result = env->CallObjectMethod(
       connection.Get()->GetRef(), jvm->GetMembers().m_ConnectionGetMetaData);
@@ -1390,6 +1647,7 @@ JniErrorCode JniContext::DatabaseMetaDataGetTables(
   if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
     return errInfo.code;
   }
+  JniLocalFrame localFrame(env);
 
   jstring jCatalog = catalog ? env->NewStringUTF(catalog->c_str()) : nullptr;
   jstring jSchemaPattern =
@@ -1456,6 +1714,7 @@ JniErrorCode JniContext::DatabaseMetaDataGetColumns(
   if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
     return errInfo.code;
   }
+  JniLocalFrame localFrame(env);
 
   jstring jCatalog = catalog ? env->NewStringUTF(catalog->c_str()) : nullptr;
   jstring jSchemaPattern =
@@ -1511,6 +1770,7 @@ JniErrorCode JniContext::DatabaseMetaDataGetPrimaryKeys(
   if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
     return errInfo.code;
   }
+  JniLocalFrame localFrame(env);
 
   jstring jCatalog = catalog ? env->NewStringUTF(catalog->c_str()) : nullptr;
   jstring jSchema = schema ? env->NewStringUTF(schema->c_str()) : nullptr;
@@ -1562,6 +1822,7 @@ JniErrorCode JniContext::DatabaseMetaDataGetImportedKeys(
   if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
     return errInfo.code;
   }
+  JniLocalFrame localFrame(env);
 
   jstring jCatalog = catalog ? env->NewStringUTF(catalog->c_str()) : nullptr;
   jstring jSchema = schema ? env->NewStringUTF(schema->c_str()) : nullptr;
@@ -1611,6 +1872,7 @@ JniErrorCode JniContext::DatabaseMetaDataGetTypeInfo(
   if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
     return errInfo.code;
   }
+  JniLocalFrame localFrame(env);
 
   jobject result =
       env->CallObjectMethod(databaseMetaData.Get()->GetRef(),
@@ -1710,6 +1972,7 @@ JniErrorCode JniContext::ResultSetGetString(
   if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
     return errInfo.code;
   }
+  JniLocalFrame localFrame(env);
 
   jobject result = env->CallObjectMethod(
       resultSet.Get()->GetRef(), jvm->GetMembers().m_ResultSetGetStringByIndex,
@@ -1750,6 +2013,7 @@ JniErrorCode JniContext::ResultSetGetString(
   if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
     return errInfo.code;
   }
+  JniLocalFrame localFrame(env);
 
   jstring jColumnName = env->NewStringUTF(columnName.c_str());
   jobject result = env->CallObjectMethod(
@@ -1830,6 +2094,7 @@ JniErrorCode JniContext::ResultSetGetInt(
   if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
     return errInfo.code;
   }
+  JniLocalFrame localFrame(env);
 
   jstring jColumnName = env->NewStringUTF(columnName.c_str());
   jint result = env->CallIntMethod(resultSet.Get()->GetRef(),
@@ -1968,6 +2233,7 @@ JniErrorCode JniContext::ListGet(const SharedPointer< GlobalJObject >& list,
   if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
     return errInfo.code;
   }
+  JniLocalFrame localFrame(env);
 
   jobject result = env->CallObjectMethod(list.Get()->GetRef(),
                                          jvm->GetMembers().m_ListGet, index);
@@ -1986,6 +2252,224 @@ JniErrorCode JniContext::ListGet(const SharedPointer< GlobalJObject >& list,
   return errInfo.code;
 }
 
+JniErrorCode JniContext::ListGetStrings(
+    const SharedPointer< GlobalJObject >& list,
+    std::vector< std::string >& values, JniErrorInfo& errInfo) {
+  LOG_DEBUG_MSG("ListGetStrings is called");
+
+  if (!list.IsValid()) {
+    errInfo.code = JniErrorCode::DOCUMENTDB_JNI_ERR_GENERIC;
+    errInfo.errMsg = "List object must be set.";
+
+    LOG_ERROR_MSG("ListGetStrings exiting with error msg: " << errInfo.errMsg);
+
+    return errInfo.code;
+  }
+
+  JNIEnv* env = Attach(errInfo);
+  if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
+    return errInfo.code;
+  }
+
+  jint size =
+      env->CallIntMethod(list.Get()->GetRef(), jvm->GetMembers().m_ListSize);
+  ExceptionCheck(env, &errInfo);
+  if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS || size == 0) {
+    return errInfo.code;
+  }
+
+  // String.join renders a null element as "null", so a list with null
+  // elements is read one value at a time below.
+  jboolean hasNull = env->CallBooleanMethod(
+      list.Get()->GetRef(), jvm->GetMembers().m_ListContains, nullptr);
+  ExceptionCheck(env, &errInfo);
+  if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
+    return errInfo.code;
+  }
+
+  // Join the list in Java with U+0000 as the separator, so the whole list
+  // crosses JNI as one string. U+0000 is "\xC0\x80" in modified UTF-8.
+  jstring separator = hasNull ? nullptr : env->NewStringUTF("\xC0\x80");
+  jstring joined = nullptr;
+  if (separator) {
+    joined = static_cast< jstring >(env->CallStaticObjectMethod(
+        jvm->GetJavaMembers().c_String, jvm->GetJavaMembers().m_String_join,
+        separator, list.Get()->GetRef()));
+    env->DeleteLocalRef(separator);
+  }
+  ExceptionCheck(env, &errInfo);
+  if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
+    return errInfo.code;
+  }
+
+  std::vector< std::string > parts;
+  if (joined) {
+    jsize utfLen = env->GetStringUTFLength(joined);
+    std::string buffer(static_cast< size_t >(utfLen) + 1, '\0');
+    env->GetStringUTFRegion(joined, 0, env->GetStringLength(joined),
+                            &buffer[0]);
+    buffer.resize(static_cast< size_t >(utfLen));
+    env->DeleteLocalRef(joined);
+
+    parts.reserve(static_cast< size_t >(size));
+    size_t begin = 0;
+    for (;;) {
+      size_t end = buffer.find("\xC0\x80", begin);
+      if (end == std::string::npos) {
+        parts.push_back(buffer.substr(begin));
+        break;
+      }
+      parts.push_back(buffer.substr(begin, end - begin));
+      begin = end + 2;
+    }
+  }
+
+  if (parts.size() == static_cast< size_t >(size)) {
+    values.insert(values.end(), parts.begin(), parts.end());
+
+    LOG_DEBUG_MSG("ListGetStrings exiting");
+
+    return errInfo.code;
+  }
+
+  // Some value is null or contains U+0000, read the values one by one.
+  // A null value is read as an empty string.
+  jobjectArray array = static_cast< jobjectArray >(env->CallObjectMethod(
+      list.Get()->GetRef(), jvm->GetMembers().m_ListToArray));
+  ExceptionCheck(env, &errInfo);
+  if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS || !array) {
+    return errInfo.code;
+  }
+
+  jsize length = env->GetArrayLength(array);
+  for (jsize i = 0; i < length; ++i) {
+    jstring value =
+        static_cast< jstring >(env->GetObjectArrayElement(array, i));
+    int len;
+    values.push_back(JavaStringToCString(env, value, len));
+    env->DeleteLocalRef(value);
+  }
+  env->DeleteLocalRef(array);
+
+  LOG_DEBUG_MSG("ListGetStrings exiting");
+
+  return errInfo.code;
+}
+
+JniErrorCode JniContext::JdbcColumnMetadataListRead(
+    const SharedPointer< GlobalJObject >& list,
+    std::vector< JdbcColumnMetadata >& columns, JniErrorInfo& errInfo) {
+  LOG_DEBUG_MSG("JdbcColumnMetadataListRead is called");
+
+  if (!list.IsValid()) {
+    errInfo.code = JniErrorCode::DOCUMENTDB_JNI_ERR_GENERIC;
+    errInfo.errMsg = "List object must be set.";
+
+    LOG_ERROR_MSG(
+        "JdbcColumnMetadataListRead exiting with error msg: "
+        << errInfo.errMsg);
+
+    return errInfo.code;
+  }
+
+  JNIEnv* env = Attach(errInfo);
+  if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
+    return errInfo.code;
+  }
+
+  jobjectArray array = static_cast< jobjectArray >(env->CallObjectMethod(
+      list.Get()->GetRef(), jvm->GetMembers().m_ListToArray));
+  ExceptionCheck(env, &errInfo);
+  if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS || !array) {
+    return errInfo.code;
+  }
+
+  const JniMembers& members = jvm->GetMembers();
+  jsize length = env->GetArrayLength(array);
+  columns.reserve(columns.size() + static_cast< size_t >(length));
+
+  jobject column = nullptr;
+  bool failed = false;
+
+  auto readInt = [&](jmethodID method) -> int32_t {
+    if (failed)
+      return 0;
+    jint value = env->CallIntMethod(column, method);
+    failed = env->ExceptionCheck() == JNI_TRUE;
+    return value;
+  };
+  auto readBool = [&](jmethodID method) -> bool {
+    if (failed)
+      return false;
+    jboolean value = env->CallBooleanMethod(column, method);
+    failed = env->ExceptionCheck() == JNI_TRUE;
+    return value == JNI_TRUE;
+  };
+  auto readString = [&](jmethodID method) -> boost::optional< std::string > {
+    if (failed)
+      return boost::none;
+    jstring value =
+        static_cast< jstring >(env->CallObjectMethod(column, method));
+    failed = env->ExceptionCheck() == JNI_TRUE;
+    if (failed || !value)
+      return boost::none;
+    int len;
+    return JavaStringToCString(env, value, len);
+  };
+
+  for (jsize i = 0; i < length && !failed; ++i) {
+    JniLocalFrame columnFrame(env);
+    column = env->GetObjectArrayElement(array, i);
+
+    // Arguments are evaluated in unspecified order, so read into locals.
+    int32_t ordinal = readInt(members.m_JdbcColumnMetadataGetOrdinal);
+    bool autoIncrement = readBool(members.m_JdbcColumnMetadataIsAutoIncrement);
+    bool caseSensitive = readBool(members.m_JdbcColumnMetadataIsCaseSensitive);
+    bool searchable = readBool(members.m_JdbcColumnMetadataIsSearchable);
+    bool currency = readBool(members.m_JdbcColumnMetadataIsCurrency);
+    int32_t nullable = readInt(members.m_JdbcColumnMetadataGetNullable);
+    bool isSigned = readBool(members.m_JdbcColumnMetadataIsSigned);
+    int32_t columnDisplaySize =
+        readInt(members.m_JdbcColumnMetadataGetColumnDisplaySize);
+    boost::optional< std::string > columnLabel =
+        readString(members.m_JdbcColumnMetadataGetColumnLabel);
+    boost::optional< std::string > columnName =
+        readString(members.m_JdbcColumnMetadataGetColumnName);
+    boost::optional< std::string > schemaName =
+        readString(members.m_JdbcColumnMetadataGetSchemaName);
+    int32_t precision = readInt(members.m_JdbcColumnMetadataGetPrecision);
+    int32_t scale = readInt(members.m_JdbcColumnMetadataGetScale);
+    boost::optional< std::string > tableName =
+        readString(members.m_JdbcColumnMetadataGetTableName);
+    boost::optional< std::string > catalogName =
+        readString(members.m_JdbcColumnMetadataGetCatalogName);
+    int32_t columnType = readInt(members.m_JdbcColumnMetadataGetColumnType);
+    boost::optional< std::string > columnTypeName =
+        readString(members.m_JdbcColumnMetadataGetColumnTypeName);
+    bool readOnly = readBool(members.m_JdbcColumnMetadataIsReadOnly);
+    bool writable = readBool(members.m_JdbcColumnMetadataIsWritable);
+    bool definitelyWritable =
+        readBool(members.m_JdbcColumnMetadataIsDefinitelyWritable);
+    boost::optional< std::string > columnClassName =
+        readString(members.m_JdbcColumnMetadataGetColumnClassName);
+
+    if (!failed) {
+      columns.push_back(JdbcColumnMetadata(
+          ordinal, autoIncrement, caseSensitive, searchable, currency,
+          nullable, isSigned, columnDisplaySize, columnLabel, columnName,
+          schemaName, precision, scale, tableName, catalogName, columnType,
+          columnTypeName, readOnly, writable, definitelyWritable,
+          columnClassName));
+    }
+  }
+  env->DeleteLocalRef(array);
+  ExceptionCheck(env, &errInfo);
+
+  LOG_DEBUG_MSG("JdbcColumnMetadataListRead exiting");
+
+  return errInfo.code;
+}
+
 JniErrorCode
 JniContext::DocumentdbMqlQueryContextGetAggregateOperationsAsStrings(
     const SharedPointer< GlobalJObject >& mqlQueryContext,
@@ -2052,6 +2536,7 @@ JniErrorCode JniContext::DocumentdbMqlQueryContextGetColumnMetadata(
   if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
     return errInfo.code;
   }
+  JniLocalFrame localFrame(env);
 
   jobject result = env->CallObjectMethod(
       mqlQueryContext.Get()->GetRef(),
@@ -2093,6 +2578,7 @@ JniErrorCode JniContext::DocumentdbMqlQueryContextGetCollectionName(
   if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
     return errInfo.code;
   }
+  JniLocalFrame localFrame(env);
 
   jstring result = static_cast< jstring >(env->CallObjectMethod(
       mqlQueryContext.Get()->GetRef(),
@@ -2134,6 +2620,7 @@ JniErrorCode JniContext::DocumentdbMqlQueryContextGetPaths(
   if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
     return errInfo.code;
   }
+  JniLocalFrame localFrame(env);
 
   jobject result = env->CallObjectMethod(
       mqlQueryContext.Get()->GetRef(),
@@ -2177,6 +2664,7 @@ JniErrorCode JniContext::DocumentDbQueryMappingServiceCtor(
   if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
     return errInfo.code;
   }
+  JniLocalFrame localFrame(env);
 
   jobject result = env->NewObject(
       jvm->GetMembers().c_DocumentDbQueryMappingService,
@@ -2219,6 +2707,7 @@ JniErrorCode JniContext::DocumentDbQueryMappingServiceGet(
   if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
     return errInfo.code;
   }
+  JniLocalFrame localFrame(env);
 
   jstring sqlString = env->NewStringUTF(sql.c_str());
   jlong maxRowCountLong = maxRowCount;
@@ -2371,6 +2860,7 @@ JniErrorCode JniContext::CallStringMethod(
   if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
     return errInfo.code;
   }
+  JniLocalFrame localFrame(env);
 
   auto result = static_cast< jstring >(
       env->CallObjectMethod(object.Get()->GetRef(), method));
@@ -2769,16 +3259,10 @@ void JniContext::Release(jobject obj) {
     JavaVM* jvm = JVM.GetJvm();
 
     if (jvm) {
-      JNIEnv* env;
-
-      jint attachRes =
-          jvm->AttachCurrentThread(reinterpret_cast< void** >(&env), nullptr);
-
-      if (attachRes == JNI_OK) {
-        AttachHelper::OnThreadAttach();
+      JNIEnv* env = AttachThread(jvm);
 
+      if (env)
         env->DeleteGlobalRef(obj);
-      }
     }
   }
   LOG_DEBUG_MSG("Release exiting");
@@ -2788,15 +3272,10 @@ void JniContext::Release(jobject obj) {
  * Attach thread to JVM.
  */
 JNIEnv* JniContext::Attach(JniErrorInfo& errInfo) {
-  LOG_DEBUG_MSG("Attach is called");
-
-  JNIEnv* env;
-
-  jint attachRes = jvm->GetJvm()->AttachCurrentThread(
-      reinterpret_cast< void** >(&env), nullptr);
+  // Called by every helper, so the attached path does not log.
+  JNIEnv* env = AttachThread(jvm->GetJvm());
 
-  if (attachRes == JNI_OK) {
-    AttachHelper::OnThreadAttach();
+  if (env) {
     errInfo.code = JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS;
   } else {
     errInfo.code = JniErrorCode::DOCUMENTDB_JNI_ERR_JVM_ATTACH;
@@ -2807,7 +3286,6 @@ JNIEnv* JniContext::Attach(JniErrorInfo& errInfo) {
       hnds.error(hnds.target, errInfo.code, nullptr, 0, nullptr, 0, nullptr, 0,
                  nullptr, 0);
   }
-  LOG_DEBUG_MSG("Attach exiting");
 
   return env;
 }
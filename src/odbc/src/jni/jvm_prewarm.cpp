@@ -0,0 +1,157 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "documentdb/odbc/jni/jvm_prewarm.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "documentdb/odbc/common/platform_utils.h"
+#include "documentdb/odbc/common/utils.h"
+#include "documentdb/odbc/config/configuration.h"
+#include "documentdb/odbc/dsn_config.h"
+#include "documentdb/odbc/jni/java.h"
+#include "documentdb/odbc/jni/utils.h"
+#include "documentdb/odbc/log.h"
+
+using documentdb::odbc::common::concurrent::CsLockGuard;
+using documentdb::odbc::jni::java::BuildJvmOptions;
+using documentdb::odbc::jni::java::JniContext;
+using documentdb::odbc::jni::java::JniErrorCode;
+using documentdb::odbc::jni::java::JniErrorInfo;
+using documentdb::odbc::jni::java::JniHandlers;
+using documentdb::odbc::jni::java::JvmSettings;
+
+namespace {
+/** Environment variable enabling the warm-up. */
+const char* const DOCUMENTDB_JVM_PREWARM = "DOCUMENTDB_JVM_PREWARM";
+
+/** Environment variable naming the DSN to take the JVM settings from. */
+const char* const DOCUMENTDB_JVM_PREWARM_DSN = "DOCUMENTDB_JVM_PREWARM_DSN";
+}  // namespace
+
+namespace documentdb {
+namespace odbc {
+namespace jni {
+JvmPrewarm& JvmPrewarm::GetInstance() {
+  // Never destroyed: the detached worker may still be running when static
+  // objects are destroyed at process exit.
+  static JvmPrewarm* instance = new JvmPrewarm();
+  return *instance;
+}
+
+JvmPrewarm::JvmPrewarm() {
+  // No-op.
+}
+
+void JvmPrewarm::Start() {
+  CsLockGuard guard(lock_);
+
+  if (started_)
+    return;
+
+  started_ = true;
+
+  if (common::ToLower(common::GetEnv(DOCUMENTDB_JVM_PREWARM, "false"))
+      != "true") {
+    finished_ = true;
+    return;
+  }
+
+  LOG_INFO_MSG("Starting the JVM in the background");
+
+  // Detached, so that nothing has to join it during static destruction,
+  // which can deadlock under the loader lock on Windows.
+  std::thread(&JvmPrewarm::Run, this).detach();
+}
+
+void JvmPrewarm::Wait() {
+  CsLockGuard guard(lock_);
+
+  if (!started_ || finished_)
+    return;
+
+  LOG_DEBUG_MSG("Waiting for the JVM warm-up to finish");
+
+  while (!finished_)
+    finishedCond_.Wait(lock_);
+}
+
+void JvmPrewarm::Run() {
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+
+  std::string home = ResolveDocumentDbHome();
+  std::string cp = CreateDocumentDbClasspath(std::string(), home);
+
+  if (cp.empty()) {
+    LOG_ERROR_MSG("JVM warm-up failed: the classpath could not be resolved");
+  } else {
+    // The JVM can only be created once per process, so it has to be created
+    // with the settings of the connections that are going to use it.
+    JvmSettings settings;
+    std::string dsn = common::GetEnv(DOCUMENTDB_JVM_PREWARM_DSN, "");
+    if (!dsn.empty()) {
+      config::Configuration config;
+      ReadDsnConfiguration(dsn.c_str(), config, nullptr);
+
+      settings.initialHeapSize = std::min(config.GetJvmInitialHeapSize(),
+                                          config.GetJvmMaxHeapSize());
+      settings.maxHeapSize = config.GetJvmMaxHeapSize();
+      settings.garbageCollector = config.GetJvmGarbageCollector();
+      settings.cdsArchive = config.GetJvmCdsArchive();
+    }
+
+    std::vector< char* > opts;
+    BuildJvmOptions(cp, opts, settings);
+
+    JniErrorInfo errInfo;
+    JniContext* ctx = JniContext::Create(
+        &opts[0], static_cast< int >(opts.size()), JniHandlers(), errInfo);
+
+    if (ctx)
+      ctx->DriverManagerLoadDrivers(errInfo);
+
+    if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
+      LOG_ERROR_MSG("JVM warm-up failed: " << errInfo.errMsg);
+    } else {
+      LOG_INFO_MSG("JVM warm-up finished in "
+                   << std::chrono::duration_cast< std::chrono::milliseconds >(
+                          std::chrono::steady_clock::now() - start)
+                          .count()
+                   << " ms");
+    }
+
+    delete ctx;
+
+    JniContext::Detach();
+
+    std::for_each(opts.begin(), opts.end(), common::ReleaseChars);
+  }
+
+  {
+    CsLockGuard guard(lock_);
+    finished_ = true;
+  }
+
+  finishedCond_.NotifyAll();
+}
+}  // namespace jni
+}  // namespace odbc
+}  // namespace documentdb
@@ -0,0 +1,224 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "documentdb/odbc/meta/catalog.h"
+
+#include <algorithm>
+
+using documentdb::odbc::common::concurrent::CsLockGuard;
+
+namespace {
+/**
+ * Append a part of the request key, keeping unset and empty values apart.
+ *
+ * @param key Key.
+ * @param part Part.
+ */
+void AppendKeyPart(std::string& key,
+                   const boost::optional< std::string >& part) {
+  if (part) {
+    key.push_back('+');
+    key.append(*part);
+  } else {
+    key.push_back('-');
+  }
+  key.push_back('\0');
+}
+
+/**
+ * Make the key of a keys request.
+ */
+std::string MakeKeysRequest(const boost::optional< std::string >& catalog,
+                            const boost::optional< std::string >& schema,
+                            const boost::optional< std::string >& table) {
+  std::string key;
+  AppendKeyPart(key, catalog);
+  AppendKeyPart(key, schema);
+  AppendKeyPart(key, table);
+  return key;
+}
+
+/**
+ * Check if the catalog name of a row matches the requested catalog name.
+ * An empty catalog name matches the rows without a catalog.
+ *
+ * @param value Catalog name of the row.
+ * @param catalog Requested catalog name.
+ * @return @c true if matches.
+ */
+bool MatchCatalog(const boost::optional< std::string >& value,
+                  const boost::optional< std::string >& catalog) {
+  return !catalog || value.get_value_or("") == *catalog;
+}
+
+/**
+ * Check if the name of a row matches the search pattern. An empty pattern
+ * matches the rows without a name.
+ *
+ * @param value Name of the row.
+ * @param pattern Search pattern.
+ * @return @c true if matches.
+ */
+bool MatchName(const boost::optional< std::string >& value,
+               const boost::optional< std::string >& pattern) {
+  return !pattern
+         || documentdb::odbc::meta::Catalog::MatchPattern(
+             value.get_value_or(""), *pattern);
+}
+}  // namespace
+
+namespace documentdb {
+namespace odbc {
+namespace meta {
+const char Catalog::PATTERN_ESCAPE = '\\';
+
+Catalog::Catalog(const TableMetaVector& tables,
+                 const ColumnMetaVector& columns)
+    : tables_(tables), columns_(columns) {
+  // No-op.
+}
+
+bool Catalog::MatchPattern(const std::string& value,
+                           const std::string& pattern) {
+  size_t v = 0;
+  size_t p = 0;
+
+  // Position after the last '%' in the pattern and the position in the
+  // value it is retried from.
+  size_t starP = std::string::npos;
+  size_t starV = 0;
+
+  while (v < value.size()) {
+    if (p < pattern.size() && pattern[p] == '%') {
+      starP = ++p;
+      starV = v;
+      continue;
+    }
+
+    if (p < pattern.size()) {
+      bool escaped = pattern[p] == PATTERN_ESCAPE && p + 1 < pattern.size();
+      char expected = escaped ? pattern[p + 1] : pattern[p];
+
+      if ((!escaped && expected == '_') || expected == value[v]) {
+        p += escaped ? 2 : 1;
+        ++v;
+        continue;
+      }
+    }
+
+    if (starP == std::string::npos)
+      return false;
+
+    // Let the last '%' match one more character and retry.
+    p = starP;
+    v = ++starV;
+  }
+
+  while (p < pattern.size() && pattern[p] == '%')
+    ++p;
+
+  return p == pattern.size();
+}
+
+void Catalog::GetTables(
+    const boost::optional< std::string >& catalog,
+    const boost::optional< std::string >& schema, const std::string& table,
+    const boost::optional< std::vector< std::string > >& types,
+    TableMetaVector& meta) const {
+  meta.clear();
+
+  for (const TableMeta& tableMeta : tables_) {
+    if (!MatchCatalog(tableMeta.GetCatalogName(), catalog)
+        || !MatchName(tableMeta.GetSchemaName(), schema)
+        || !MatchName(tableMeta.GetTableName(), table))
+      continue;
+
+    if (types) {
+      const std::string& type = tableMeta.GetTableType().get_value_or("");
+      if (std::find(types->begin(), types->end(), type) == types->end())
+        continue;
+    }
+
+    meta.push_back(tableMeta);
+  }
+}
+
+void Catalog::GetColumns(const boost::optional< std::string >& catalog,
+                         const boost::optional< std::string >& schema,
+                         const std::string& table, const std::string& column,
+                         ColumnMetaVector& meta) const {
+  meta.clear();
+
+  for (const ColumnMeta& columnMeta : columns_) {
+    if (MatchCatalog(columnMeta.GetCatalogName(), catalog)
+        && MatchName(columnMeta.GetSchemaName(), schema)
+        && MatchName(columnMeta.GetTableName(), table)
+        && MatchName(columnMeta.GetColumnName(), column))
+      meta.push_back(columnMeta);
+  }
+}
+
+bool Catalog::GetPrimaryKeys(const boost::optional< std::string >& catalog,
+                             const boost::optional< std::string >& schema,
+                             const boost::optional< std::string >& table,
+                             PrimaryKeyMetaVector& meta) const {
+  CsLockGuard guard(keysLock_);
+
+  std::map< std::string, PrimaryKeyMetaVector >::const_iterator it =
+      primaryKeys_.find(MakeKeysRequest(catalog, schema, table));
+  if (it == primaryKeys_.end())
+    return false;
+
+  meta = it->second;
+  return true;
+}
+
+void Catalog::PutPrimaryKeys(const boost::optional< std::string >& catalog,
+                             const boost::optional< std::string >& schema,
+                             const boost::optional< std::string >& table,
+                             const PrimaryKeyMetaVector& meta) {
+  CsLockGuard guard(keysLock_);
+
+  primaryKeys_[MakeKeysRequest(catalog, schema, table)] = meta;
+}
+
+bool Catalog::GetForeignKeys(const boost::optional< std::string >& catalog,
+                             const boost::optional< std::string >& schema,
+                             const std::string& table,
+                             ForeignKeyMetaVector& meta) const {
+  CsLockGuard guard(keysLock_);
+
+  std::map< std::string, ForeignKeyMetaVector >::const_iterator it =
+      foreignKeys_.find(MakeKeysRequest(catalog, schema, table));
+  if (it == foreignKeys_.end())
+    return false;
+
+  meta = it->second;
+  return true;
+}
+
+void Catalog::PutForeignKeys(const boost::optional< std::string >& catalog,
+                             const boost::optional< std::string >& schema,
+                             const std::string& table,
+                             const ForeignKeyMetaVector& meta) {
+  CsLockGuard guard(keysLock_);
+
+  foreignKeys_[MakeKeysRequest(catalog, schema, table)] = meta;
+}
+}  // namespace meta
+}  // namespace odbc
+}  // namespace documentdb
@@ -145,6 +145,38 @@ void ColumnMeta::ReadJdbcMetadata(JdbcColumnMetadata& jdbcMetadata,
   isAutoIncrement = jdbcMetadata.IsAutoIncrement() ? "YES" : "NO";
 }
 
+void ColumnMeta::Read(impl::binary::BinaryReaderImpl& reader) {
+  utility::ReadOptionalString(reader, catalogName);
+  utility::ReadOptionalString(reader, schemaName);
+  utility::ReadOptionalString(reader, tableName);
+  utility::ReadOptionalString(reader, columnName);
+  utility::ReadOptionalString(reader, remarks);
+  utility::ReadOptionalString(reader, columnDef);
+  utility::ReadOptionalString(reader, isAutoIncrement);
+  utility::ReadOptionalInt16(reader, dataType);
+  utility::ReadOptionalInt32(reader, precision);
+  utility::ReadOptionalInt32(reader, decimalDigits);
+  utility::ReadOptionalInt32(reader, scale);
+  utility::ReadOptionalInt32(reader, nullability);
+  utility::ReadOptionalInt32(reader, ordinalPosition);
+}
+
+void ColumnMeta::Write(impl::binary::BinaryWriterImpl& writer) const {
+  utility::WriteOptionalString(writer, catalogName);
+  utility::WriteOptionalString(writer, schemaName);
+  utility::WriteOptionalString(writer, tableName);
+  utility::WriteOptionalString(writer, columnName);
+  utility::WriteOptionalString(writer, remarks);
+  utility::WriteOptionalString(writer, columnDef);
+  utility::WriteOptionalString(writer, isAutoIncrement);
+  utility::WriteOptionalInt16(writer, dataType);
+  utility::WriteOptionalInt32(writer, precision);
+  utility::WriteOptionalInt32(writer, decimalDigits);
+  utility::WriteOptionalInt32(writer, scale);
+  utility::WriteOptionalInt32(writer, nullability);
+  utility::WriteOptionalInt32(writer, ordinalPosition);
+}
+
 bool isCharType(int16_t dataType) {
   using namespace documentdb::odbc::impl::binary;
   return ((dataType == JDBC_TYPE_VARCHAR) || (dataType == JDBC_TYPE_CHAR)
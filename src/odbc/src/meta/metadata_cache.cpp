@@ -0,0 +1,400 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "documentdb/odbc/meta/metadata_cache.h"
+
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+
+#include "documentdb/odbc/common/platform_utils.h"
+#include "documentdb/odbc/documentdb_error.h"
+#include "documentdb/odbc/impl/interop/interop_input_stream.h"
+#include "documentdb/odbc/impl/interop/interop_memory.h"
+#include "documentdb/odbc/impl/interop/interop_output_stream.h"
+#include "documentdb/odbc/log.h"
+#include "documentdb/odbc/utility.h"
+
+using documentdb::odbc::common::concurrent::CsLockGuard;
+using documentdb::odbc::impl::binary::BinaryReaderImpl;
+using documentdb::odbc::impl::binary::BinaryWriterImpl;
+using documentdb::odbc::impl::interop::InteropInputStream;
+using documentdb::odbc::impl::interop::InteropOutputStream;
+using documentdb::odbc::impl::interop::InteropUnpooledMemory;
+
+namespace {
+/** Magic number at the start of the cache file. */
+const int32_t FILE_MAGIC = 0x434D4444;
+
+/** Initial size of the serialization buffer. */
+const int32_t INITIAL_BUFFER_SIZE = 16 * 1024;
+
+/**
+ * Append a part of the request key, keeping unset and empty values apart.
+ *
+ * @param key Key.
+ * @param part Part.
+ */
+void AppendKeyPart(std::string& key,
+                   const boost::optional< std::string >& part) {
+  if (part) {
+    key.push_back('+');
+    key.append(*part);
+  } else {
+    key.push_back('-');
+  }
+  key.push_back('\0');
+}
+
+/**
+ * Make the key of a tables request.
+ */
+std::string MakeTablesRequest(
+    const boost::optional< std::string >& catalog,
+    const boost::optional< std::string >& schema, const std::string& table,
+    const boost::optional< std::vector< std::string > >& types) {
+  std::string key;
+  AppendKeyPart(key, catalog);
+  AppendKeyPart(key, schema);
+  AppendKeyPart(key, table);
+  if (types) {
+    for (const std::string& type : *types)
+      AppendKeyPart(key, type);
+  } else {
+    AppendKeyPart(key, boost::none);
+  }
+  return key;
+}
+
+/**
+ * Make the key of a columns request.
+ */
+std::string MakeColumnsRequest(const boost::optional< std::string >& catalog,
+                               const boost::optional< std::string >& schema,
+                               const std::string& table,
+                               const std::string& column) {
+  std::string key;
+  AppendKeyPart(key, catalog);
+  AppendKeyPart(key, schema);
+  AppendKeyPart(key, table);
+  AppendKeyPart(key, column);
+  return key;
+}
+
+/**
+ * Get the current time in seconds since the epoch.
+ */
+int64_t Now() {
+  return static_cast< int64_t >(std::time(nullptr));
+}
+
+/**
+ * Write entries using writer.
+ *
+ * @param writer Writer.
+ * @param entries Entries.
+ */
+template < typename M >
+void WriteEntries(BinaryWriterImpl& writer, const M& entries) {
+  writer.WriteInt32(static_cast< int32_t >(entries.size()));
+  for (typename M::const_iterator it = entries.begin(); it != entries.end();
+       ++it) {
+    documentdb::odbc::utility::WriteString(writer, it->first);
+    writer.WriteInt64(it->second.created);
+    writer.WriteInt32(static_cast< int32_t >(it->second.value.size()));
+    for (size_t i = 0; i < it->second.value.size(); ++i)
+      it->second.value[i].Write(writer);
+  }
+}
+
+/**
+ * Read entries using reader.
+ *
+ * @param reader Reader.
+ * @param entries Entries.
+ */
+template < typename M >
+void ReadEntries(BinaryReaderImpl& reader, M& entries) {
+  int32_t size = reader.ReadInt32();
+  for (int32_t i = 0; i < size; ++i) {
+    std::string request;
+    documentdb::odbc::utility::ReadString(reader, request);
+
+    typename M::mapped_type& entry = entries[request];
+    entry.created = reader.ReadInt64();
+
+    int32_t valueSize = reader.ReadInt32();
+    for (int32_t j = 0; j < valueSize; ++j) {
+      entry.value.emplace_back();
+      entry.value.back().Read(reader);
+    }
+  }
+}
+}  // namespace
+
+namespace documentdb {
+namespace odbc {
+namespace meta {
+const int32_t MetadataCache::FORMAT_VERSION = 1;
+
+MetadataCache::MetadataCache(const std::string& path, const std::string& key,
+                             int32_t ttl)
+    : path_(path), key_(key), ttl_(ttl), dirty_(false) {
+  // No-op.
+}
+
+std::string MetadataCache::MakeKey(const std::string& hostname, int32_t port,
+                                   const std::string& database,
+                                   const std::string& schemaName) {
+  std::stringstream key;
+  key << hostname << ':' << port << '/' << database << '/' << schemaName;
+  return key.str();
+}
+
+std::string MetadataCache::MakePath(const std::string& dir,
+                                    const std::string& key) {
+  std::string fileName = "documentdb-metadata-" + key + ".bin";
+  for (size_t i = 0; i < fileName.size(); ++i) {
+    char c = fileName[i];
+    if (!std::isalnum(static_cast< unsigned char >(c)) && c != '-'
+        && c != '.')
+      fileName[i] = '_';
+  }
+
+  std::stringstream path;
+  path << dir << common::Fs << fileName;
+  return path.str();
+}
+
+bool MetadataCache::Load() {
+  std::ifstream file(path_.c_str(), std::ios::in | std::ios::binary);
+  if (!file)
+    return false;
+
+  file.seekg(0, std::ios::end);
+  std::streamoff size = file.tellg();
+  file.seekg(0, std::ios::beg);
+  if (size <= 0 || size > INT32_MAX) {
+    LOG_ERROR_MSG("Ignoring metadata cache file \"" << path_
+                                                    << "\": invalid size");
+    return false;
+  }
+
+  InteropUnpooledMemory mem(static_cast< int32_t >(size));
+  file.read(reinterpret_cast< char* >(mem.Data()), size);
+  if (!file) {
+    LOG_ERROR_MSG("Unable to read metadata cache file \"" << path_ << "\"");
+    return false;
+  }
+  mem.Length(static_cast< int32_t >(size));
+
+  std::map< std::string, Entry< TableMetaVector > > tables;
+  std::map< std::string, Entry< ColumnMetaVector > > columns;
+  try {
+    InteropInputStream in(&mem);
+    BinaryReaderImpl reader(&in);
+
+    if (reader.ReadInt32() != FILE_MAGIC
+        || reader.ReadInt32() != FORMAT_VERSION) {
+      LOG_INFO_MSG("Ignoring metadata cache file \""
+                   << path_ << "\": unknown format");
+      return false;
+    }
+
+    std::string key;
+    utility::ReadString(reader, key);
+    if (key != key_) {
+      LOG_INFO_MSG("Ignoring metadata cache file \""
+                   << path_ << "\": written for \"" << key << "\"");
+      return false;
+    }
+
+    ReadEntries(reader, tables);
+    ReadEntries(reader, columns);
+  } catch (const std::exception& e) {
+    LOG_ERROR_MSG("Ignoring metadata cache file \"" << path_
+                                                    << "\": " << e.what());
+    return false;
+  }
+
+  CsLockGuard guard(lock_);
+
+  tables_.clear();
+  for (auto it = tables.begin(); it != tables.end(); ++it) {
+    if (!IsExpired(it->second.created))
+      tables_.insert(*it);
+  }
+
+  columns_.clear();
+  for (auto it = columns.begin(); it != columns.end(); ++it) {
+    if (!IsExpired(it->second.created))
+      columns_.insert(*it);
+  }
+
+  dirty_ = tables_.size() != tables.size() || columns_.size() != columns.size();
+
+  LOG_DEBUG_MSG("Loaded metadata cache file \""
+                << path_ << "\": " << tables_.size() << " tables requests, "
+                << columns_.size() << " columns requests");
+
+  return true;
+}
+
+bool MetadataCache::Save() {
+  InteropUnpooledMemory mem(INITIAL_BUFFER_SIZE);
+  {
+    CsLockGuard guard(lock_);
+
+    InteropOutputStream out(&mem);
+    BinaryWriterImpl writer(&out, 0);
+
+    writer.WriteInt32(FILE_MAGIC);
+    writer.WriteInt32(FORMAT_VERSION);
+    utility::WriteString(writer, key_);
+    WriteEntries(writer, tables_);
+    WriteEntries(writer, columns_);
+
+    out.Synchronize();
+
+    dirty_ = false;
+  }
+
+  // Other processes may read the file at any time, so it is written under
+  // a temporary name and then renamed.
+  std::stringstream tmpPath;
+  tmpPath << path_ << '.' << common::GetRandSeed() << ".tmp";
+
+  bool written = false;
+  {
+    std::ofstream file(tmpPath.str().c_str(),
+                       std::ios::out | std::ios::binary | std::ios::trunc);
+    if (file) {
+      file.write(reinterpret_cast< const char* >(mem.Data()), mem.Length());
+      file.close();
+      written = !file.fail();
+    }
+  }
+
+  // Renaming over an existing file fails on Windows.
+  if (written && std::rename(tmpPath.str().c_str(), path_.c_str()) != 0) {
+    std::remove(path_.c_str());
+    written = std::rename(tmpPath.str().c_str(), path_.c_str()) == 0;
+  }
+
+  if (!written) {
+    std::remove(tmpPath.str().c_str());
+
+    LOG_ERROR_MSG("Unable to write metadata cache file \"" << path_ << "\"");
+
+    CsLockGuard guard(lock_);
+    dirty_ = true;
+
+    return false;
+  }
+
+  LOG_DEBUG_MSG("Saved metadata cache file \"" << path_ << "\"");
+
+  return true;
+}
+
+void MetadataCache::Clear() {
+  CsLockGuard guard(lock_);
+
+  tables_.clear();
+  columns_.clear();
+  dirty_ = true;
+}
+
+bool MetadataCache::IsDirty() const {
+  CsLockGuard guard(lock_);
+
+  return dirty_;
+}
+
+bool MetadataCache::GetTables(
+    const boost::optional< std::string >& catalog,
+    const boost::optional< std::string >& schema, const std::string& table,
+    const boost::optional< std::vector< std::string > >& types,
+    TableMetaVector& meta) {
+  std::string request = MakeTablesRequest(catalog, schema, table, types);
+
+  CsLockGuard guard(lock_);
+
+  auto it = tables_.find(request);
+  if (it == tables_.end() || IsExpired(it->second.created))
+    return false;
+
+  meta = it->second.value;
+  return true;
+}
+
+void MetadataCache::PutTables(
+    const boost::optional< std::string >& catalog,
+    const boost::optional< std::string >& schema, const std::string& table,
+    const boost::optional< std::vector< std::string > >& types,
+    const TableMetaVector& meta) {
+  std::string request = MakeTablesRequest(catalog, schema, table, types);
+
+  CsLockGuard guard(lock_);
+
+  Entry< TableMetaVector >& entry = tables_[request];
+  entry.created = Now();
+  entry.value = meta;
+  dirty_ = true;
+}
+
+bool MetadataCache::GetColumns(const boost::optional< std::string >& catalog,
+                               const boost::optional< std::string >& schema,
+                               const std::string& table,
+                               const std::string& column,
+                               ColumnMetaVector& meta) {
+  std::string request = MakeColumnsRequest(catalog, schema, table, column);
+
+  CsLockGuard guard(lock_);
+
+  auto it = columns_.find(request);
+  if (it == columns_.end() || IsExpired(it->second.created))
+    return false;
+
+  meta = it->second.value;
+  return true;
+}
+
+void MetadataCache::PutColumns(const boost::optional< std::string >& catalog,
+                               const boost::optional< std::string >& schema,
+                               const std::string& table,
+                               const std::string& column,
+                               const ColumnMetaVector& meta) {
+  std::string request = MakeColumnsRequest(catalog, schema, table, column);
+
+  CsLockGuard guard(lock_);
+
+  Entry< ColumnMetaVector >& entry = columns_[request];
+  entry.created = Now();
+  entry.value = meta;
+  dirty_ = true;
+}
+
+bool MetadataCache::IsExpired(int64_t created) const {
+  return Now() - created >= ttl_;
+}
+}  // namespace meta
+}  // namespace odbc
+}  // namespace documentdb
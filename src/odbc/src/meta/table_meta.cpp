@@ -35,6 +35,22 @@ void TableMeta::Read(SharedPointer< ResultSet >& resultSet,
   resultSet.Get()->GetString(REMARKS, remarks, errInfo);
 }
 
+void TableMeta::Read(impl::binary::BinaryReaderImpl& reader) {
+  utility::ReadOptionalString(reader, catalogName);
+  utility::ReadOptionalString(reader, schemaName);
+  utility::ReadOptionalString(reader, tableName);
+  utility::ReadOptionalString(reader, tableType);
+  utility::ReadOptionalString(reader, remarks);
+}
+
+void TableMeta::Write(impl::binary::BinaryWriterImpl& writer) const {
+  utility::WriteOptionalString(writer, catalogName);
+  utility::WriteOptionalString(writer, schemaName);
+  utility::WriteOptionalString(writer, tableName);
+  utility::WriteOptionalString(writer, tableType);
+  utility::WriteOptionalString(writer, remarks);
+}
+
 void ReadTableMetaVector(SharedPointer< ResultSet >& resultSet,
                          TableMetaVector& meta) {
   meta.clear();
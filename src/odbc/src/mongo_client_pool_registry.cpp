@@ -0,0 +1,199 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "documentdb/odbc/mongo_client_pool_registry.h"
+
+#include <algorithm>
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <chrono>
+#include <functional>
+#include <mongocxx/exception/exception.hpp>
+#include <mongocxx/options/client.hpp>
+#include <mongocxx/options/pool.hpp>
+#include <mongocxx/options/tls.hpp>
+#include <mongocxx/uri.hpp>
+#include <vector>
+
+#include "documentdb/odbc/driver_instance.h"
+#include "documentdb/odbc/log.h"
+
+using documentdb::odbc::common::concurrent::CsLockGuard;
+
+namespace documentdb {
+namespace odbc {
+MongoClientPoolRegistry::MongoClientPoolRegistry() {
+  // The driver instance is created first, so that it outlives the pools.
+  DriverInstance::getInstance().initialize();
+}
+
+MongoClientPoolRegistry& MongoClientPoolRegistry::GetInstance() {
+  static MongoClientPoolRegistry instance;
+
+  return instance;
+}
+
+std::shared_ptr< mongocxx::client > MongoClientPoolRegistry::Acquire(
+    const std::string& uri, bool tls, int32_t minSize, int32_t maxSize,
+    int32_t waitTimeoutMs) {
+  bool created = false;
+  std::shared_ptr< Pool > pool =
+      GetPool(uri, tls, maxSize, waitTimeoutMs, created);
+
+  if (created && minSize > 0)
+    Prewarm(*pool, std::min(minSize, maxSize));
+
+  auto entry = pool->clients->try_acquire();
+  if (!entry) {
+    ++pool->waits;
+    ++pool->waiting;
+
+    LOG_DEBUG_MSG("Waiting for a client of the pool. in use: "
+                  << pool->inUse << ", waiting: " << pool->waiting);
+
+    auto begin = std::chrono::steady_clock::now();
+    try {
+      entry = pool->clients->acquire();
+    } catch (...) {
+      --pool->waiting;
+
+      throw;
+    }
+    --pool->waiting;
+
+    uint64_t waitTimeMs = static_cast< uint64_t >(
+        std::chrono::duration_cast< std::chrono::milliseconds >(
+            std::chrono::steady_clock::now() - begin)
+            .count());
+
+    pool->waitTimeMs += waitTimeMs;
+
+    uint64_t maxWaitTimeMs = pool->maxWaitTimeMs;
+    while (waitTimeMs > maxWaitTimeMs
+           && !pool->maxWaitTimeMs.compare_exchange_weak(maxWaitTimeMs,
+                                                         waitTimeMs)) {
+      // Retry with the updated maximum.
+    }
+
+    LOG_DEBUG_MSG("Client of the pool acquired after " << waitTimeMs
+                                                       << " ms");
+  }
+
+  ++pool->acquired;
+  ++pool->inUse;
+
+  // The deleter returns the client to its pool, which must live until then.
+  std::function< void(mongocxx::client*) > release = entry->get_deleter();
+  mongocxx::client* client = entry->release();
+
+  return std::shared_ptr< mongocxx::client >(
+      client, [pool, release](mongocxx::client* returned) {
+        --pool->inUse;
+
+        release(returned);
+      });
+}
+
+MongoClientPoolRegistry::Statistics MongoClientPoolRegistry::GetStatistics()
+    const {
+  Statistics stats;
+
+  CsLockGuard guard(lock_);
+
+  stats.pools = static_cast< uint32_t >(pools_.size());
+
+  for (const auto& entry : pools_) {
+    const Pool& pool = *entry.second;
+
+    stats.acquired += pool.acquired;
+    stats.inUse += pool.inUse;
+    stats.waits += pool.waits;
+    stats.waiting += pool.waiting;
+    stats.waitTimeMs += pool.waitTimeMs;
+    stats.maxWaitTimeMs = std::max< uint64_t >(stats.maxWaitTimeMs,
+                                               pool.maxWaitTimeMs);
+  }
+
+  return stats;
+}
+
+std::shared_ptr< MongoClientPoolRegistry::Pool >
+MongoClientPoolRegistry::GetPool(const std::string& uri, bool tls,
+                                 int32_t maxSize, int32_t waitTimeoutMs,
+                                 bool& created) {
+  std::string key = uri;
+  key.append(1, '\0').append(tls ? "tls" : "");
+  key.append(1, '\0').append(std::to_string(maxSize));
+  key.append(1, '\0').append(std::to_string(waitTimeoutMs));
+
+  CsLockGuard guard(lock_);
+
+  std::map< std::string, std::shared_ptr< Pool > >::iterator it =
+      pools_.find(key);
+
+  created = it == pools_.end();
+  if (!created)
+    return it->second;
+
+  mongocxx::options::client clientOptions;
+  if (tls) {
+    // Same as the clients of the connections without a pool.
+    mongocxx::options::tls tlsOptions;
+    tlsOptions.allow_invalid_certificates(true);
+    clientOptions.tls_opts(tlsOptions);
+  }
+
+  std::string poolUri = uri;
+  poolUri += uri.find('?') == std::string::npos ? '?' : '&';
+  poolUri += "maxPoolSize=" + std::to_string(maxSize);
+  if (waitTimeoutMs > 0)
+    poolUri += "&waitQueueTimeoutMS=" + std::to_string(waitTimeoutMs);
+
+  std::shared_ptr< Pool > pool = std::make_shared< Pool >();
+  pool->clients.reset(new mongocxx::pool(
+      mongocxx::uri(poolUri), mongocxx::options::pool(clientOptions)));
+
+  pools_[key] = pool;
+
+  LOG_INFO_MSG("Client pool created. pools: " << pools_.size()
+                                              << ", max size: " << maxSize);
+
+  return pool;
+}
+
+void MongoClientPoolRegistry::Prewarm(Pool& pool, int32_t count) {
+  using bsoncxx::builder::basic::kvp;
+  using bsoncxx::builder::basic::make_document;
+
+  // Hold every client until all of them are connected, so that each ping
+  // uses a different one.
+  std::vector< mongocxx::pool::entry > clients;
+
+  try {
+    for (int32_t i = 0; i < count; ++i) {
+      clients.push_back(pool.clients->acquire());
+
+      (*clients.back())["admin"].run_command(make_document(kvp("ping", 1)));
+    }
+  } catch (const mongocxx::exception& xcp) {
+    LOG_DEBUG_MSG("Client pool prewarm stopped: " << xcp.what());
+  }
+
+  LOG_DEBUG_MSG("Client pool prewarmed. clients: " << clients.size());
+}
+}  // namespace odbc
+}  // namespace documentdb
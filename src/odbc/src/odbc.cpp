@@ -312,6 +312,25 @@ SQLRETURN SQLCloseCursor(SQLHSTMT stmt) {
   return statement->GetDiagnosticRecords().GetReturnCode();
 }
 
+SQLRETURN SQLCancel(SQLHSTMT stmt) {
+  using odbc::Statement;
+
+  LOG_DEBUG_MSG("SQLCancel called");
+
+  Statement* statement = reinterpret_cast< Statement* >(stmt);
+
+  if (!statement) {
+    LOG_ERROR_MSG("SQLCancel exiting with SQL_INVALID_HANDLE");
+    return SQL_INVALID_HANDLE;
+  }
+
+  statement->Cancel();
+
+  LOG_DEBUG_MSG("SQLCancel exiting");
+
+  return SQL_SUCCESS;
+}
+
 SQLRETURN SQLDriverConnect(SQLHDBC conn, SQLHWND windowHandle,
                            SQLWCHAR* inConnectionString,
                            SQLSMALLINT inConnectionStringLen,
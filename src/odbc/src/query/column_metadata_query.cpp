@@ -371,6 +371,26 @@ SqlResult::Type ColumnMetadataQuery::NextResultSet() {
 
 SqlResult::Type ColumnMetadataQuery::MakeRequestGetColumnsMeta() {
   DocumentDbError error;
+  std::shared_ptr< meta::Catalog > nativeCatalog =
+      connection.GetCatalog(error);
+  if (error.GetCode() != DocumentDbError::DOCUMENTDB_SUCCESS) {
+    diag.AddStatusRecord(error.GetText());
+    return SqlResult::AI_ERROR;
+  }
+
+  if (nativeCatalog) {
+    nativeCatalog->GetColumns(catalog, schema, table, column, meta);
+    LOG_DEBUG_MSG("Columns metadata found in the native catalog: "
+                  << meta.size());
+    return SqlResult::AI_SUCCESS;
+  }
+
+  meta::MetadataCache* cache = connection.GetMetadataCache();
+  if (cache && cache->GetColumns(catalog, schema, table, column, meta)) {
+    LOG_DEBUG_MSG("Columns metadata found in the metadata cache");
+    return SqlResult::AI_SUCCESS;
+  }
+
   SharedPointer< DatabaseMetaData > databaseMetaData =
       connection.GetMetaData(error);
   if (!databaseMetaData.IsValid()
@@ -390,6 +410,9 @@ SqlResult::Type ColumnMetadataQuery::MakeRequestGetColumnsMeta() {
 
   meta::ReadColumnMetaVector(resultSet, meta);
 
+  if (cache)
+    cache->PutColumns(catalog, schema, table, column, meta);
+
   for (size_t i = 0; i < meta.size(); ++i) {
     if (meta[i].GetDataType()) {
       LOG_MSG("\n[" << i << "] SchemaName:     "
@@ -17,6 +17,11 @@
 
 #include "documentdb/odbc/query/data_query.h"
 
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
 #include <bsoncxx/json.hpp>
 #include <mongocxx/collection.hpp>
 #include <mongocxx/database.hpp>
@@ -24,6 +29,7 @@
 #include <mongocxx/options/aggregate.hpp>
 #include <mongocxx/pipeline.hpp>
 
+#include "documentdb/odbc/adaptive_batch_size.h"
 #include "documentdb/odbc/connection.h"
 #include "documentdb/odbc/documentdb_cursor.h"
 #include "documentdb/odbc/jni/documentdb_mql_query_context.h"
@@ -32,24 +38,135 @@
 #include "documentdb/odbc/message.h"
 #include "documentdb/odbc/odbc_error.h"
 #include "documentdb/odbc/query/batch_query.h"
+#include "documentdb/odbc/sql/sql_select_translator.h"
+#include "documentdb/odbc/system/odbc_constants.h"
 
+using documentdb::odbc::common::concurrent::CsLockGuard;
 using documentdb::odbc::jni::DocumentDbConnectionProperties;
 using documentdb::odbc::jni::DocumentDbDatabaseMetadata;
 using documentdb::odbc::jni::DocumentDbMqlQueryContext;
 using documentdb::odbc::jni::DocumentDbQueryMappingService;
 using documentdb::odbc::jni::JdbcColumnMetadata;
 
+namespace {
+using documentdb::odbc::SqlSelectCommand;
+
+/**
+ * Get the value of a parameter as a literal of the predicate.
+ *
+ * @param param Parameter.
+ * @param offset Bind offset.
+ * @param value Value. Not set if the value is null.
+ * @return @c true on success and @c false if the type of the parameter is
+ *     not supported.
+ */
+bool GetParameterValue(const documentdb::odbc::app::Parameter& param,
+                       int offset,
+                       boost::optional< SqlSelectCommand::Literal >& value) {
+  using documentdb::odbc::SqlLen;
+  using documentdb::odbc::app::ApplicationDataBuffer;
+  typedef SqlSelectCommand::Literal Literal;
+
+  value = boost::none;
+
+  if (param.IsNull())
+    return true;
+
+  ApplicationDataBuffer buf(param.GetBuffer());
+  buf.SetByteOffset(offset);
+  buf.SetElementOffset(0);
+
+  const std::vector< int8_t >& storedData = param.GetStoredData();
+  SqlLen storedDataLen = static_cast< SqlLen >(storedData.size());
+
+  if (param.GetBuffer().IsDataAtExec()) {
+    buf = ApplicationDataBuffer(param.GetBuffer().GetType(),
+                                const_cast< int8_t* >(storedData.data()),
+                                storedDataLen, &storedDataLen);
+  }
+
+  Literal literal;
+
+  switch (param.GetSqlType()) {
+    case SQL_CHAR:
+    case SQL_VARCHAR:
+    case SQL_LONGVARCHAR:
+    case SQL_WCHAR:
+    case SQL_WVARCHAR:
+    case SQL_WLONGVARCHAR: {
+      size_t maxLen = param.GetColumnSize();
+      if (maxLen == 0)
+        maxLen = std::numeric_limits< size_t >::max();
+
+      literal.type = Literal::STRING;
+      literal.value = buf.GetString(maxLen);
+      break;
+    }
+
+    case SQL_TINYINT:
+    case SQL_SMALLINT:
+    case SQL_INTEGER:
+    case SQL_BIGINT: {
+      literal.type = Literal::INTEGER;
+      literal.value = std::to_string(buf.GetInt64());
+      break;
+    }
+
+    case SQL_BIT: {
+      literal.type = Literal::BOOLEAN;
+      literal.value = buf.GetInt8() != 0 ? "true" : "false";
+      break;
+    }
+
+    case SQL_REAL:
+    case SQL_FLOAT:
+    case SQL_DOUBLE: {
+      std::stringstream conv;
+      conv << std::setprecision(std::numeric_limits< double >::max_digits10)
+           << buf.GetDouble();
+
+      literal.type = Literal::DECIMAL;
+      literal.value = conv.str();
+      break;
+    }
+
+    case SQL_DECIMAL:
+    case SQL_NUMERIC: {
+      documentdb::odbc::common::Decimal dec;
+      buf.GetDecimal(dec);
+
+      std::stringstream conv;
+      conv << dec;
+
+      literal.type = Literal::DECIMAL;
+      literal.value = conv.str();
+      break;
+    }
+
+    default:
+      return false;
+  }
+
+  value = literal;
+
+  return true;
+}
+}  // namespace
+
 namespace documentdb {
 namespace odbc {
 namespace query {
 DataQuery::DataQuery(diagnostic::DiagnosableAdapter& diag,
                      Connection& connection, const std::string& sql,
-                     const app::ParameterSet& params, int32_t& timeout)
+                     const app::ParameterSet& params, int32_t& timeout,
+                     int32_t& prefetchBatches, SqlUlen& rowArraySize)
     : Query(diag, QueryType::DATA),
       connection_(connection),
       sql_(sql),
       params_(params),
-      timeout_(timeout) {
+      timeout_(timeout),
+      prefetchBatches_(prefetchBatches),
+      rowArraySize_(rowArraySize) {
   // No-op.
 
   LOG_DEBUG_MSG("DataQuery constructor is called, and exiting");
@@ -113,13 +230,14 @@ SqlResult::Type DataQuery::FetchNextRow(app::ColumnBindingMap& columnBindings) {
     return SqlResult::AI_NO_DATA;
   }
 
-  if (!cursor_->Increment()) {
-    LOG_INFO_MSG("FetchNextRow exiting with AI_NO_DATA");
+  SqlResult::Type incRes = SqlResult::AI_NO_DATA;
+  if (!IncrementCursor(incRes)) {
+    LOG_INFO_MSG("FetchNextRow exiting with result: " << incRes);
     LOG_DEBUG_MSG(
         "reason: cursor cannot be moved to the next row; either data update is "
         "required or there is no more data");
 
-    return SqlResult::AI_NO_DATA;
+    return incRes;
   }
 
   DocumentDbRow* row = cursor_->GetRow();
@@ -159,6 +277,93 @@ SqlResult::Type DataQuery::FetchNextRow(app::ColumnBindingMap& columnBindings) {
   return SqlResult::AI_SUCCESS;
 }
 
+SqlResult::Type DataQuery::FetchNextRowSet(
+    app::ColumnBindingMap& columnBindings, SqlUlen rowArraySize,
+    SQLUSMALLINT* rowStatuses, SqlUlen& fetched) {
+  LOG_DEBUG_MSG("FetchNextRowSet is called");
+
+  fetched = 0;
+
+  if (!cursor_.get()) {
+    diag.AddStatusRecord(SqlState::SHY010_SEQUENCE_ERROR,
+                         "Query was not executed.");
+
+    if (rowStatuses)
+      std::fill(rowStatuses, rowStatuses + rowArraySize, SQL_ROW_ERROR);
+
+    LOG_ERROR_MSG("FetchNextRowSet exiting with AI_ERROR");
+    LOG_DEBUG_MSG("reason: query was not executed");
+
+    return SqlResult::AI_ERROR;
+  }
+
+  int32_t columnCount = cursor_->GetColumnCount();
+
+  boundColumns_.clear();
+  for (app::ColumnBindingMap::iterator it = columnBindings.begin();
+       it != columnBindings.end(); ++it) {
+    if (it->first >= 1 && it->first <= columnCount)
+      boundColumns_.push_back(std::make_pair(it->first, &it->second));
+  }
+
+  SqlUlen errors = 0;
+  SqlUlen i = 0;
+  SqlResult::Type incRes = SqlResult::AI_NO_DATA;
+
+  for (; i < rowArraySize; ++i) {
+    if (!IncrementCursor(incRes))
+      break;
+
+    DocumentDbRow* row = cursor_->GetRow();
+    SqlResult::Type rowRes = SqlResult::AI_SUCCESS;
+
+    for (size_t j = 0; j < boundColumns_.size(); ++j) {
+      app::ApplicationDataBuffer& buffer = *boundColumns_[j].second;
+      buffer.SetElementOffset(i);
+
+      app::ConversionResult::Type convRes =
+          row->ReadColumnToBuffer(boundColumns_[j].first, buffer);
+
+      if (convRes == app::ConversionResult::Type::AI_SUCCESS)
+        continue;
+
+      SqlResult::Type result = ProcessConversionResult(
+          convRes, static_cast< int32_t >(i + 1), boundColumns_[j].first);
+
+      if (result == SqlResult::AI_ERROR) {
+        rowRes = SqlResult::AI_ERROR;
+        break;
+      }
+
+      if (result == SqlResult::AI_SUCCESS_WITH_INFO)
+        rowRes = SqlResult::AI_SUCCESS_WITH_INFO;
+    }
+
+    if (rowRes == SqlResult::AI_ERROR)
+      ++errors;
+    else
+      ++fetched;
+
+    if (rowStatuses)
+      rowStatuses[i] = SqlResultToRowResult(rowRes);
+  }
+
+  if (rowStatuses && i < rowArraySize)
+    std::fill(rowStatuses + i, rowStatuses + rowArraySize, SQL_ROW_NOROW);
+
+  if (incRes == SqlResult::AI_ERROR) {
+    LOG_ERROR_MSG("FetchNextRowSet exiting with AI_ERROR");
+
+    return SqlResult::AI_ERROR;
+  }
+
+  LOG_DEBUG_MSG("FetchNextRowSet exiting with fetched: " << fetched
+                                                          << ", errors: "
+                                                          << errors);
+
+  return RowSetResult(fetched, errors);
+}
+
 SqlResult::Type DataQuery::GetColumn(uint16_t columnIdx,
                                      app::ApplicationDataBuffer& buffer) {
   LOG_DEBUG_MSG("GetColumn is called");
@@ -186,7 +391,7 @@ SqlResult::Type DataQuery::GetColumn(uint16_t columnIdx,
   }
 
   app::ConversionResult::Type convRes =
-      row->ReadColumnToBuffer(columnIdx, buffer);
+      row->ReadColumnPartToBuffer(columnIdx, buffer);
 
   SqlResult::Type result = ProcessConversionResult(convRes, 0, columnIdx);
 
@@ -201,6 +406,48 @@ SqlResult::Type DataQuery::Close() {
   return InternalClose();
 }
 
+void DataQuery::Cancel() {
+  LOG_DEBUG_MSG("Cancel is called");
+
+  CsLockGuard guard(cursorLock_);
+
+  if (cursor_.get())
+    cursor_->Cancel();
+
+  LOG_DEBUG_MSG("Cancel exiting");
+}
+
+bool DataQuery::IncrementCursor(SqlResult::Type& result) {
+  try {
+    if (cursor_->Increment())
+      return true;
+  } catch (mongocxx::exception const& xcp) {
+    std::stringstream message;
+    message << "Unable to read query result from DocumentDB."
+            << " code: " << xcp.code().value()
+            << " messagge: " << xcp.code().message()
+            << " cause: " << xcp.what();
+    diag.AddStatusRecord(Logger::RedactMessage(message.str()));
+
+    LOG_ERROR_MSG("IncrementCursor exiting with error msg: "
+                  << Logger::RedactMessage(message.str()));
+
+    result = SqlResult::AI_ERROR;
+    return false;
+  }
+
+  if (cursor_->IsCanceled()) {
+    diag.AddStatusRecord(SqlState::SHY008_OPERATION_CANCELED,
+                         "Operation canceled.");
+
+    result = SqlResult::AI_ERROR;
+    return false;
+  }
+
+  result = SqlResult::AI_NO_DATA;
+  return false;
+}
+
 SqlResult::Type DataQuery::InternalClose() {
   LOG_DEBUG_MSG("InternalClose is called");
 
@@ -212,7 +459,13 @@ SqlResult::Type DataQuery::InternalClose() {
 
   SqlResult::Type result = MakeRequestClose();
   if (result == SqlResult::AI_SUCCESS) {
-    cursor_.reset();
+    SetCursor(nullptr);
+
+    LOG_DEBUG_MSG("Fetch statistics. batches: "
+                  << fetchStats_.batches << ", documents: "
+                  << fetchStats_.documents << ", bytes: " << fetchStats_.bytes
+                  << ", fetch time (us): " << fetchStats_.fetchTimeUs
+                  << ", last batch size: " << fetchStats_.batchSize);
   }
 
   LOG_DEBUG_MSG("InternalClose exiting");
@@ -220,6 +473,16 @@ SqlResult::Type DataQuery::InternalClose() {
   return result;
 }
 
+void DataQuery::SetCursor(DocumentDbCursor* cursor) {
+  std::unique_ptr< DocumentDbCursor > previous(cursor);
+
+  {
+    CsLockGuard guard(cursorLock_);
+
+    cursor_.swap(previous);
+  }
+}
+
 bool DataQuery::DataAvailable() const {
   LOG_DEBUG_MSG("DataAvailable is called, and exiting");
 
@@ -245,7 +508,7 @@ SqlResult::Type DataQuery::NextResultSet() {
 SqlResult::Type DataQuery::MakeRequestExecute() {
   LOG_DEBUG_MSG("MakeRequestExecute is called");
 
-  cursor_.reset();
+  SetCursor(nullptr);
 
   LOG_DEBUG_MSG("MakeRequestExecute exiting");
 
@@ -262,10 +525,9 @@ SqlResult::Type DataQuery::MakeRequestFetch() {
   LOG_DEBUG_MSG("MakeRequestFetch is called");
 
   try {
-    SharedPointer< DocumentDbMqlQueryContext > mqlQueryContext;
     DocumentDbError error;
 
-    SqlResult::Type result = GetMqlQueryContext(mqlQueryContext, error);
+    SqlResult::Type result = PreparePipeline(error);
     if (result != SqlResult::AI_SUCCESS) {
       switch (error.GetCode()) {
         case DocumentDbError::DOCUMENTDB_ERR_SQL_EXCEPTION:
@@ -286,11 +548,13 @@ SqlResult::Type DataQuery::MakeRequestFetch() {
       return result;
     }
 
-    std::vector< std::string > const& aggregateOperations =
-        mqlQueryContext.Get()->GetAggregateOperations();
+    result = BindParameters();
+    if (result != SqlResult::AI_SUCCESS)
+      return result;
+
     std::vector< JdbcColumnMetadata >& columnMetadata =
-        mqlQueryContext.Get()->GetColumnMetadata();
-    std::vector< std::string >& paths = mqlQueryContext.Get()->GetPaths();
+        mqlQueryContext_.Get()->GetColumnMetadata();
+    std::vector< std::string >& paths = mqlQueryContext_.Get()->GetPaths();
 
     if (!resultMetaAvailable_) {
       ReadJdbcColumnMetadataVector(columnMetadata);
@@ -298,24 +562,57 @@ SqlResult::Type DataQuery::MakeRequestFetch() {
 
     const config::Configuration& config = connection_.GetConfiguration();
     std::string databaseName = config.GetDatabase();
-    std::string collectionName = mqlQueryContext.Get()->GetCollectionName();
+    std::string collectionName = mqlQueryContext_.Get()->GetCollectionName();
 
     std::shared_ptr< mongocxx::client > const& mongoClient =
         connection_.GetMongoClient();
-    mongocxx::database database = mongoClient.get()->database(databaseName);
-    mongocxx::collection collection = database[collectionName];
-    auto pipeline = mongocxx::pipeline{};
-    for (auto const& stage : aggregateOperations) {
-      pipeline.append_stage(bsoncxx::from_json(stage));
+    common::concurrent::CriticalSection& clientLock =
+        connection_.GetMongoClientLock();
+
+    fetchStats_.Reset();
+
+    std::unique_ptr< DocumentSource > source;
+    // Cursor commands are sent to the primary, so other read preferences
+    // keep the driver managed cursor.
+    if (config.IsAdaptiveFetch()
+        && config.GetReadPreference() == ReadPreference::Type::PRIMARY) {
+      AdaptiveBatchSize batchSize(
+          config.GetDefaultFetchSize(),
+          static_cast< int64_t >(config.GetFetchMemoryLimit()) * 1024 * 1024,
+          static_cast< int64_t >(rowArraySize_));
+
+      LOG_DEBUG_MSG("Adaptive fetch. first batch size: "
+                    << batchSize.GetFirstBatchSize()
+                    << ", max batch size: " << config.GetDefaultFetchSize()
+                    << ", memory limit (MB): " << config.GetFetchMemoryLimit());
+
+      source.reset(new CommandCursorSource(
+          *mongoClient, databaseName, collectionName,
+          pipeline_->view_array(), timeout_, batchSize, fetchStats_));
+    } else {
+      mongocxx::database database = mongoClient.get()->database(databaseName);
+      mongocxx::collection collection = database[collectionName];
+      common::concurrent::CsLockGuard guard(clientLock);
+      mongocxx::cursor cursor =
+          collection.aggregate(*pipeline_, aggregateOptions_);
+      guard.Reset();
+
+      source.reset(new MongoCursorSource(
+          cursor, config.GetDefaultFetchSize(), fetchStats_));
     }
-    auto options = mongocxx::options::aggregate{};
-    options.batch_size(config.GetDefaultFetchSize());
-    if (timeout_) {
-      options.max_time(std::chrono::milliseconds(std::chrono::seconds(timeout_)));
+
+    size_t prefetchDocuments = 0;
+    size_t prefetchMemoryLimit = 0;
+    if (prefetchBatches_ > 0) {
+      prefetchDocuments = static_cast< size_t >(prefetchBatches_)
+                          * static_cast< size_t >(config.GetDefaultFetchSize());
+      prefetchMemoryLimit =
+          static_cast< size_t >(config.GetPrefetchMemoryLimit()) * 1024 * 1024;
     }
-    mongocxx::cursor cursor = collection.aggregate(pipeline, options);
 
-    this->cursor_.reset(new DocumentDbCursor(cursor, columnMetadata, paths));
+    SetCursor(new DocumentDbCursor(std::move(source), columnMetadata, paths,
+                                   clientLock, prefetchDocuments,
+                                   prefetchMemoryLimit));
 
     LOG_DEBUG_MSG("MakeRequestFetch exiting");
 
@@ -340,45 +637,127 @@ SqlResult::Type DataQuery::MakeRequestFetch() {
   LOG_DEBUG_MSG("MakeRequestFetch exiting");
 }
 
-SqlResult::Type DataQuery::GetMqlQueryContext(
-    SharedPointer< DocumentDbMqlQueryContext >& mqlQueryContext,
-    DocumentDbError& error) {
-  LOG_DEBUG_MSG("GetMqlQueryContext is called");
+SqlResult::Type DataQuery::PreparePipeline(DocumentDbError& error) {
+  uint64_t generation = connection_.GetQueryMappingGeneration();
+  if (pipeline_ && pipelineGeneration_ == generation
+      && pipelineTimeout_ == timeout_) {
+    LOG_DEBUG_MSG("Reusing the prepared aggregation pipeline");
 
-  SharedPointer< DocumentDbConnectionProperties > connectionProperties =
-      connection_.GetConnectionProperties(error);
-  if (error.GetCode() != DocumentDbError::DOCUMENTDB_SUCCESS) {
-    LOG_ERROR_MSG("GetMqlQueryContext exiting with error msg: "
-                          << Logger::RedactMessage(error.GetText()));
+    return SqlResult::AI_SUCCESS;
+  }
 
-    return SqlResult::AI_ERROR;
+  pipeline_.reset();
+
+  SqlResult::Type result = GetMqlQueryContext(mqlQueryContext_, error);
+  if (result != SqlResult::AI_SUCCESS)
+    return result;
+
+  std::vector< bsoncxx::document::value > stages;
+  uint16_t parametersNumber = 0;
+  for (auto const& stage : mqlQueryContext_.Get()->GetAggregateOperations()) {
+    stages.push_back(bsoncxx::from_json(stage));
+
+    parametersNumber = std::max(parametersNumber,
+                                SqlSelectTranslator::GetParametersNumber(
+                                    stages.back().view()));
   }
-  SharedPointer< DocumentDbDatabaseMetadata > databaseMetadata =
-      connection_.GetDatabaseMetadata(error);
-  if (error.GetCode() != DocumentDbError::DOCUMENTDB_SUCCESS) {
-    LOG_ERROR_MSG("GetMqlQueryContext exiting with error msg: "
-                          << Logger::RedactMessage(error.GetText()));
 
-    return SqlResult::AI_ERROR;
+  std::unique_ptr< mongocxx::pipeline > pipeline(new mongocxx::pipeline());
+  for (auto const& stage : stages) {
+    pipeline->append_stage(stage.view());
   }
-  JniErrorInfo errInfo;
-  SharedPointer< DocumentDbQueryMappingService > queryMappingService =
-      DocumentDbQueryMappingService::Create(connectionProperties,
-                                            databaseMetadata, errInfo);
-  if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-    DocumentDbError::SetError(errInfo.code, errInfo.errCls.c_str(),
-                          errInfo.errMsg.c_str(), error);
-    LOG_ERROR_MSG("GetMqlQueryContext exiting with error msg: "
-                          << Logger::RedactMessage(error.GetText()));
+
+  aggregateOptions_ = mongocxx::options::aggregate{};
+  aggregateOptions_.batch_size(
+      connection_.GetConfiguration().GetDefaultFetchSize());
+  if (timeout_) {
+    aggregateOptions_.max_time(
+        std::chrono::milliseconds(std::chrono::seconds(timeout_)));
+  }
+
+  pipeline_ = std::move(pipeline);
+  stages_ = std::move(stages);
+  parametersNumber_ = parametersNumber;
+  pipelineGeneration_ = generation;
+  pipelineTimeout_ = timeout_;
+
+  LOG_DEBUG_MSG("Aggregation pipeline prepared. stages: "
+                << mqlQueryContext_.Get()->GetAggregateOperations().size());
+
+  return SqlResult::AI_SUCCESS;
+}
+
+bool DataQuery::GetNativeParametersNumber(uint16_t& paramNum) {
+  if (!connection_.GetConfiguration().IsNativeQueryTranslation())
+    return false;
+
+  // The queries translated by the JVM have no placeholders for the markers.
+  DocumentDbError error;
+  if (PreparePipeline(error) != SqlResult::AI_SUCCESS
+      || parametersNumber_ == 0)
+    return false;
+
+  paramNum = parametersNumber_;
+
+  return true;
+}
+
+SqlResult::Type DataQuery::BindParameters() {
+  if (parametersNumber_ == 0)
+    return SqlResult::AI_SUCCESS;
+
+  int* bindOffset = params_.GetParamBindOffsetPtr();
+  int offset = bindOffset ? *bindOffset : 0;
+
+  std::vector< boost::optional< SqlSelectCommand::Literal > > values(
+      parametersNumber_);
+
+  for (uint16_t idx = 1; idx <= parametersNumber_; ++idx) {
+    const app::Parameter* param = params_.GetParameter(idx);
+    if (!param) {
+      diag.AddStatusRecord(SqlState::S07002_COUNT_FIELD_INCORRECT,
+                           "Parameter " + std::to_string(idx)
+                               + " is not bound.");
+
+      return SqlResult::AI_ERROR;
+    }
+
+    if (!GetParameterValue(*param, offset, values[idx - 1])) {
+      diag.AddStatusRecord(SqlState::S07006_RESTRICTION_VIOLATION,
+                           "SQL type of parameter " + std::to_string(idx)
+                               + " is not supported.");
+
+      return SqlResult::AI_ERROR;
+    }
+  }
+
+  std::unique_ptr< mongocxx::pipeline > pipeline(new mongocxx::pipeline());
+  try {
+    for (auto const& stage : stages_) {
+      pipeline->append_stage(
+          SqlSelectTranslator::BindParameters(stage.view(), values));
+    }
+  } catch (const OdbcError& err) {
+    diag.AddStatusRecord(err);
 
     return SqlResult::AI_ERROR;
   }
-  mqlQueryContext =
-      queryMappingService.Get()->GetMqlQueryContext(sql_, 0, errInfo);
-  if (errInfo.code != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
-    DocumentDbError::SetError(errInfo.code, errInfo.errCls.c_str(),
-                          errInfo.errMsg.c_str(), error);
 
+  pipeline_ = std::move(pipeline);
+
+  LOG_DEBUG_MSG("Parameters bound to the pipeline. parameters: "
+                << parametersNumber_);
+
+  return SqlResult::AI_SUCCESS;
+}
+
+SqlResult::Type DataQuery::GetMqlQueryContext(
+    SharedPointer< DocumentDbMqlQueryContext >& mqlQueryContext,
+    DocumentDbError& error) {
+  LOG_DEBUG_MSG("GetMqlQueryContext is called");
+
+  mqlQueryContext = connection_.GetMqlQueryContext(sql_, error);
+  if (!mqlQueryContext.IsValid()) {
     LOG_ERROR_MSG("GetMqlQueryContext exiting with error msg: "
                           << Logger::RedactMessage(error.GetText()));
 
@@ -295,6 +295,20 @@ SqlResult::Type ForeignKeysQuery::NextResultSet() {
 
 SqlResult::Type ForeignKeysQuery::MakeRequestGetForeignKeysMeta() {
   DocumentDbError error;
+  std::shared_ptr< meta::Catalog > nativeCatalog =
+      connection.GetCatalog(error);
+  if (error.GetCode() != DocumentDbError::DOCUMENTDB_SUCCESS) {
+    diag.AddStatusRecord(error.GetText());
+    return SqlResult::AI_ERROR;
+  }
+
+  if (nativeCatalog
+      && nativeCatalog->GetForeignKeys(catalog, schema, table, meta)) {
+    LOG_DEBUG_MSG("Foreign keys found in the native catalog: "
+                  << meta.size());
+    return SqlResult::AI_SUCCESS;
+  }
+
   SharedPointer< DatabaseMetaData > databaseMetaData =
       connection.GetMetaData(error);
   if (!databaseMetaData.IsValid()
@@ -314,6 +328,9 @@ SqlResult::Type ForeignKeysQuery::MakeRequestGetForeignKeysMeta() {
 
   meta::ReadForeignKeysColumnMetaVector(resultSet, meta);
 
+  if (nativeCatalog)
+    nativeCatalog->PutForeignKeys(catalog, schema, table, meta);
+
   for (size_t i = 0; i < meta.size(); ++i) {
     LOG_DEBUG_MSG("\n[" << i << "] PKSchemaName:     "
                         << meta[i].GetPKSchemaName().get_value_or("") << "\n["
@@ -210,6 +210,20 @@ SqlResult::Type PrimaryKeysQuery::NextResultSet() {
 
 SqlResult::Type PrimaryKeysQuery::MakeRequestGetPrimaryKeysMeta() {
   DocumentDbError error;
+  std::shared_ptr< meta::Catalog > nativeCatalog =
+      connection.GetCatalog(error);
+  if (error.GetCode() != DocumentDbError::DOCUMENTDB_SUCCESS) {
+    diag.AddStatusRecord(error.GetText());
+    return SqlResult::AI_ERROR;
+  }
+
+  if (nativeCatalog
+      && nativeCatalog->GetPrimaryKeys(catalog, schema, table, meta)) {
+    LOG_DEBUG_MSG("Primary keys found in the native catalog: "
+                  << meta.size());
+    return SqlResult::AI_SUCCESS;
+  }
+
   SharedPointer< DatabaseMetaData > databaseMetaData =
       connection.GetMetaData(error);
   if (!databaseMetaData.IsValid()
@@ -229,6 +243,9 @@ SqlResult::Type PrimaryKeysQuery::MakeRequestGetPrimaryKeysMeta() {
 
   meta::ReadPrimaryKeysColumnMetaVector(resultSet, meta);
 
+  if (nativeCatalog)
+    nativeCatalog->PutPrimaryKeys(catalog, schema, table, meta);
+
   for (size_t i = 0; i < meta.size(); ++i) {
     LOG_DEBUG_MSG("\n[" << i << "] SchemaName:     "
                         << meta[i].GetSchemaName().get_value_or("") << "\n["
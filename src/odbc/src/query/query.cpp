@@ -0,0 +1,78 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "documentdb/odbc/query/query.h"
+
+namespace documentdb {
+namespace odbc {
+namespace query {
+SqlResult::Type Query::FetchNextRowSet(app::ColumnBindingMap& columnBindings,
+                                       SqlUlen rowArraySize,
+                                       SQLUSMALLINT* rowStatuses,
+                                       SqlUlen& fetched) {
+  fetched = 0;
+  SqlUlen errors = 0;
+
+  for (SqlUlen i = 0; i < rowArraySize; ++i) {
+    for (app::ColumnBindingMap::iterator it = columnBindings.begin();
+         it != columnBindings.end(); ++it)
+      it->second.SetElementOffset(i);
+
+    SqlResult::Type res = FetchNextRow(columnBindings);
+
+    if (res == SqlResult::AI_SUCCESS || res == SqlResult::AI_SUCCESS_WITH_INFO)
+      ++fetched;
+    else if (res != SqlResult::AI_NO_DATA)
+      ++errors;
+
+    if (rowStatuses)
+      rowStatuses[i] = SqlResultToRowResult(res);
+  }
+
+  return RowSetResult(fetched, errors);
+}
+
+void Query::Cancel() {
+  // No-op.
+}
+
+uint16_t Query::SqlResultToRowResult(SqlResult::Type value) {
+  switch (value) {
+    case SqlResult::AI_NO_DATA:
+      return SQL_ROW_NOROW;
+
+    case SqlResult::AI_SUCCESS:
+      return SQL_ROW_SUCCESS;
+
+    case SqlResult::AI_SUCCESS_WITH_INFO:
+      return SQL_ROW_SUCCESS_WITH_INFO;
+
+    default:
+      return SQL_ROW_ERROR;
+  }
+}
+
+SqlResult::Type Query::RowSetResult(SqlUlen fetched, SqlUlen errors) {
+  if (fetched > 0)
+    return errors == 0 ? SqlResult::AI_SUCCESS
+                       : SqlResult::AI_SUCCESS_WITH_INFO;
+
+  return errors == 0 ? SqlResult::AI_NO_DATA : SqlResult::AI_ERROR;
+}
+}  // namespace query
+}  // namespace odbc
+}  // namespace documentdb
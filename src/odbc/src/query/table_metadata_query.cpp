@@ -218,15 +218,6 @@ SqlResult::Type TableMetadataQuery::NextResultSet() {
 }
 
 SqlResult::Type TableMetadataQuery::MakeRequestGetTablesMeta() {
-  DocumentDbError error;
-  SharedPointer< DatabaseMetaData > databaseMetaData =
-      connection.GetMetaData(error);
-  if (!databaseMetaData.IsValid()
-      || error.GetCode() != DocumentDbError::DOCUMENTDB_SUCCESS) {
-    diag.AddStatusRecord(error.GetText());
-    return SqlResult::AI_ERROR;
-  }
-
   boost::optional< std::vector< std::string > > types = boost::none;
   if (tableType) {
     std::vector< std::string > typesArr;
@@ -242,6 +233,35 @@ SqlResult::Type TableMetadataQuery::MakeRequestGetTablesMeta() {
     types = typesArr;
   }
 
+  DocumentDbError error;
+  std::shared_ptr< meta::Catalog > nativeCatalog =
+      connection.GetCatalog(error);
+  if (error.GetCode() != DocumentDbError::DOCUMENTDB_SUCCESS) {
+    diag.AddStatusRecord(error.GetText());
+    return SqlResult::AI_ERROR;
+  }
+
+  if (nativeCatalog) {
+    nativeCatalog->GetTables(catalog, schema, table, types, meta);
+    LOG_DEBUG_MSG("Tables metadata found in the native catalog: "
+                  << meta.size());
+    return SqlResult::AI_SUCCESS;
+  }
+
+  meta::MetadataCache* cache = connection.GetMetadataCache();
+  if (cache && cache->GetTables(catalog, schema, table, types, meta)) {
+    LOG_DEBUG_MSG("Tables metadata found in the metadata cache");
+    return SqlResult::AI_SUCCESS;
+  }
+
+  SharedPointer< DatabaseMetaData > databaseMetaData =
+      connection.GetMetaData(error);
+  if (!databaseMetaData.IsValid()
+      || error.GetCode() != DocumentDbError::DOCUMENTDB_SUCCESS) {
+    diag.AddStatusRecord(error.GetText());
+    return SqlResult::AI_ERROR;
+  }
+
   JniErrorInfo errInfo;
   SharedPointer< ResultSet > resultSet =
       databaseMetaData.Get()->GetTables(catalog, schema, table, types, errInfo);
@@ -253,6 +273,9 @@ SqlResult::Type TableMetadataQuery::MakeRequestGetTablesMeta() {
 
   meta::ReadTableMetaVector(resultSet, meta);
 
+  if (cache)
+    cache->PutTables(catalog, schema, table, types, meta);
+
   for (size_t i = 0; i < meta.size(); ++i) {
     LOG_MSG("\n[" << i << "] CatalogName: " << meta[i].GetCatalogName() << "\n["
                   << i << "] SchemaName:  " << meta[i].GetSchemaName() << "\n["
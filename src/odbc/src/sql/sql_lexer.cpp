@@ -136,6 +136,41 @@ OdbcExpected< bool > SqlLexer::Shift() {
         break;
       }
 
+      case '*': {
+        tokenType = TokenType::ASTERISK;
+
+        break;
+      }
+
+      case '=': {
+        tokenType = TokenType::COMPARISON;
+
+        break;
+      }
+
+      case '?': {
+        tokenType = TokenType::PARAMETER_MARKER;
+
+        break;
+      }
+
+      case '<':
+      case '>':
+      case '!': {
+        char first = sql[pos];
+
+        if (HaveData(1)
+            && (sql[pos + 1] == '=' || (first == '<' && sql[pos + 1] == '>'))) {
+          ++pos;
+
+          tokenType = TokenType::COMPARISON;
+        } else {
+          tokenType = first == '!' ? TokenType::OTHER : TokenType::COMPARISON;
+        }
+
+        break;
+      }
+
       default: {
         // Skipping spaces.
         if (iscntrl(sql[pos]) || isspace(sql[pos])) {
@@ -146,6 +181,13 @@ OdbcExpected< bool > SqlLexer::Shift() {
           continue;
         }
 
+        // Any other delimiter is a token by itself.
+        if (IsDelimiter(sql[pos])) {
+          tokenType = TokenType::OTHER;
+
+          break;
+        }
+
         // Word.
         while (!IsEod() && !IsDelimiter(sql[pos]))
           ++pos;
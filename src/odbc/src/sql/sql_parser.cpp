@@ -18,8 +18,11 @@
 #include <documentdb/odbc/common/utils.h>
 #include <documentdb/odbc/odbc_error.h>
 #include <documentdb/odbc/sql/sql_parser.h>
+#include <documentdb/odbc/sql/sql_select_command.h>
 #include <documentdb/odbc/sql/sql_set_streaming_command.h>
 
+const static std::string WORD_SELECT("select");
+
 const static std::string WORD_SET("set");
 
 const static std::string WORD_STREAMING("streaming");
@@ -66,6 +69,14 @@ std::shared_ptr< SqlCommand > SqlParser::GetNextCommand() {
 std::shared_ptr< SqlCommand > SqlParser::ProcessCommand() {
   const SqlToken& token = lexer.GetCurrentToken();
 
+  if (WORD_SELECT == token.ToLower()) {
+    std::shared_ptr< SqlCommand > cmd(new SqlSelectCommand);
+
+    cmd->Parse(lexer);
+
+    return cmd;
+  }
+
   if (WORD_SET == token.ToLower() && *lexer.Shift()
       && token.GetType() == TokenType::WORD
       && WORD_STREAMING == token.ToLower()) {
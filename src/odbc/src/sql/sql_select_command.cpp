@@ -0,0 +1,374 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <documentdb/odbc/common/utils.h>
+#include <documentdb/odbc/odbc_error.h>
+#include <documentdb/odbc/sql/sql_lexer.h>
+#include <documentdb/odbc/sql/sql_select_command.h>
+#include <documentdb/odbc/sql/sql_token.h>
+
+#include <algorithm>
+
+const static std::string WORD_FROM("from");
+
+const static std::string WORD_WHERE("where");
+
+const static std::string WORD_AND("and");
+
+const static std::string WORD_IS("is");
+
+const static std::string WORD_NOT("not");
+
+const static std::string WORD_NULL("null");
+
+const static std::string WORD_ORDER("order");
+
+const static std::string WORD_BY("by");
+
+const static std::string WORD_ASC("asc");
+
+const static std::string WORD_DESC("desc");
+
+const static std::string WORD_LIMIT("limit");
+
+const static std::string WORD_TRUE("true");
+
+const static std::string WORD_FALSE("false");
+
+/** Keywords that cannot be used as unquoted identifiers. */
+const static std::string RESERVED_WORDS[] = {
+    "all", "and", "as", "asc", "between", "by", "case", "desc", "distinct",
+    "except", "false", "fetch", "from", "group", "having", "in", "intersect",
+    "is", "join", "like", "limit", "not", "null", "offset", "on", "or", "order",
+    "select", "true", "union", "where"};
+
+namespace {
+bool IsWord(const documentdb::odbc::SqlToken& token, const std::string& word) {
+  return token.GetType() == documentdb::odbc::TokenType::WORD
+         && token.ToLower() == word;
+}
+
+bool IsReserved(const std::string& lower) {
+  const std::string* end =
+      RESERVED_WORDS + sizeof(RESERVED_WORDS) / sizeof(RESERVED_WORDS[0]);
+
+  return std::find(RESERVED_WORDS, end, lower) != end;
+}
+
+std::string Unquote(const std::string& str, char quote) {
+  std::string res;
+  res.reserve(str.size());
+
+  for (size_t i = 1; i + 1 < str.size(); ++i) {
+    res.push_back(str[i]);
+
+    // Quotes inside are doubled.
+    if (str[i] == quote)
+      ++i;
+  }
+
+  return res;
+}
+}  // namespace
+
+namespace documentdb {
+namespace odbc {
+SqlSelectCommand::SqlSelectCommand()
+    : SqlCommand(SqlCommandType::SELECT),
+      allColumns(false),
+      limit(-1),
+      parametersNumber(0) {
+  // No-op.
+}
+
+SqlSelectCommand::~SqlSelectCommand() {
+  // No-op.
+}
+
+void SqlSelectCommand::Parse(SqlLexer& lexer) {
+  const SqlToken& token = lexer.GetCurrentToken();
+
+  std::vector< std::string > qualifiers;
+
+  ExpectNext(lexer, "column list");
+
+  if (token.GetType() == TokenType::ASTERISK) {
+    allColumns = true;
+
+    *lexer.Shift();
+  } else {
+    while (true) {
+      std::string qualifier;
+      columns.push_back(ParseColumn(lexer, qualifier));
+      qualifiers.push_back(qualifier);
+
+      if (token.GetType() != TokenType::COMMA)
+        break;
+
+      ExpectNext(lexer, "column name");
+    }
+  }
+
+  if (!IsWord(token, WORD_FROM))
+    ThrowUnexpectedTokenError(token, "FROM");
+
+  ExpectNext(lexer, "table name");
+  table = ExpectIdentifier(lexer, "table name");
+  *lexer.Shift();
+
+  if (token.GetType() == TokenType::DOT) {
+    ExpectNext(lexer, "table name");
+    schema = table;
+    table = ExpectIdentifier(lexer, "table name");
+    *lexer.Shift();
+  }
+
+  if (IsWord(token, WORD_WHERE)) {
+    do {
+      ExpectNext(lexer, "predicate");
+
+      std::string qualifier;
+      ParsePredicate(lexer, qualifier);
+      qualifiers.push_back(qualifier);
+    } while (IsWord(token, WORD_AND));
+  }
+
+  if (IsWord(token, WORD_ORDER)) {
+    ExpectNext(lexer, "BY");
+
+    if (!IsWord(token, WORD_BY))
+      ThrowUnexpectedTokenError(token, "BY");
+
+    do {
+      ExpectNext(lexer, "column name");
+
+      SortKey key;
+      std::string qualifier;
+      key.column = ParseColumn(lexer, qualifier);
+      key.ascending = true;
+      qualifiers.push_back(qualifier);
+
+      if (IsWord(token, WORD_ASC)) {
+        *lexer.Shift();
+      } else if (IsWord(token, WORD_DESC)) {
+        key.ascending = false;
+
+        *lexer.Shift();
+      }
+
+      orderBy.push_back(key);
+    } while (token.GetType() == TokenType::COMMA);
+  }
+
+  if (IsWord(token, WORD_LIMIT)) {
+    ExpectNext(lexer, "row count");
+
+    std::string str = token.ToString();
+
+    // Larger values do not fit into int64_t.
+    if (token.GetType() != TokenType::WORD || !common::AllDigits(str)
+        || str.size() > 18)
+      ThrowUnexpectedTokenError(token, "row count");
+
+    limit = common::LexicalCast< int64_t >(str);
+
+    *lexer.Shift();
+  }
+
+  if (token.GetType() != TokenType::EOD
+      && token.GetType() != TokenType::SEMICOLON)
+    ThrowUnexpectedTokenError(token, "end of statement");
+
+  for (size_t i = 0; i < qualifiers.size(); ++i) {
+    if (!qualifiers[i].empty() && qualifiers[i] != table) {
+      throw OdbcError(SqlState::S42000_SYNTAX_ERROR_OR_ACCESS_VIOLATION,
+                      "Unknown table qualifier: '" + qualifiers[i] + "'.");
+    }
+  }
+}
+
+std::string SqlSelectCommand::ExpectIdentifier(SqlLexer& lexer,
+                                               const std::string& description) {
+  const SqlToken& token = lexer.GetCurrentToken();
+
+  if (token.GetType() == TokenType::QUOTED)
+    return Unquote(token.ToString(), '"');
+
+  if (token.GetType() == TokenType::WORD && !IsReserved(token.ToLower())
+      && !isdigit(token.GetValue()[0]))
+    return token.ToString();
+
+  ThrowUnexpectedTokenError(token, description);
+
+  return std::string();
+}
+
+std::string SqlSelectCommand::ParseColumn(SqlLexer& lexer,
+                                          std::string& qualifier) {
+  const SqlToken& token = lexer.GetCurrentToken();
+
+  std::string name = ExpectIdentifier(lexer, "column name");
+  *lexer.Shift();
+
+  if (token.GetType() == TokenType::DOT) {
+    ExpectNext(lexer, "column name");
+    qualifier = name;
+    name = ExpectIdentifier(lexer, "column name");
+    *lexer.Shift();
+  }
+
+  return name;
+}
+
+void SqlSelectCommand::ParsePredicate(SqlLexer& lexer, std::string& qualifier) {
+  const SqlToken& token = lexer.GetCurrentToken();
+
+  Predicate predicate;
+  predicate.column = ParseColumn(lexer, qualifier);
+
+  if (token.GetType() == TokenType::COMPARISON) {
+    std::string op = token.ToString();
+
+    if (op == "=")
+      predicate.op = Predicate::EQ;
+    else if (op == "<>" || op == "!=")
+      predicate.op = Predicate::NE;
+    else if (op == "<")
+      predicate.op = Predicate::LT;
+    else if (op == "<=")
+      predicate.op = Predicate::LE;
+    else if (op == ">")
+      predicate.op = Predicate::GT;
+    else
+      predicate.op = Predicate::GE;
+
+    ExpectNext(lexer, "literal");
+
+    if (token.GetType() == TokenType::PARAMETER_MARKER) {
+      predicate.literal.type = Literal::PARAMETER;
+      predicate.literal.value = common::LexicalCast< std::string >(
+          static_cast< int32_t >(++parametersNumber));
+
+      *lexer.Shift();
+    } else {
+      predicate.literal = ParseLiteral(lexer);
+    }
+  } else if (IsWord(token, WORD_IS)) {
+    ExpectNext(lexer, "NULL");
+
+    predicate.op = Predicate::IS_NULL;
+
+    if (IsWord(token, WORD_NOT)) {
+      predicate.op = Predicate::IS_NOT_NULL;
+
+      ExpectNext(lexer, "NULL");
+    }
+
+    if (!IsWord(token, WORD_NULL))
+      ThrowUnexpectedTokenError(token, "NULL");
+
+    *lexer.Shift();
+  } else {
+    ThrowUnexpectedTokenError(token, "comparison operator or IS");
+  }
+
+  predicates.push_back(predicate);
+}
+
+SqlSelectCommand::Literal SqlSelectCommand::ParseLiteral(SqlLexer& lexer) {
+  const SqlToken& token = lexer.GetCurrentToken();
+
+  Literal literal;
+
+  if (token.GetType() == TokenType::STRING) {
+    literal.type = Literal::STRING;
+    literal.value = Unquote(token.ToString(), '\'');
+
+    *lexer.Shift();
+
+    return literal;
+  }
+
+  if (IsWord(token, WORD_TRUE) || IsWord(token, WORD_FALSE)) {
+    literal.type = Literal::BOOLEAN;
+    literal.value = token.ToLower();
+
+    *lexer.Shift();
+
+    return literal;
+  }
+
+  if (token.GetType() == TokenType::MINUS) {
+    literal.value = "-";
+
+    ExpectNext(lexer, "number");
+  }
+
+  std::string integer = token.ToString();
+
+  // Larger values do not fit into int64_t.
+  if (token.GetType() != TokenType::WORD || !common::AllDigits(integer)
+      || integer.size() > 18)
+    ThrowUnexpectedTokenError(token, "literal");
+
+  literal.type = Literal::INTEGER;
+  literal.value += integer;
+
+  const char* end = token.GetValue() + token.GetSize();
+
+  *lexer.Shift();
+
+  // Fractional part, without spaces around the dot.
+  if (token.GetType() == TokenType::DOT && token.GetValue() == end) {
+    end = token.GetValue() + token.GetSize();
+
+    ExpectNext(lexer, "fractional part");
+
+    std::string fraction = token.ToString();
+
+    if (token.GetType() != TokenType::WORD || token.GetValue() != end
+        || !common::AllDigits(fraction))
+      ThrowUnexpectedTokenError(token, "fractional part");
+
+    literal.type = Literal::DECIMAL;
+    literal.value += "." + fraction;
+
+    *lexer.Shift();
+  }
+
+  return literal;
+}
+
+void SqlSelectCommand::ExpectNext(SqlLexer& lexer,
+                                  const std::string& expected) {
+  if (!*lexer.Shift())
+    throw OdbcError(SqlState::S42000_SYNTAX_ERROR_OR_ACCESS_VIOLATION,
+                    "Unexpected end of statement: " + expected + " expected.");
+}
+
+void SqlSelectCommand::ThrowUnexpectedTokenError(const SqlToken& token,
+                                                 const std::string& expected) {
+  if (token.GetType() == TokenType::EOD)
+    throw OdbcError(SqlState::S42000_SYNTAX_ERROR_OR_ACCESS_VIOLATION,
+                    "Unexpected end of statement: " + expected + " expected.");
+
+  throw OdbcError(SqlState::S42000_SYNTAX_ERROR_OR_ACCESS_VIOLATION,
+                  "Unexpected token: '" + token.ToString() + "', " + expected
+                      + " expected.");
+}
+}  // namespace odbc
+}  // namespace documentdb
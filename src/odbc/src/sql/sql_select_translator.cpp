@@ -0,0 +1,824 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "documentdb/odbc/sql/sql_select_translator.h"
+
+#include <bsoncxx/builder/basic/array.hpp>
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <bsoncxx/builder/concatenate.hpp>
+#include <bsoncxx/decimal128.hpp>
+#include <bsoncxx/exception/exception.hpp>
+#include <bsoncxx/json.hpp>
+#include <bsoncxx/oid.hpp>
+#include <bsoncxx/types.hpp>
+#include <algorithm>
+#include <map>
+#include <set>
+#include <stdexcept>
+
+#include "documentdb/odbc/impl/binary/binary_common.h"
+#include "documentdb/odbc/odbc_error.h"
+#include "documentdb/odbc/sql/sql_parser.h"
+
+using bsoncxx::builder::basic::kvp;
+using bsoncxx::builder::basic::make_array;
+using bsoncxx::builder::basic::make_document;
+using documentdb::odbc::jni::DocumentDbMqlQueryContext;
+using documentdb::odbc::jni::JdbcColumnMetadata;
+
+namespace {
+using namespace documentdb::odbc::impl::binary;
+using documentdb::odbc::SqlSelectCommand;
+
+/** Parameter values by position. */
+typedef std::vector< boost::optional< SqlSelectCommand::Literal > >
+    ParameterValues;
+
+/** Length of the hexadecimal form of an ObjectId. */
+const size_t OID_HEX_LENGTH = 24;
+
+/** Key of the placeholder of a parameter marker. */
+const char* const PARAMETER_KEY = "$documentdbParameter";
+
+/**
+ * Check if the JDBC type is numeric.
+ */
+bool IsNumericType(int32_t type) {
+  switch (type) {
+    case JDBC_TYPE_TINYINT:
+    case JDBC_TYPE_SMALLINT:
+    case JDBC_TYPE_INTEGER:
+    case JDBC_TYPE_BIGINT:
+    case JDBC_TYPE_FLOAT:
+    case JDBC_TYPE_REAL:
+    case JDBC_TYPE_DOUBLE:
+    case JDBC_TYPE_NUMERIC:
+    case JDBC_TYPE_DECIMAL:
+      return true;
+
+    default:
+      return false;
+  }
+}
+
+/**
+ * Check if the JDBC type is a string type.
+ */
+bool IsStringType(int32_t type) {
+  switch (type) {
+    case JDBC_TYPE_CHAR:
+    case JDBC_TYPE_VARCHAR:
+    case JDBC_TYPE_LONGVARCHAR:
+    case JDBC_TYPE_NCHAR:
+    case JDBC_TYPE_NVARCHAR:
+    case JDBC_TYPE_LONGNVARCHAR:
+      return true;
+
+    default:
+      return false;
+  }
+}
+
+/**
+ * Quote the identifier.
+ */
+std::string QuoteIdentifier(const std::string& identifier) {
+  std::string quoted = "\"";
+
+  for (char c : identifier) {
+    if (c == '"')
+      quoted += '"';
+
+    quoted += c;
+  }
+
+  return quoted + '"';
+}
+
+/**
+ * Get the SQL form of the comparison operator.
+ */
+const char* GetOperatorSql(SqlSelectCommand::Predicate::Operator op) {
+  typedef SqlSelectCommand::Predicate Predicate;
+
+  switch (op) {
+    case Predicate::EQ:
+      return "=";
+
+    case Predicate::NE:
+      return "<>";
+
+    case Predicate::LT:
+      return "<";
+
+    case Predicate::LE:
+      return "<=";
+
+    case Predicate::GT:
+      return ">";
+
+    case Predicate::GE:
+      return ">=";
+
+    case Predicate::IS_NULL:
+      return "IS NULL";
+
+    case Predicate::IS_NOT_NULL:
+    default:
+      return "IS NOT NULL";
+  }
+}
+
+/**
+ * Check if the string is the hexadecimal form of an ObjectId.
+ */
+bool IsObjectIdHex(const std::string& str) {
+  if (str.size() != OID_HEX_LENGTH)
+    return false;
+
+  for (char c : str) {
+    if (!isxdigit(static_cast< unsigned char >(c)))
+      return false;
+  }
+
+  return true;
+}
+
+/**
+ * Append the condition of the predicate on a column of the given type.
+ *
+ * The types of the literal and the column must match so that the value
+ * compares the same way in MQL as it does in SQL. In particular, string
+ * columns only support (in)equality, as the ordering of strings depends on
+ * the collation, and null values must never match a comparison.
+ *
+ * @param cond Document to append the condition to.
+ * @param predicate Predicate.
+ * @param columnType JDBC type of the column.
+ * @return @c true on success and @c false if the predicate is not supported.
+ */
+bool AppendCondition(bsoncxx::builder::basic::document& cond,
+                     const SqlSelectCommand::Predicate& predicate,
+                     int32_t columnType) {
+  typedef SqlSelectCommand::Predicate Predicate;
+  typedef SqlSelectCommand::Literal Literal;
+
+  const Literal& literal = predicate.literal;
+
+  switch (predicate.op) {
+    case Predicate::IS_NULL:
+      cond.append(kvp("$eq", bsoncxx::types::b_null{}));
+      return true;
+
+    case Predicate::IS_NOT_NULL:
+      cond.append(kvp("$ne", bsoncxx::types::b_null{}));
+      return true;
+
+    default:
+      break;
+  }
+
+  const char* op = nullptr;
+  switch (predicate.op) {
+    case Predicate::EQ:
+      op = "$eq";
+      break;
+
+    case Predicate::LT:
+      op = "$lt";
+      break;
+
+    case Predicate::LE:
+      op = "$lte";
+      break;
+
+    case Predicate::GT:
+      op = "$gt";
+      break;
+
+    case Predicate::GE:
+      op = "$gte";
+      break;
+
+    default:
+      break;
+  }
+
+  if (IsNumericType(columnType)) {
+    if (literal.type == Literal::INTEGER) {
+      int64_t value = std::stoll(literal.value);
+
+      if (op)
+        cond.append(kvp(op, value));
+      else
+        cond.append(kvp("$nin", make_array(value, bsoncxx::types::b_null{})));
+
+      return true;
+    }
+
+    if (literal.type != Literal::DECIMAL)
+      return false;
+
+    if (columnType == JDBC_TYPE_DECIMAL || columnType == JDBC_TYPE_NUMERIC) {
+      bsoncxx::types::b_decimal128 value{bsoncxx::decimal128(literal.value)};
+
+      if (op)
+        cond.append(kvp(op, value));
+      else
+        cond.append(kvp("$nin", make_array(value, bsoncxx::types::b_null{})));
+
+      return true;
+    }
+
+    double value = std::stod(literal.value);
+
+    if (op)
+      cond.append(kvp(op, value));
+    else
+      cond.append(kvp("$nin", make_array(value, bsoncxx::types::b_null{})));
+
+    return true;
+  }
+
+  if (IsStringType(columnType)) {
+    if (literal.type != Literal::STRING)
+      return false;
+
+    // Object identifiers are exposed as their hexadecimal string.
+    bool oid = IsObjectIdHex(literal.value);
+
+    if (predicate.op == Predicate::EQ) {
+      if (oid)
+        cond.append(kvp("$in", make_array(literal.value,
+                                          bsoncxx::oid(literal.value))));
+      else
+        cond.append(kvp("$eq", literal.value));
+
+      return true;
+    }
+
+    if (predicate.op != Predicate::NE)
+      return false;
+
+    if (oid)
+      cond.append(kvp("$nin", make_array(literal.value,
+                                         bsoncxx::oid(literal.value),
+                                         bsoncxx::types::b_null{})));
+    else
+      cond.append(
+          kvp("$nin", make_array(literal.value, bsoncxx::types::b_null{})));
+
+    return true;
+  }
+
+  if (columnType == JDBC_TYPE_BOOLEAN || columnType == JDBC_TYPE_BIT) {
+    if (literal.type != Literal::BOOLEAN)
+      return false;
+
+    bool value = literal.value == "true";
+
+    if (predicate.op == Predicate::EQ) {
+      cond.append(kvp("$eq", value));
+
+      return true;
+    }
+
+    if (predicate.op != Predicate::NE)
+      return false;
+
+    cond.append(kvp("$nin", make_array(value, bsoncxx::types::b_null{})));
+
+    return true;
+  }
+
+  return false;
+}
+
+/**
+ * Make a literal of the type that compares with the column.
+ *
+ * @param columnType JDBC type of the column.
+ * @param literal Literal.
+ * @return @c true on success and @c false if the column type is not
+ *     supported.
+ */
+bool MakeSampleLiteral(int32_t columnType, SqlSelectCommand::Literal& literal) {
+  typedef SqlSelectCommand::Literal Literal;
+
+  if (IsNumericType(columnType)) {
+    literal.type = Literal::INTEGER;
+    literal.value = "0";
+  } else if (IsStringType(columnType)) {
+    literal.type = Literal::STRING;
+    literal.value.clear();
+  } else if (columnType == JDBC_TYPE_BOOLEAN || columnType == JDBC_TYPE_BIT) {
+    literal.type = Literal::BOOLEAN;
+    literal.value = "true";
+  } else {
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * Check if the document is the placeholder of a parameter marker.
+ */
+bool IsParameterPlaceholder(const bsoncxx::document::view& doc) {
+  bsoncxx::document::view::const_iterator it = doc.begin();
+
+  return it != doc.end() && it->key().to_string() == PARAMETER_KEY
+         && it->type() == bsoncxx::type::k_document;
+}
+
+/**
+ * Get number of the parameter of the placeholder.
+ */
+uint16_t GetPlaceholderNumber(const bsoncxx::document::view& placeholder) {
+  bsoncxx::document::view param =
+      placeholder[PARAMETER_KEY].get_document().value;
+
+  return static_cast< uint16_t >(param["number"].get_int32().value);
+}
+
+/**
+ * Get highest parameter number in the document.
+ */
+uint16_t GetMaxParameterNumber(const bsoncxx::document::view& doc);
+
+/**
+ * Get highest parameter number in the array.
+ */
+uint16_t GetMaxParameterNumber(const bsoncxx::array::view& arr) {
+  uint16_t res = 0;
+
+  for (const bsoncxx::array::element& element : arr) {
+    if (element.type() == bsoncxx::type::k_document)
+      res = std::max(res, GetMaxParameterNumber(element.get_document().value));
+    else if (element.type() == bsoncxx::type::k_array)
+      res = std::max(res, GetMaxParameterNumber(element.get_array().value));
+  }
+
+  return res;
+}
+
+uint16_t GetMaxParameterNumber(const bsoncxx::document::view& doc) {
+  if (IsParameterPlaceholder(doc))
+    return GetPlaceholderNumber(doc);
+
+  uint16_t res = 0;
+
+  for (const bsoncxx::document::element& element : doc) {
+    if (element.type() == bsoncxx::type::k_document)
+      res = std::max(res, GetMaxParameterNumber(element.get_document().value));
+    else if (element.type() == bsoncxx::type::k_array)
+      res = std::max(res, GetMaxParameterNumber(element.get_array().value));
+  }
+
+  return res;
+}
+
+/**
+ * Make the condition of the placeholder on the bound value.
+ *
+ * @param placeholder Placeholder.
+ * @param values Parameter values.
+ * @return Condition.
+ */
+bsoncxx::document::value MakeParameterCondition(
+    const bsoncxx::document::view& placeholder, const ParameterValues& values) {
+  using documentdb::odbc::OdbcError;
+  using documentdb::odbc::SqlState;
+
+  bsoncxx::document::view param =
+      placeholder[PARAMETER_KEY].get_document().value;
+
+  uint16_t number = GetPlaceholderNumber(placeholder);
+  if (number == 0 || number > values.size())
+    throw OdbcError(SqlState::S07002_COUNT_FIELD_INCORRECT,
+                    "Parameter " + std::to_string(number) + " is not bound.");
+
+  const boost::optional< SqlSelectCommand::Literal >& value =
+      values[number - 1];
+
+  // Comparisons with null are never true.
+  if (!value)
+    return make_document(kvp("$in", make_array()));
+
+  SqlSelectCommand::Predicate predicate;
+  predicate.op = static_cast< SqlSelectCommand::Predicate::Operator >(
+      param["op"].get_int32().value);
+  predicate.literal = *value;
+
+  bsoncxx::builder::basic::document cond;
+
+  bool supported = false;
+  try {
+    supported =
+        AppendCondition(cond, predicate, param["type"].get_int32().value);
+  } catch (const bsoncxx::exception&) {
+    // Malformed decimal.
+  } catch (const std::logic_error&) {
+    // Numeric value out of range.
+  }
+
+  if (!supported)
+    throw OdbcError(SqlState::S07006_RESTRICTION_VIOLATION,
+                    "Value of parameter " + std::to_string(number)
+                        + " cannot be compared with the column.");
+
+  return cond.extract();
+}
+
+/**
+ * Append the array with the placeholders replaced.
+ */
+void BindArray(const bsoncxx::array::view& arr,
+               bsoncxx::builder::basic::array& res,
+               const ParameterValues& values);
+
+/**
+ * Append the document with the placeholders replaced.
+ */
+void BindDocument(const bsoncxx::document::view& doc,
+                  bsoncxx::builder::basic::document& res,
+                  const ParameterValues& values) {
+  for (const bsoncxx::document::element& element : doc) {
+    if (element.type() == bsoncxx::type::k_document) {
+      bsoncxx::document::view sub = element.get_document().value;
+
+      if (IsParameterPlaceholder(sub)) {
+        res.append(kvp(element.key(), MakeParameterCondition(sub, values)));
+      } else {
+        bsoncxx::builder::basic::document bound;
+        BindDocument(sub, bound, values);
+
+        res.append(kvp(element.key(), bound.extract()));
+      }
+    } else if (element.type() == bsoncxx::type::k_array) {
+      bsoncxx::builder::basic::array bound;
+      BindArray(element.get_array().value, bound, values);
+
+      res.append(kvp(element.key(), bound.extract()));
+    } else {
+      res.append(kvp(element.key(), element.get_value()));
+    }
+  }
+}
+
+void BindArray(const bsoncxx::array::view& arr,
+               bsoncxx::builder::basic::array& res,
+               const ParameterValues& values) {
+  for (const bsoncxx::array::element& element : arr) {
+    if (element.type() == bsoncxx::type::k_document) {
+      bsoncxx::builder::basic::document bound;
+      BindDocument(element.get_document().value, bound, values);
+
+      res.append(bound.extract());
+    } else if (element.type() == bsoncxx::type::k_array) {
+      bsoncxx::builder::basic::array bound;
+      BindArray(element.get_array().value, bound, values);
+
+      res.append(bound.extract());
+    } else {
+      res.append(element.get_value());
+    }
+  }
+}
+}  // namespace
+
+namespace documentdb {
+namespace odbc {
+std::shared_ptr< SqlSelectCommand > SqlSelectTranslator::Parse(
+    const std::string& sql) {
+  try {
+    SqlParser parser(sql);
+
+    std::shared_ptr< SqlCommand > cmd = parser.GetNextCommand();
+    if (!cmd || cmd->GetType() != SqlCommandType::SELECT)
+      return std::shared_ptr< SqlSelectCommand >();
+
+    if (parser.GetNextCommand())
+      return std::shared_ptr< SqlSelectCommand >();
+
+    return std::static_pointer_cast< SqlSelectCommand >(cmd);
+  } catch (const OdbcError&) {
+    return std::shared_ptr< SqlSelectCommand >();
+  }
+}
+
+std::string SqlSelectTranslator::GetTableQuery(
+    const SqlSelectCommand& select) {
+  std::string query = "SELECT * FROM ";
+
+  if (!select.GetSchema().empty())
+    query += QuoteIdentifier(select.GetSchema()) + '.';
+
+  return query + QuoteIdentifier(select.GetTable());
+}
+
+SharedPointer< DocumentDbMqlQueryContext > SqlSelectTranslator::Translate(
+    const SqlSelectCommand& select, DocumentDbMqlQueryContext& tableContext) {
+  SharedPointer< DocumentDbMqlQueryContext > unsupported;
+
+  const std::vector< std::string >& paths = tableContext._paths;
+  const std::vector< JdbcColumnMetadata >& columns =
+      tableContext._columnMetadata;
+
+  if (tableContext._aggregateOperations.size() != 1
+      || paths.size() != columns.size())
+    return unsupported;
+
+  try {
+    bsoncxx::document::value stage =
+        bsoncxx::from_json(tableContext._aggregateOperations[0]);
+
+    // Base tables are a plain projection of the collection's fields.
+    bsoncxx::document::element project = stage.view()["$project"];
+    if (!project || project.type() != bsoncxx::type::k_document)
+      return unsupported;
+
+    bsoncxx::document::view fields = project.get_document().value;
+
+    std::map< std::string, size_t > labels;
+    std::vector< std::string > sources(columns.size());
+
+    for (size_t i = 0; i < columns.size(); ++i) {
+      boost::optional< std::string > label = columns[i].GetColumnLabel();
+      if (!label || !labels.insert(std::make_pair(*label, i)).second)
+        return unsupported;
+
+      bsoncxx::document::element source = fields[paths[i]];
+      if (!source || source.type() != bsoncxx::type::k_utf8)
+        return unsupported;
+
+      std::string field = source.get_utf8().value.to_string();
+      if (field.size() < 2 || field[0] != '$'
+          || field.find('.') != std::string::npos)
+        return unsupported;
+
+      sources[i] = field.substr(1);
+    }
+
+    std::vector< size_t > selected;
+    if (select.IsAllColumns()) {
+      for (size_t i = 0; i < columns.size(); ++i)
+        selected.push_back(i);
+    } else {
+      std::set< size_t > unique;
+
+      for (const std::string& column : select.GetColumns()) {
+        std::map< std::string, size_t >::const_iterator it =
+            labels.find(column);
+
+        if (it == labels.end() || !unique.insert(it->second).second)
+          return unsupported;
+
+        selected.push_back(it->second);
+      }
+    }
+
+    std::vector< std::string > pipeline;
+
+    const std::vector< SqlSelectCommand::Predicate >& predicates =
+        select.GetPredicates();
+
+    if (!predicates.empty()) {
+      bsoncxx::builder::basic::array conditions;
+
+      for (const SqlSelectCommand::Predicate& predicate : predicates) {
+        std::map< std::string, size_t >::const_iterator it =
+            labels.find(predicate.column);
+        if (it == labels.end())
+          return unsupported;
+
+        int32_t columnType = columns[it->second].GetColumnType();
+        bsoncxx::builder::basic::document cond;
+
+        if (predicate.literal.type == SqlSelectCommand::Literal::PARAMETER) {
+          // The condition is made when the value is bound, as long as
+          // values of the column's type are supported.
+          SqlSelectCommand::Predicate sample = predicate;
+          bsoncxx::builder::basic::document sampleCond;
+
+          if (!MakeSampleLiteral(columnType, sample.literal)
+              || !AppendCondition(sampleCond, sample, columnType))
+            return unsupported;
+
+          cond.append(kvp(
+              PARAMETER_KEY,
+              make_document(
+                  kvp("number", std::stoi(predicate.literal.value)),
+                  kvp("op", static_cast< int32_t >(predicate.op)),
+                  kvp("type", columnType))));
+        } else if (!AppendCondition(cond, predicate, columnType)) {
+          return unsupported;
+        }
+
+        conditions.append(
+            make_document(kvp(sources[it->second], cond.extract())));
+      }
+
+      bsoncxx::builder::basic::document match;
+      if (predicates.size() == 1)
+        match.append(bsoncxx::builder::concatenate(
+            conditions.view()[0].get_document().value));
+      else
+        match.append(kvp("$and", conditions.extract()));
+
+      pipeline.push_back(bsoncxx::to_json(
+          make_document(kvp("$match", match.extract())).view()));
+    }
+
+    if (!select.GetOrderBy().empty()) {
+      bsoncxx::builder::basic::document sort;
+
+      for (const SqlSelectCommand::SortKey& key : select.GetOrderBy()) {
+        std::map< std::string, size_t >::const_iterator it =
+            labels.find(key.column);
+
+        // MQL orders nulls differently, so only non-nullable columns.
+        if (it == labels.end() || columns[it->second].GetNullable() != 0)
+          return unsupported;
+
+        sort.append(kvp(sources[it->second], key.ascending ? 1 : -1));
+      }
+
+      pipeline.push_back(bsoncxx::to_json(
+          make_document(kvp("$sort", sort.extract())).view()));
+    }
+
+    if (select.GetLimit() == 0)
+      return unsupported;
+
+    if (select.GetLimit() > 0)
+      pipeline.push_back(bsoncxx::to_json(
+          make_document(kvp("$limit", select.GetLimit())).view()));
+
+    bsoncxx::builder::basic::document projection;
+    bool hasId = false;
+
+    for (size_t idx : selected) {
+      projection.append(kvp(paths[idx], "$" + sources[idx]));
+
+      hasId = hasId || paths[idx] == "_id";
+    }
+
+    if (!hasId && fields["_id"])
+      projection.append(kvp("_id", 0));
+
+    pipeline.push_back(bsoncxx::to_json(
+        make_document(kvp("$project", projection.extract())).view()));
+
+    SharedPointer< DocumentDbMqlQueryContext > context(
+        new DocumentDbMqlQueryContext(tableContext._collectionName));
+
+    context.Get()->_aggregateOperations = pipeline;
+
+    for (size_t idx : selected) {
+      JdbcColumnMetadata metadata = columns[idx];
+      metadata.ordinal_ = static_cast< int32_t >(context.Get()->_paths.size());
+
+      context.Get()->_columnMetadata.push_back(metadata);
+      context.Get()->_paths.push_back(paths[idx]);
+    }
+
+    return context;
+  } catch (const bsoncxx::exception&) {
+    return unsupported;
+  } catch (const std::logic_error&) {
+    // Numeric literal out of range.
+    return unsupported;
+  }
+}
+
+uint16_t SqlSelectTranslator::GetParametersNumber(
+    const bsoncxx::document::view& stage) {
+  return GetMaxParameterNumber(stage);
+}
+
+bsoncxx::document::value SqlSelectTranslator::BindParameters(
+    const bsoncxx::document::view& stage,
+    const std::vector< boost::optional< SqlSelectCommand::Literal > >&
+        values) {
+  bsoncxx::builder::basic::document res;
+  BindDocument(stage, res, values);
+
+  return res.extract();
+}
+std::string SqlSelectTranslator::Parameterize(
+    const SqlSelectCommand& select,
+    std::vector< boost::optional< SqlSelectCommand::Literal > >& literals) {
+  typedef SqlSelectCommand::Predicate Predicate;
+
+  literals.clear();
+
+  if (select.GetParametersNumber() > 0)
+    return std::string();
+
+  std::string query = "SELECT ";
+
+  if (select.IsAllColumns()) {
+    query += '*';
+  } else {
+    for (size_t i = 0; i < select.GetColumns().size(); ++i) {
+      if (i > 0)
+        query += ", ";
+
+      query += QuoteIdentifier(select.GetColumns()[i]);
+    }
+  }
+
+  query += " FROM ";
+
+  if (!select.GetSchema().empty())
+    query += QuoteIdentifier(select.GetSchema()) + '.';
+
+  query += QuoteIdentifier(select.GetTable());
+
+  const std::vector< Predicate >& predicates = select.GetPredicates();
+  for (size_t i = 0; i < predicates.size(); ++i) {
+    const Predicate& predicate = predicates[i];
+
+    query += i == 0 ? " WHERE " : " AND ";
+    query += QuoteIdentifier(predicate.column) + ' '
+             + GetOperatorSql(predicate.op);
+
+    if (predicate.op != Predicate::IS_NULL
+        && predicate.op != Predicate::IS_NOT_NULL) {
+      query += " ?";
+
+      literals.push_back(predicate.literal);
+    }
+  }
+
+  const std::vector< SqlSelectCommand::SortKey >& orderBy =
+      select.GetOrderBy();
+  for (size_t i = 0; i < orderBy.size(); ++i) {
+    query += i == 0 ? " ORDER BY " : ", ";
+    query += QuoteIdentifier(orderBy[i].column)
+             + (orderBy[i].ascending ? " ASC" : " DESC");
+  }
+
+  // The row limit changes the stages of the pipeline, so it is kept.
+  if (select.GetLimit() >= 0)
+    query += " LIMIT " + std::to_string(select.GetLimit());
+
+  if (literals.empty())
+    return std::string();
+
+  return query;
+}
+
+SharedPointer< DocumentDbMqlQueryContext > SqlSelectTranslator::BindParameters(
+    const DocumentDbMqlQueryContext& context,
+    const std::vector< boost::optional< SqlSelectCommand::Literal > >&
+        values) {
+  SharedPointer< DocumentDbMqlQueryContext > bound(
+      new DocumentDbMqlQueryContext(context._collectionName));
+
+  try {
+    uint16_t parametersNumber = 0;
+
+    for (const std::string& stage : context._aggregateOperations) {
+      bsoncxx::document::value parsed = bsoncxx::from_json(stage);
+
+      parametersNumber =
+          std::max(parametersNumber, GetMaxParameterNumber(parsed.view()));
+
+      bound.Get()->_aggregateOperations.push_back(
+          bsoncxx::to_json(BindParameters(parsed.view(), values).view()));
+    }
+
+    // Every value must have its placeholder, which is not the case if the
+    // translation was not made natively.
+    if (parametersNumber != values.size())
+      return SharedPointer< DocumentDbMqlQueryContext >();
+  } catch (const OdbcError&) {
+    return SharedPointer< DocumentDbMqlQueryContext >();
+  } catch (const bsoncxx::exception&) {
+    return SharedPointer< DocumentDbMqlQueryContext >();
+  }
+
+  bound.Get()->_columnMetadata = context._columnMetadata;
+  bound.Get()->_paths = context._paths;
+
+  return bound;
+}
+}  // namespace odbc
+}  // namespace documentdb
\ No newline at end of file
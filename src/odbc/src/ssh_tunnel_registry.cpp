@@ -0,0 +1,263 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "documentdb/odbc/ssh_tunnel_registry.h"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+
+#include "documentdb/odbc/common/utils.h"
+#include "documentdb/odbc/log.h"
+
+using documentdb::odbc::common::concurrent::CsLockGuard;
+using documentdb::odbc::jni::DocumentDbConnection;
+using documentdb::odbc::jni::java::JniErrorCode;
+
+namespace documentdb {
+namespace odbc {
+SshTunnelRegistry& SshTunnelRegistry::GetInstance() {
+  static SshTunnelRegistry instance;
+
+  return instance;
+}
+
+std::shared_ptr< const int32_t > SshTunnelRegistry::Acquire(
+    const config::Configuration& config, SharedPointer< JniContext > ctx,
+    DocumentDbError& err) {
+  std::string key = MakeKey(config);
+
+  std::shared_ptr< Tunnel > existing;
+  SharedPointer< DocumentDbConnection > existingOwner;
+  {
+    CsLockGuard guard(lock_);
+
+    std::map< std::string, std::shared_ptr< Tunnel > >::iterator it =
+        tunnels_.find(key);
+
+    if (it != tunnels_.end()) {
+      existing = it->second;
+      existingOwner = existing->owner;
+
+      ++existing->references;
+    }
+  }
+
+  if (existing) {
+    // The tunnel can have been closed by the SSH server or the network since
+    // it was opened, so it is checked before it is handed out. The check is
+    // made outside of the lock, as it calls into the JVM.
+    bool isActive = false;
+    JniErrorInfo errInfo;
+    existingOwner.Get()->IsSshTunnelActive(isActive, errInfo);
+
+    {
+      CsLockGuard guard(lock_);
+
+      if (isActive) {
+        ++reused_;
+
+        LOG_DEBUG_MSG("SSH tunnel reused. local port: "
+                      << existing->localPort
+                      << ", references: " << existing->references
+                      << ", reused: " << reused_);
+      } else {
+        // Evicted, so that it is opened again below. The connections still
+        // using it close it when they are closed.
+        std::map< std::string, std::shared_ptr< Tunnel > >::iterator it =
+            tunnels_.find(key);
+
+        if (it != tunnels_.end() && it->second == existing)
+          tunnels_.erase(it);
+
+        LOG_INFO_MSG("SSH tunnel is not active anymore, reopening it. "
+                     "local port: "
+                     << existing->localPort);
+      }
+    }
+
+    if (isActive)
+      return MakeReference(key, existing);
+
+    Release(key, existing);
+  }
+
+  // The tunnel is opened outside of the lock, so that connections to other
+  // targets do not wait for it.
+  auto begin = std::chrono::steady_clock::now();
+
+  int32_t localPort = 0;
+  SharedPointer< DocumentDbConnection > owner =
+      Open(config, ctx, localPort, err);
+
+  if (!owner.IsValid())
+    return nullptr;
+
+  uint64_t setupTimeMs = static_cast< uint64_t >(
+      std::chrono::duration_cast< std::chrono::milliseconds >(
+          std::chrono::steady_clock::now() - begin)
+          .count());
+
+  SharedPointer< DocumentDbConnection > redundant;
+  std::shared_ptr< Tunnel > tunnel;
+  {
+    CsLockGuard guard(lock_);
+
+    std::map< std::string, std::shared_ptr< Tunnel > >::iterator it =
+        tunnels_.find(key);
+
+    if (it != tunnels_.end()) {
+      // Another connection opened the same tunnel in the meantime.
+      tunnel = it->second;
+      redundant = owner;
+
+      ++reused_;
+    } else {
+      tunnel = std::make_shared< Tunnel >();
+      tunnel->owner = owner;
+      tunnel->localPort = localPort;
+
+      tunnels_[key] = tunnel;
+
+      ++opened_;
+      setupTimeMs_ += setupTimeMs;
+      maxSetupTimeMs_ = std::max(maxSetupTimeMs_, setupTimeMs);
+
+      LOG_INFO_MSG("SSH tunnel opened in "
+                   << setupTimeMs << " ms. local port: " << localPort
+                   << ", tunnels: " << tunnels_.size());
+    }
+
+    ++tunnel->references;
+  }
+
+  if (redundant.IsValid()) {
+    JniErrorInfo errInfo;
+    redundant.Get()->Close(errInfo);
+  }
+
+  return MakeReference(key, tunnel);
+}
+
+SshTunnelRegistry::Statistics SshTunnelRegistry::GetStatistics() const {
+  Statistics stats;
+
+  CsLockGuard guard(lock_);
+
+  stats.tunnels = static_cast< uint32_t >(tunnels_.size());
+  stats.opened = opened_;
+  stats.reused = reused_;
+  stats.setupTimeMs = setupTimeMs_;
+  stats.maxSetupTimeMs = maxSetupTimeMs_;
+
+  for (const auto& entry : tunnels_)
+    stats.inUse += entry.second->references;
+
+  return stats;
+}
+
+std::string SshTunnelRegistry::MakeKey(const config::Configuration& config) {
+  std::string key = config.GetSshHost();
+  key.append(1, '\0').append(config.GetSshUser());
+  key.append(1, '\0').append(config.GetSshPrivateKeyFile());
+  // Only a hash of the passphrase is kept in memory with the tunnel.
+  key.append(1, '\0').append(common::LexicalCast< std::string >(
+      std::hash< std::string >()(config.GetSshPrivateKeyPassphrase())));
+  key.append(1, '\0').append(config.GetSshKnownHostsFile());
+  key.append(1, '\0').append(config.IsSshStrictHostKeyChecking() ? "strict"
+                                                                 : "");
+  key.append(1, '\0').append(config.GetHostname());
+  key.append(1, ':').append(
+      common::LexicalCast< std::string >(config.GetPort()));
+
+  return key;
+}
+
+SharedPointer< DocumentDbConnection > SshTunnelRegistry::Open(
+    const config::Configuration& config, SharedPointer< JniContext > ctx,
+    int32_t& localPort, DocumentDbError& err) {
+  SharedPointer< DocumentDbConnection > owner = new DocumentDbConnection(ctx);
+
+  JniErrorInfo errInfo;
+  if (owner.Get()->Open(config, errInfo)
+      != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS) {
+    err = DocumentDbError(
+        DocumentDbError::DOCUMENTDB_ERR_SECURE_CONNECTION_FAILURE,
+        errInfo.errMsg.c_str());
+    return nullptr;
+  }
+
+  bool isSSHTunnelActive = false;
+  JniErrorCode success =
+      owner.Get()->IsSshTunnelActive(isSSHTunnelActive, errInfo);
+
+  if (success == JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS
+      && isSSHTunnelActive)
+    success = owner.Get()->GetSshLocalPort(localPort, errInfo);
+
+  if (success != JniErrorCode::DOCUMENTDB_JNI_ERR_SUCCESS
+      || !isSSHTunnelActive) {
+    err = DocumentDbError(DocumentDbError::DOCUMENTDB_ERR_JVM_INIT,
+                          isSSHTunnelActive ? errInfo.errMsg.c_str()
+                                            : "SSH tunnel is not active.");
+
+    JniErrorInfo closeErrInfo;
+    owner.Get()->Close(closeErrInfo);
+    return nullptr;
+  }
+
+  return owner;
+}
+
+std::shared_ptr< const int32_t > SshTunnelRegistry::MakeReference(
+    const std::string& key, const std::shared_ptr< Tunnel >& tunnel) {
+  std::shared_ptr< Tunnel > reference(
+      tunnel.get(), [this, key, tunnel](Tunnel*) { Release(key, tunnel); });
+
+  return std::shared_ptr< const int32_t >(reference, &tunnel->localPort);
+}
+
+void SshTunnelRegistry::Release(const std::string& key,
+                                const std::shared_ptr< Tunnel >& tunnel) {
+  SharedPointer< DocumentDbConnection > owner;
+  {
+    CsLockGuard guard(lock_);
+
+    if (--tunnel->references > 0)
+      return;
+
+    std::map< std::string, std::shared_ptr< Tunnel > >::iterator it =
+        tunnels_.find(key);
+
+    if (it != tunnels_.end() && it->second == tunnel)
+      tunnels_.erase(it);
+
+    owner = tunnel->owner;
+    tunnel->owner = nullptr;
+
+    LOG_INFO_MSG("SSH tunnel closed. local port: "
+                 << tunnel->localPort << ", tunnels: " << tunnels_.size());
+  }
+
+  // Closed outside of the lock, so that other tunnels are not held up.
+  if (owner.IsValid()) {
+    JniErrorInfo errInfo;
+    owner.Get()->Close(errInfo);
+  }
+}
+}  // namespace odbc
+}  // namespace documentdb
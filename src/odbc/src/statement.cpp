@@ -34,6 +34,7 @@
 #include "documentdb/odbc/query/table_metadata_query.h"
 #include "documentdb/odbc/query/type_info_query.h"
 #include "documentdb/odbc/sql/sql_parser.h"
+#include "documentdb/odbc/sql/sql_select_translator.h"
 #include "documentdb/odbc/sql/sql_set_streaming_command.h"
 #include "documentdb/odbc/sql/sql_utils.h"
 #include "documentdb/odbc/system/odbc_constants.h"
@@ -49,8 +50,10 @@ Statement::Statement(Connection& parent)
       rowStatuses(0),
       columnBindOffset(0),
       rowArraySize(1),
+      rowBindType(SQL_BIND_BY_COLUMN),
       parameters(),
-      timeout(0) {
+      timeout(0),
+      prefetchBatches(parent.GetConfiguration().GetPrefetchBatches()) {
   // No-op.
 }
 
@@ -243,14 +246,10 @@ SqlResult::Type Statement::InternalSetAttribute(int attr, void* value,
     }
 
     case SQL_ATTR_ROW_BIND_TYPE: {
-      SqlUlen rowBindType = reinterpret_cast< SqlUlen >(value);
-
-      if (rowBindType != SQL_BIND_BY_COLUMN) {
-        AddStatusRecord(SqlState::SHYC00_OPTIONAL_FEATURE_NOT_IMPLEMENTED,
-                        "Only binding by column is currently supported");
-
-        return SqlResult::AI_ERROR;
-      }
+      // Either SQL_BIND_BY_COLUMN or the size of the row structure for
+      // row-wise binding.
+      rowBindType = reinterpret_cast< SqlUlen >(value);
+      LOG_DEBUG_MSG("rowBindType: " << rowBindType);
 
       break;
     }
@@ -332,6 +331,22 @@ SqlResult::Type Statement::InternalSetAttribute(int attr, void* value,
       break;
     }
 
+    case SQL_ATTR_DOCUMENTDB_PREFETCH_BATCHES: {
+      SqlUlen batches = reinterpret_cast< SqlUlen >(value);
+
+      if (batches > INT32_MAX) {
+        AddStatusRecord(SqlState::SHY024_INVALID_ATTRIBUTE_VALUE,
+                        "Prefetch batches value is too big.");
+
+        return SqlResult::AI_ERROR;
+      }
+
+      prefetchBatches = static_cast< int32_t >(batches);
+      LOG_DEBUG_MSG("prefetchBatches: " << prefetchBatches);
+
+      break;
+    }
+
     default: {
       AddStatusRecord(SqlState::SHYC00_OPTIONAL_FEATURE_NOT_IMPLEMENTED,
                       "Specified attribute is not supported.");
@@ -374,7 +389,7 @@ SqlResult::Type Statement::InternalGetAttribute(int attr, void* buf, SQLINTEGER,
     case SQL_ATTR_ROW_BIND_TYPE: {
       SqlUlen* val = reinterpret_cast< SqlUlen* >(buf);
 
-      *val = SQL_BIND_BY_COLUMN;
+      *val = rowBindType;
 
       break;
     }
@@ -483,6 +498,50 @@ SqlResult::Type Statement::InternalGetAttribute(int attr, void* buf, SQLINTEGER,
       break;
     }
 
+    case SQL_ATTR_DOCUMENTDB_PREFETCH_BATCHES: {
+      SqlUlen* batches = reinterpret_cast< SqlUlen* >(buf);
+
+      *batches = static_cast< SqlUlen >(prefetchBatches);
+
+      break;
+    }
+
+    case SQL_ATTR_DOCUMENTDB_FETCH_BATCHES:
+    case SQL_ATTR_DOCUMENTDB_FETCH_DOCUMENTS:
+    case SQL_ATTR_DOCUMENTDB_FETCH_BYTES:
+    case SQL_ATTR_DOCUMENTDB_FETCH_BATCH_SIZE:
+    case SQL_ATTR_DOCUMENTDB_FETCH_TIME: {
+      SqlUlen* val = reinterpret_cast< SqlUlen* >(buf);
+
+      *val = 0;
+      if (currentQuery.get()
+          && currentQuery->GetType() == query::QueryType::DATA) {
+        const FetchStatistics& stats =
+            static_cast< query::DataQuery& >(*currentQuery)
+                .GetFetchStatistics();
+
+        switch (attr) {
+          case SQL_ATTR_DOCUMENTDB_FETCH_BATCHES:
+            *val = static_cast< SqlUlen >(stats.batches);
+            break;
+          case SQL_ATTR_DOCUMENTDB_FETCH_DOCUMENTS:
+            *val = static_cast< SqlUlen >(stats.documents);
+            break;
+          case SQL_ATTR_DOCUMENTDB_FETCH_BYTES:
+            *val = static_cast< SqlUlen >(stats.bytes);
+            break;
+          case SQL_ATTR_DOCUMENTDB_FETCH_BATCH_SIZE:
+            *val = static_cast< SqlUlen >(stats.batchSize);
+            break;
+          default:
+            *val = static_cast< SqlUlen >(stats.fetchTimeUs);
+            break;
+        }
+      }
+
+      break;
+    }
+
     default: {
       AddStatusRecord(SqlState::SHYC00_OPTIONAL_FEATURE_NOT_IMPLEMENTED,
                       "Specified attribute is not supported.");
@@ -511,6 +570,15 @@ SqlResult::Type Statement::InternalGetParametersNumber(uint16_t& paramNum) {
     return SqlResult::AI_SUCCESS;
   }
 
+  query::DataQuery* qry = static_cast< query::DataQuery* >(currentQuery.get());
+
+  std::shared_ptr< SqlSelectCommand > select =
+      SqlSelectTranslator::Parse(qry->GetSql());
+
+  if (select && select->GetParametersNumber() > 0
+      && qry->GetNativeParametersNumber(paramNum))
+    return SqlResult::AI_SUCCESS;
+
   if (!parameters.IsMetadataSet()) {
     SqlResult::Type res = UpdateParamsMeta();
 
@@ -562,7 +630,7 @@ SqlResult::Type Statement::ProcessInternalCommand(const std::string& query) {
 
     parameters.Prepare();
 
-    currentQuery.reset(new query::InternalQuery(*this, query, cmd));
+    SetCurrentQuery(new query::InternalQuery(*this, query, cmd));
 
     return SqlResult::AI_SUCCESS;
   } catch (const OdbcError& err) {
@@ -582,8 +650,9 @@ SqlResult::Type Statement::InternalPrepareSqlQuery(const std::string& query) {
   if (currentQuery.get())
     currentQuery->Close();
 
-  currentQuery.reset(
-      new query::DataQuery(*this, connection, query, parameters, timeout));
+  SetCurrentQuery(
+      new query::DataQuery(*this, connection, query, parameters, timeout,
+                           prefetchBatches, rowArraySize));
 
   return SqlResult::AI_SUCCESS;
 }
@@ -616,14 +685,15 @@ SqlResult::Type Statement::InternalExecuteSqlQuery() {
       && currentQuery->GetType() == query::QueryType::DATA) {
     query::DataQuery& qry = static_cast< query::DataQuery& >(*currentQuery);
 
-    currentQuery.reset(new query::BatchQuery(*this, connection, qry.GetSql(),
-                                             parameters, timeout));
+    SetCurrentQuery(new query::BatchQuery(*this, connection, qry.GetSql(),
+                                          parameters, timeout));
   } else if (parameters.GetParamSetSize() == 1
              && currentQuery->GetType() == query::QueryType::BATCH) {
     query::BatchQuery& qry = static_cast< query::BatchQuery& >(*currentQuery);
 
-    currentQuery.reset(new query::DataQuery(*this, connection, qry.GetSql(),
-                                            parameters, timeout));
+    SetCurrentQuery(new query::DataQuery(*this, connection, qry.GetSql(),
+                                         parameters, timeout, prefetchBatches,
+                                         rowArraySize));
   }
 
   if (parameters.GetParamSetSize() > 1
@@ -643,16 +713,7 @@ SqlResult::Type Statement::InternalExecuteSqlQuery() {
       return SqlResult::AI_ERROR;
     }
 
-    // In a normal case we should return SQL_NEED_DATA, but since we dont support
-    // parameters in sql statemets we will return not support and SQL_ERROR
-    AddStatusRecord(
-        SqlState::SHYC00_OPTIONAL_FEATURE_NOT_IMPLEMENTED,
-        "Usage the value \"?\" as query parameters are not supported."
-        "See ODBC limitations at "
-        "https://github.com/aws/amazon-documentdb-odbc-driver/blob/develop/src/"
-        "markdown/support/odbc-limitations.md");
-
-    return SqlResult::AI_ERROR;
+    return SqlResult::AI_NEED_DATA;
   }
 
   return currentQuery->Execute();
@@ -678,8 +739,8 @@ SqlResult::Type Statement::InternalExecuteGetColumnsMetaQuery(
   if (schema0.empty())
     schema0 = connection.GetSchema();
 
-  currentQuery.reset(new query::ColumnMetadataQuery(*this, connection, catalog,
-                                                    schema, table, column));
+  SetCurrentQuery(new query::ColumnMetadataQuery(*this, connection, catalog,
+                                                 schema, table, column));
 
   return currentQuery->Execute();
 }
@@ -699,8 +760,8 @@ SqlResult::Type Statement::InternalExecuteGetTablesMetaQuery(
   if (currentQuery.get())
     currentQuery->Close();
 
-  currentQuery.reset(new query::TableMetadataQuery(*this, connection, catalog,
-                                                   schema, table, tableType));
+  SetCurrentQuery(new query::TableMetadataQuery(*this, connection, catalog,
+                                                schema, table, tableType));
 
   return currentQuery->Execute();
 }
@@ -725,7 +786,7 @@ SqlResult::Type Statement::InternalExecuteGetForeignKeysQuery(
   if (currentQuery.get())
     currentQuery->Close();
 
-  currentQuery.reset(new query::ForeignKeysQuery(
+  SetCurrentQuery(new query::ForeignKeysQuery(
       *this, connection, foreignCatalog, foreignSchema, foreignTable));
 
   return currentQuery->Execute();
@@ -746,7 +807,7 @@ SqlResult::Type Statement::InternalExecuteGetPrimaryKeysQuery(
   if (currentQuery.get())
     currentQuery->Close();
 
-  currentQuery.reset(
+  SetCurrentQuery(
       new query::PrimaryKeysQuery(*this, connection, catalog, schema, table));
 
   return currentQuery->Execute();
@@ -774,7 +835,7 @@ SqlResult::Type Statement::InternalExecuteSpecialColumnsQuery(
   if (currentQuery.get())
     currentQuery->Close();
 
-  currentQuery.reset(new query::SpecialColumnsQuery(
+  SetCurrentQuery(new query::SpecialColumnsQuery(
       *this, type, catalog, schema, table, scope, nullable));
 
   return currentQuery->Execute();
@@ -798,7 +859,7 @@ SqlResult::Type Statement::InternalExecuteGetTypeInfoQuery(int16_t sqlType) {
   if (currentQuery.get())
     currentQuery->Close();
 
-  currentQuery.reset(new query::TypeInfoQuery(*this, connection, sqlType));
+  SetCurrentQuery(new query::TypeInfoQuery(*this, connection, sqlType));
 
   return currentQuery->Execute();
 }
@@ -854,6 +915,24 @@ SqlResult::Type Statement::InternalClose() {
   return result;
 }
 
+void Statement::Cancel() {
+  // Keeps the query from being replaced while it is canceled.
+  common::concurrent::CsLockGuard guard(currentQueryLock);
+
+  if (currentQuery.get())
+    currentQuery->Cancel();
+}
+
+void Statement::SetCurrentQuery(query::Query* qry) {
+  std::unique_ptr< query::Query > previous(qry);
+
+  {
+    common::concurrent::CsLockGuard guard(currentQueryLock);
+
+    currentQuery.swap(previous);
+  }
+}
+
 void Statement::FetchScroll(int16_t orientation, int64_t offset) {
   DOCUMENTDB_ODBC_API_CALL(InternalFetchScroll(orientation, offset));
 }
@@ -887,40 +966,23 @@ SqlResult::Type Statement::InternalFetchRow() {
     return SqlResult::AI_ERROR;
   }
 
-  if (columnBindOffset) {
-    for (app::ColumnBindingMap::iterator it = columnBindings.begin();
-         it != columnBindings.end(); ++it)
+  for (app::ColumnBindingMap::iterator it = columnBindings.begin();
+       it != columnBindings.end(); ++it) {
+    it->second.SetBindType(rowBindType);
+
+    if (columnBindOffset)
       it->second.SetByteOffset(*columnBindOffset);
   }
 
-  SQLINTEGER fetched = 0;
-  SQLINTEGER errors = 0;
-
-  for (SqlUlen i = 0; i < rowArraySize; ++i) {
-    for (app::ColumnBindingMap::iterator it = columnBindings.begin();
-         it != columnBindings.end(); ++it)
-      it->second.SetElementOffset(i);
+  SqlUlen fetched = 0;
 
-    SqlResult::Type res = currentQuery->FetchNextRow(columnBindings);
-
-    if (res == SqlResult::AI_SUCCESS || res == SqlResult::AI_SUCCESS_WITH_INFO)
-      ++fetched;
-    else if (res != SqlResult::AI_NO_DATA)
-      ++errors;
-
-    if (rowStatuses)
-      rowStatuses[i] = SqlResultToRowResult(res);
-  }
+  SqlResult::Type res = currentQuery->FetchNextRowSet(
+      columnBindings, rowArraySize, rowStatuses, fetched);
 
   if (rowsFetched)
-    *rowsFetched =
-        fetched < 0 ? static_cast< SQLINTEGER >(rowArraySize) : fetched;
-
-  if (fetched > 0)
-    return errors == 0 ? SqlResult::AI_SUCCESS
-                       : SqlResult::AI_SUCCESS_WITH_INFO;
+    *rowsFetched = static_cast< SQLINTEGER >(fetched);
 
-  return errors == 0 ? SqlResult::AI_NO_DATA : SqlResult::AI_ERROR;
+  return res;
 }
 
 const meta::ColumnMetaVector* Statement::GetMeta() {
@@ -1092,12 +1154,7 @@ SqlResult::Type Statement::InternalSelectParam(void** paramPtr) {
     return SqlResult::AI_NEED_DATA;
   }
 
-  SqlResult::Type res = currentQuery->Execute();
-
-  if (res != SqlResult::AI_SUCCESS)
-    res = SqlResult::AI_SUCCESS_WITH_INFO;
-
-  return res;
+  return currentQuery->Execute();
 }
 
 void Statement::PutData(void* data, SqlLen len) {
@@ -1235,21 +1292,5 @@ SqlResult::Type Statement::UpdateParamsMeta() {
 
   return SqlResult::AI_SUCCESS;
 }
-
-uint16_t Statement::SqlResultToRowResult(SqlResult::Type value) {
-  switch (value) {
-    case SqlResult::AI_NO_DATA:
-      return SQL_ROW_NOROW;
-
-    case SqlResult::AI_SUCCESS:
-      return SQL_ROW_SUCCESS;
-
-    case SqlResult::AI_SUCCESS_WITH_INFO:
-      return SQL_ROW_SUCCESS_WITH_INFO;
-
-    default:
-      return SQL_ROW_ERROR;
-  }
-}
 }  // namespace odbc
 }  // namespace documentdb
@@ -21,6 +21,7 @@
 
 #include <cassert>
 #include <codecvt>
+#include <cstring>
 
 #include "documentdb/odbc/system/odbc_constants.h"
 #include "documentdb/odbc/log.h"
@@ -31,19 +32,63 @@ namespace utility {
 using namespace odbc::impl::binary;
 using namespace odbc::common;
 
+namespace {
+/**
+ * Check if the string consists of 7-bit ASCII characters only.
+ *
+ * @param str String.
+ * @param len String length in bytes.
+ * @return @c true if all the characters are ASCII.
+ */
+bool IsAscii(const char* str, size_t len) {
+  for (size_t i = 0; i < len; ++i) {
+    if (static_cast< unsigned char >(str[i]) & 0x80)
+      return false;
+  }
+  return true;
+}
+}  // namespace
+
 size_t CopyUtf8StringToSqlCharString(const char* inBuffer, SQLCHAR* outBuffer,
                                      size_t outBufferLenBytes,
                                      bool& isTruncated) {
+  if (!inBuffer)
+    return 0;
+
+  return CopyUtf8StringToSqlCharString(inBuffer, std::strlen(inBuffer),
+                                       outBuffer, outBufferLenBytes,
+                                       isTruncated);
+}
+
+size_t CopyUtf8StringToSqlCharString(const char* inBuffer, size_t inBufferLen,
+                                     SQLCHAR* outBuffer,
+                                     size_t outBufferLenBytes,
+                                     bool& isTruncated) {
   if (!inBuffer || (outBuffer && outBufferLenBytes == 0))
     return 0;
 
+  // ASCII is the same in UTF-8 and in the narrow encoding, copy as is.
+  if (IsAscii(inBuffer, inBufferLen)) {
+    if (!outBuffer)
+      return inBufferLen;
+
+    size_t outBufferLenActual = std::min(inBufferLen, outBufferLenBytes - 1);
+    memcpy(outBuffer, inBuffer, outBufferLenActual);
+
+    outBuffer[outBufferLenActual] = 0;
+    isTruncated = (outBufferLenActual < inBufferLen);
+
+    return outBufferLenActual;
+  }
+
   // Need to convert input string to wide-char to get the
   // length in characters - as well as get .narrow() to work, as expected
   // Otherwise, it would be impossible to safely determine the
   // output buffer length needed.
   static std::wstring_convert< std::codecvt_utf8< wchar_t >, wchar_t >
       converter;
-  std::wstring inString = converter.from_bytes(inBuffer);
+  std::wstring inString =
+      converter.from_bytes(inBuffer, inBuffer + inBufferLen);
   size_t inBufferLenChars = inString.size();
 
   // If no output buffer, return REQUIRED length.
@@ -64,7 +109,8 @@ size_t CopyUtf8StringToSqlCharString(const char* inBuffer, SQLCHAR* outBuffer,
 }
 
 template < typename OutCharT >
-size_t CopyUtf8StringToWcharString(const char* inBuffer, OutCharT* outBuffer,
+size_t CopyUtf8StringToWcharString(const char* inBuffer, size_t inBufferLen,
+                                   OutCharT* outBuffer,
                                    size_t outBufferLenBytes,
                                    bool& isTruncated) {
   if (!inBuffer || (outBuffer && outBufferLenBytes == 0))
@@ -75,12 +121,26 @@ size_t CopyUtf8StringToWcharString(const char* inBuffer, OutCharT* outBuffer,
   assert(sizeof(OutCharT) == wCharSize);
   assert((outBufferLenBytes % wCharSize) == 0);
 
+  // ASCII characters map one-to-one to wide characters, widen them directly.
+  if (IsAscii(inBuffer, inBufferLen)) {
+    isTruncated = false;
+    if (!outBuffer)
+      return inBufferLen * wCharSize;
+
+    size_t lenConverted =
+        std::min(inBufferLen, (outBufferLenBytes / wCharSize) - 1);
+    for (size_t i = 0; i < lenConverted; ++i) {
+      outBuffer[i] = static_cast< OutCharT >(inBuffer[i]);
+    }
+    outBuffer[lenConverted] = 0;
+    isTruncated = (lenConverted < inBufferLen);
+
+    return lenConverted * wCharSize;
+  }
+
   // The number of characters that can be safely transfered, excluding the
   // null terminating character.
   size_t outBufferLenChars;
-  // Find the lenght (in bytes) of the input string.
-  // This does NOT include the null-terminating character.
-  size_t inBufferLen = std::strlen(inBuffer);
   OutCharT* pOutBuffer;
   std::vector< OutCharT > targetProxy;
 
@@ -137,7 +197,8 @@ size_t CopyUtf8StringToWcharString(const char* inBuffer, OutCharT* outBuffer,
     default:
       // This situation occurs if the source and target are the same encoding.
       // Impossible?
-      LOG_ERROR_MSG("Unexpected error converting string '" << inBuffer << "'");
+      LOG_ERROR_MSG("Unexpected error converting string '"
+                    << std::string(inBuffer, inBufferLen) << "'");
       assert(false);
       break;
   }
@@ -152,19 +213,32 @@ size_t CopyUtf8StringToSqlWcharString(const char* inBuffer, SQLWCHAR* outBuffer,
   if (!inBuffer)
     return 0;
 
+  return CopyUtf8StringToSqlWcharString(inBuffer, std::strlen(inBuffer),
+                                        outBuffer, outBufferLenBytes,
+                                        isTruncated);
+}
+
+size_t CopyUtf8StringToSqlWcharString(const char* inBuffer, size_t inBufferLen,
+                                      SQLWCHAR* outBuffer,
+                                      size_t outBufferLenBytes,
+                                      bool& isTruncated) {
+  if (!inBuffer)
+    return 0;
+
   // Handles SQLWCHAR if either UTF-16 and UTF-32
   size_t wCharSize = sizeof(SQLWCHAR);
   switch (wCharSize) {
     case 2:
       return CopyUtf8StringToWcharString(
-          inBuffer, reinterpret_cast< char16_t* >(outBuffer), outBufferLenBytes,
-          isTruncated);
+          inBuffer, inBufferLen, reinterpret_cast< char16_t* >(outBuffer),
+          outBufferLenBytes, isTruncated);
     case 4:
       return CopyUtf8StringToWcharString(
-          inBuffer, reinterpret_cast< char32_t* >(outBuffer), outBufferLenBytes,
-          isTruncated);
+          inBuffer, inBufferLen, reinterpret_cast< char32_t* >(outBuffer),
+          outBufferLenBytes, isTruncated);
     default:
-      LOG_ERROR_MSG("Unexpected error converting string '" << inBuffer << "'");
+      LOG_ERROR_MSG("Unexpected error converting string '"
+                    << std::string(inBuffer, inBufferLen) << "'");
       assert(false);
       return 0;
   }
@@ -208,6 +282,56 @@ void WriteString(BinaryWriterImpl& writer, const std::string& str) {
   writer.WriteString(str.data(), static_cast< int32_t >(str.size()));
 }
 
+void ReadOptionalString(BinaryReaderImpl& reader,
+                        boost::optional< std::string >& str) {
+  if (reader.SkipIfNull()) {
+    str = boost::none;
+    return;
+  }
+
+  std::string res;
+  reader.ReadString(res);
+  str = res;
+}
+
+void WriteOptionalString(BinaryWriterImpl& writer,
+                         const boost::optional< std::string >& str) {
+  if (str)
+    WriteString(writer, *str);
+  else
+    writer.WriteNull();
+}
+
+void ReadOptionalInt16(BinaryReaderImpl& reader,
+                       boost::optional< int16_t >& val) {
+  if (reader.ReadBool())
+    val = reader.ReadInt16();
+  else
+    val = boost::none;
+}
+
+void WriteOptionalInt16(BinaryWriterImpl& writer,
+                        const boost::optional< int16_t >& val) {
+  writer.WriteBool(val.is_initialized());
+  if (val)
+    writer.WriteInt16(*val);
+}
+
+void ReadOptionalInt32(BinaryReaderImpl& reader,
+                       boost::optional< int32_t >& val) {
+  if (reader.ReadBool())
+    val = reader.ReadInt32();
+  else
+    val = boost::none;
+}
+
+void WriteOptionalInt32(BinaryWriterImpl& writer,
+                        const boost::optional< int32_t >& val) {
+  writer.WriteBool(val.is_initialized());
+  if (val)
+    writer.WriteInt32(*val);
+}
+
 void ReadDecimal(BinaryReaderImpl& reader, Decimal& decimal) {
   int8_t hdr = reader.ReadInt8();
 
@@ -135,6 +135,9 @@ class PerformanceTestRunner {
   // _output_mode = 3 - output all above (combined and separate)
   int _output_mode = 0;
 
+  // time to allocate the handles and connect, in milliseconds
+  long long _connect_time_ms = 0;
+
   // HELPER FUNCTIONS
 
   // return true if filename has extension = ".xxx"
@@ -250,6 +253,11 @@ class PerformanceTestRunner {
   // set data source name
   void SetDSN(const std::string dsn);
 
+  // get time taken by SetupConnection(), in milliseconds
+  inline long long GetConnectTime() const {
+    return _connect_time_ms;
+  }
+
   // get results
   inline std::vector< TestCase > GetTestResults() const {
     return _results;
@@ -934,6 +934,9 @@ void performance::PerformanceTestRunner::SetupConnection() {
   test_string password = to_test_string(_password);
   std::string error_msg;
 
+  // time the cold connect: JVM start-up, class loading and the connection
+  auto time_connect_start = std::chrono::steady_clock::now();
+
   ret = SQLAllocHandle(SQL_HANDLE_ENV, SQL_NULL_HANDLE, &_env);
   if (ret == SQL_INVALID_HANDLE || ret == SQL_ERROR) {
     error_msg = "SQLAllocHandle ERROR: failed to allocate environment handle.";
@@ -977,6 +980,11 @@ void performance::PerformanceTestRunner::SetupConnection() {
     throw std::runtime_error(error_msg);
   }
   // Connection established: connection and environment handles are set
+  auto time_connect_end = std::chrono::steady_clock::now();
+  _connect_time_ms = std::chrono::duration_cast< std::chrono::milliseconds >(
+                         time_connect_end - time_connect_start)
+                         .count();
+  std::cout << "Connect time: " << _connect_time_ms << " ms" << std::endl;
 }
 
 void performance::PerformanceTestRunner::RunPerformanceTestPlan() {